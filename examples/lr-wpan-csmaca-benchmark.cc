@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * Per-access cost of the CSMA/CA engines.
+ *
+ * A single PAN coordinator runs each engine in a loop, Start() to the channel
+ * result, for a fixed number of channel accesses. The PHY still takes its
+ * 8-symbol CCA, but its PLME-CCA.confirm is replaced by a scripted channel that
+ * reports BUSY with the busy probability of the scenario (idle, lightly busy,
+ * saturated), so only the engine and the CCA timing are measured. The MAC is
+ * bypassed once the first access is started: the engine reports to the
+ * benchmark, which starts the next access.
+ *
+ * For each engine and channel the benchmark reports the wall time, the events
+ * scheduled and the heap allocations per access, and writes them as CSV for
+ * regression comparison.
+ *
+ *   ./ns3 run "lr-wpan-csmaca-benchmark --accesses=20000 --csv=csma.csv"
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-csmaca-gnu-noba.h>
+#include <ns3/lr-wpan-csmaca-noba.h>
+#include <ns3/lr-wpan-csmaca-standard.h>
+#include <ns3/lr-wpan-csmaca-sw-noba.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/lr-wpan-profiler.h>
+#include <ns3/node.h>
+#include <ns3/packet.h>
+#include <ns3/single-model-spectrum-channel.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+/// Heap allocations of the process
+static uint64_t g_allocations = 0;
+
+void*
+operator new(std::size_t size)
+{
+    g_allocations++;
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+/**
+ * Result of one engine on one channel.
+ */
+struct BenchmarkResult
+{
+    uint32_t accesses = 0;     //!< Measured accesses
+    uint32_t idle = 0;         //!< Accesses ending with CHANNEL_IDLE
+    uint32_t failures = 0;     //!< Accesses ending with a channel access failure
+    uint32_t deferrals = 0;    //!< Accesses deferred to the next CAP
+    double wallTime = 0;       //!< Wall time (s)
+    uint64_t scheduled = 0;    //!< Events scheduled
+    uint64_t allocations = 0;  //!< Heap allocations
+    double simTime = 0;        //!< Simulated time (s)
+};
+
+/**
+ * Runs one engine on one scripted channel.
+ */
+class CsmaCaBenchmark
+{
+  public:
+    /**
+     * \param csma the engine, not yet attached
+     * \param option the matching MAC CSMA/CA option
+     * \param busy the probability that a CCA finds the channel busy
+     * \param warmup the accesses run before the measurement
+     * \param accesses the measured accesses
+     * \param seed the run number of the channel and engine random streams
+     */
+    CsmaCaBenchmark(Ptr<LrWpanCsmaCaCommon> csma,
+                    CsmaOption option,
+                    double busy,
+                    uint32_t warmup,
+                    uint32_t accesses,
+                    uint32_t seed);
+
+    /**
+     * \return the measurement
+     */
+    BenchmarkResult Run();
+
+  private:
+    /**
+     * Scripted channel, in place of the sensed energy.
+     * \param status the CCA result of the PHY, ignored
+     */
+    void CcaConfirm(PhyEnumeration status);
+
+    /**
+     * End of an access.
+     * \param state the engine result
+     */
+    void AccessDone(MacState state);
+
+    /// \return the events scheduled so far
+    static uint64_t GetScheduled();
+
+    Ptr<LrWpanNetDevice> m_dev;         //!< The coordinator
+    Ptr<LrWpanCsmaCaCommon> m_csma;     //!< The engine
+    Ptr<UniformRandomVariable> m_channel; //!< Channel state draws
+    double m_busy;                      //!< Busy probability
+    uint32_t m_warmup;                  //!< Warm-up accesses
+    uint32_t m_target;                  //!< Measured accesses
+    uint32_t m_done;                    //!< Accesses done, including the warm-up
+    BenchmarkResult m_result;           //!< The measurement
+    std::chrono::steady_clock::time_point m_wallStart; //!< Wall time at the end of the warm-up
+    uint64_t m_scheduledStart;          //!< Events at the end of the warm-up
+    uint64_t m_allocationsStart;        //!< Allocations at the end of the warm-up
+    Time m_simStart;                    //!< Simulated time at the end of the warm-up
+};
+
+CsmaCaBenchmark::CsmaCaBenchmark(Ptr<LrWpanCsmaCaCommon> csma,
+                                 CsmaOption option,
+                                 double busy,
+                                 uint32_t warmup,
+                                 uint32_t accesses,
+                                 uint32_t seed)
+    : m_csma(csma),
+      m_busy(busy),
+      m_warmup(warmup),
+      m_target(accesses),
+      m_done(0),
+      m_scheduledStart(0),
+      m_allocationsStart(0)
+{
+    RngSeedManager::SetRun(seed);
+
+    Ptr<SingleModelSpectrumChannel> channel = CreateObject<SingleModelSpectrumChannel>();
+    Ptr<Node> node = CreateObject<Node>();
+    m_dev = CreateObject<LrWpanNetDevice>();
+    m_dev->SetChannel(channel);
+    m_dev->SetNode(node);
+    node->AddDevice(m_dev);
+    m_dev->SetAddress(Mac16Address("00:01"));
+    m_dev->GetMac()->SetPanId(5);
+    m_dev->GetMac()->SetCsmaCaOption(option);
+    m_dev->SetCsmaCa(csma);
+
+    // Bypass the MAC and the sensed energy once the device is configured.
+    m_dev->GetPhy()->SetPlmeCcaConfirmCallback(MakeCallback(&CsmaCaBenchmark::CcaConfirm, this));
+    m_csma->SetLrWpanMacStateCallback(MakeCallback(&CsmaCaBenchmark::AccessDone, this));
+    m_channel = CreateObject<UniformRandomVariable>();
+
+    // The longest superframe, so that the accesses are not cut by the CAP end.
+    MlmeStartRequestParams params;
+    params.m_panCoor = true;
+    params.m_PanId = 5;
+    params.m_bcnOrd = 14;
+    params.m_sfrmOrd = 14;
+    Simulator::ScheduleNow(&LrWpanMac::MlmeStartRequest, m_dev->GetMac(), params);
+
+    // One data frame brings the MAC to MAC_CSMA, which starts the first access.
+    McpsDataRequestParams data;
+    data.m_dstPanId = 5;
+    data.m_srcAddrMode = SHORT_ADDR;
+    data.m_dstAddrMode = SHORT_ADDR;
+    data.m_dstAddr = Mac16Address("00:02");
+    data.m_txOptions = TX_OPTION_ACK;
+    Simulator::Schedule(Seconds(0.1),
+                        &LrWpanMac::McpsDataRequest,
+                        m_dev->GetMac(),
+                        data,
+                        Create<Packet>(50));
+}
+
+uint64_t
+CsmaCaBenchmark::GetScheduled()
+{
+    uint64_t scheduled = 0;
+    for (const auto& e : LrWpanProfiler::GetEntries())
+    {
+        scheduled += e.scheduled;
+    }
+    return scheduled;
+}
+
+void
+CsmaCaBenchmark::CcaConfirm(PhyEnumeration status)
+{
+    m_csma->PlmeCcaConfirm(m_channel->GetValue() < m_busy ? IEEE_802_15_4_PHY_BUSY
+                                                          : IEEE_802_15_4_PHY_IDLE);
+}
+
+void
+CsmaCaBenchmark::AccessDone(MacState state)
+{
+    if (m_done >= m_warmup)
+    {
+        m_result.accesses++;
+        m_result.idle += state == CHANNEL_IDLE;
+        m_result.failures += state == CHANNEL_ACCESS_FAILURE;
+        m_result.deferrals += state == MAC_CSMA_DEFERRED;
+    }
+    m_done++;
+
+    if (m_done == m_warmup)
+    {
+        m_wallStart = std::chrono::steady_clock::now();
+        m_scheduledStart = GetScheduled();
+        m_allocationsStart = g_allocations;
+        m_simStart = Simulator::Now();
+    }
+    if (m_done == m_warmup + m_target)
+    {
+        std::chrono::duration<double> wall = std::chrono::steady_clock::now() - m_wallStart;
+        m_result.wallTime = wall.count();
+        m_result.scheduled = GetScheduled() - m_scheduledStart;
+        m_result.allocations = g_allocations - m_allocationsStart;
+        m_result.simTime = (Simulator::Now() - m_simStart).GetSeconds();
+        Simulator::Stop();
+        return;
+    }
+
+    if (state == MAC_CSMA_DEFERRED)
+    {
+        // The CAP is over: the MAC restarts the access after the next beacon.
+        m_dev->GetMac()->SetLrWpanMacState(MAC_CSMA_DEFERRED);
+        return;
+    }
+    // As the MAC does, start the next access from a fresh event.
+    Simulator::ScheduleNow(&LrWpanCsmaCaCommon::Start, m_csma);
+}
+
+BenchmarkResult
+CsmaCaBenchmark::Run()
+{
+    Simulator::Run();
+    return m_result;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t accesses = 10000;
+    uint32_t warmup = 100;
+    uint32_t tp = 0;
+    uint32_t seed = 1;
+    std::string engines = "beb,noba,swnoba,standard,gnunoba";
+    std::string csvFile;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("accesses", "Measured channel accesses per engine and channel", accesses);
+    cmd.AddValue("warmup", "Channel accesses run before the measurement", warmup);
+    cmd.AddValue("tp", "TP of the device (selects the contention window of the variants)", tp);
+    cmd.AddValue("seed", "Run number", seed);
+    cmd.AddValue("engines", "Comma separated engines: beb, noba, swnoba, standard, gnunoba", engines);
+    cmd.AddValue("csv", "Write the results as CSV to this file (empty: none)", csvFile);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(accesses == 0, "No access to measure");
+    NS_ABORT_MSG_IF(tp >= 8, "TP out of range");
+
+    // Counts the scheduled events; the timing samples are made negligible.
+    LrWpanProfiler::Enable(1U << 30);
+
+    const std::pair<std::string, double> channels[] = {{"idle", 0.0},
+                                                       {"light", 0.2},
+                                                       {"saturated", 0.8}};
+
+    std::ofstream csv;
+    if (!csvFile.empty())
+    {
+        csv.open(csvFile);
+        NS_ABORT_MSG_IF(!csv, "Cannot write " << csvFile);
+        csv << "engine,channel,busy,accesses,idle,failures,deferrals,nsPerAccess,"
+               "eventsPerAccess,allocationsPerAccess,simTimePerAccess"
+            << std::endl;
+    }
+
+    std::cout << std::left << std::setw(10) << "engine" << std::setw(11) << "channel"
+              << std::right << std::setw(10) << "ns/acc" << std::setw(12) << "events/acc"
+              << std::setw(12) << "allocs/acc" << std::setw(12) << "sim ms/acc" << std::setw(8)
+              << "idle%" << std::endl;
+
+    std::istringstream engineList(engines);
+    std::string engine;
+    while (std::getline(engineList, engine, ','))
+    {
+        for (const auto& [channel, busy] : channels)
+        {
+            Ptr<LrWpanCsmaCaCommon> csma;
+            CsmaOption option;
+            if (engine == "beb")
+            {
+                csma = CreateObject<LrWpanCsmaCa>(tp);
+                option = CSMA_ORIGINAL;
+            }
+            else if (engine == "noba")
+            {
+                csma = CreateObject<LrWpanCsmaCaNoba>(tp);
+                option = CSMA_NOBA;
+            }
+            else if (engine == "swnoba")
+            {
+                csma = CreateObject<LrWpanCsmaCaSwNoba>(tp);
+                option = CSMA_SW_NOBA;
+            }
+            else if (engine == "standard")
+            {
+                csma = CreateObject<LrWpanCsmaCaStandard>(tp);
+                option = CSMA_STANDARD;
+            }
+            else if (engine == "gnunoba")
+            {
+                csma = CreateObject<LrWpanCsmaCaGnuNoba>(tp);
+                option = CSMA_GNU_NOBA;
+            }
+            else
+            {
+                NS_FATAL_ERROR("Unknown engine " << engine);
+            }
+
+            BenchmarkResult r;
+            {
+                CsmaCaBenchmark benchmark(csma, option, busy, warmup, accesses, seed);
+                LrWpanProfiler::Reset();
+                r = benchmark.Run();
+            }
+            Simulator::Destroy();
+            NS_ABORT_MSG_IF(r.accesses != accesses,
+                            engine << " on a " << channel << " channel stopped after "
+                                   << r.accesses << " accesses");
+
+            double ns = r.wallTime * 1e9 / r.accesses;
+            double events = static_cast<double>(r.scheduled) / r.accesses;
+            double allocations = static_cast<double>(r.allocations) / r.accesses;
+            double simMs = r.simTime * 1e3 / r.accesses;
+            std::cout << std::left << std::setw(10) << engine << std::setw(11) << channel
+                      << std::right << std::fixed << std::setprecision(1) << std::setw(10) << ns
+                      << std::setprecision(2) << std::setw(12) << events << std::setw(12)
+                      << allocations << std::setw(12) << simMs << std::setprecision(1)
+                      << std::setw(8) << 100.0 * r.idle / r.accesses << std::endl;
+            if (csv.is_open())
+            {
+                csv << engine << "," << channel << "," << busy << "," << r.accesses << ","
+                    << r.idle << "," << r.failures << "," << r.deferrals << "," << ns << ","
+                    << events << "," << allocations << "," << simMs << std::endl;
+            }
+        }
+    }
+    return 0;
+}
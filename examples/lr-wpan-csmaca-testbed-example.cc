@@ -13,10 +13,18 @@
  #include <ns3/lr-wpan-csmaca-standard.h>
  #include <ns3/lr-wpan-csmaca-sw-noba.h>
  #include <ns3/lr-wpan-csmaca-gnu-noba.h>
+ #include <ns3/lr-wpan-csmaca-model.h>
  #include <ns3/lr-wpan-delay-tag.h>
+ #include <ns3/lr-wpan-latency-histogram.h>
  #include <ns3/lr-wpan-module.h>
+ #include <ns3/lr-wpan-packet-event-log.h>
  #include <ns3/lr-wpan-priority-tag.h>
+ #include <ns3/lr-wpan-process-pool.h>
+ #include <ns3/lr-wpan-profiler.h>
  #include <ns3/lr-wpan-retransmission-tag.h>
+ #include <ns3/lr-wpan-steady-state-controller.h>
+ #include <ns3/lr-wpan-superframe-monitor.h>
+ #include <ns3/lr-wpan-traffic-generator.h>
  #include <ns3/multi-model-spectrum-channel.h>
  #include <ns3/packet.h>
  #include <ns3/propagation-delay-model.h>
@@ -25,9 +33,18 @@
  #include <ns3/single-model-spectrum-channel.h>
 
  #include <fstream>
+ #include <functional>
+ #include <iomanip>
  #include <iostream>
+ #include <limits>
+ #include <memory>
+ #include <set>
+ #include <sstream>
+ #include <string>
+ #include <utility>
+ #include <vector>
 
- #include <numeric>
+ #include <unistd.h>
 
 
  #define CSMA_CA_BEB 0
@@ -45,6 +62,22 @@ int SIM_TIME = 3600 + 30;
 int ncount = 9;
 
 int BEACON_ORDER = 4;
+int RESULT_FD = -1;
+bool WRITE_FILES = true;
+bool PRINT_CONFIG = false;
+std::string EVENT_LOG = "";
+std::string SUPERFRAME_LOG = "";
+bool STEADY_STATE = false;
+double SS_HALF_WIDTH = 0.01;
+bool PROFILE = false;
+uint32_t PROFILE_TOP = 20;
+std::string TRAFFIC = "beacon";
+double TRAFFIC_RATE = 1.0;
+double TRAFFIC_JITTER = 0.0;
+std::string TRAFFIC_TRACE = "";
+bool MODEL = false;
+bool CAPTURE = false;
+bool AUTO_ACK = false;
 
 using namespace ns3;
 using namespace ns3::lrwpan;
@@ -54,6 +87,7 @@ static std::vector<int> NODE_COUNT_PER_TP;
 
 static uint32_t NODE_COUNT;
 
+ static std::vector<LrWpanCsmaCaModel::TpEstimate> modelEstimates; // --model
  static uint32_t requestTX[TP_COUNT];
  static uint32_t sentTX[TP_COUNT];
  static uint32_t successTX[TP_COUNT];
@@ -65,16 +99,24 @@ static uint32_t NODE_COUNT;
 
  static uint32_t dynamicFailure[TP_COUNT];
 
+ static uint32_t captures[3]; // --capture, per PhyCaptureOutcome
+
  // static uint32_t txEnqueue[TP_COUNT];
  static uint32_t txDequeue[TP_COUNT];
 
  static std::vector<std::vector<uint32_t>> retransmissionCount;
 
- static std::vector<double> rxDelay[TP_COUNT];
+ // per-TP delivery delay (ms), constant memory whatever the number of packets
+ static LrWpanLatencyHistogram rxDelay[TP_COUNT];
 
 static NodeContainer nodes;
 static NetDeviceContainer devices;
 
+ static std::unique_ptr<LrWpanPacketEventLog> eventLog;
+ static LrWpanSuperframeMonitor superframeMonitor;
+ static LrWpanSteadyStateController steadyState;
+ static Ptr<LrWpanTrafficGenerator> traffic;
+
  void
  progress()
  {
@@ -143,6 +185,13 @@ std::vector<int> fillArray(int n)
      failRX[TP]++;
  }
 
+ void
+ PhyRxCapture(Ptr<const Packet> current, Ptr<const Packet> late, PhyCaptureOutcome outcome)
+ {
+     // count: overlapping frames resolved by the capture model
+     captures[outcome]++;
+ }
+
  void
  MacRx(Ptr<const Packet> p, uint8_t TP) // MacRx: success RX
  {
@@ -165,7 +214,7 @@ std::vector<int> fillArray(int n)
      double delay = current - issuedTime;
      // std::cout << "DELAY: " << (double) delay << std::endl;
 
-     rxDelay[senderTP].push_back(delay);
+     rxDelay[senderTP].Record(delay);
  }
 
  void
@@ -214,6 +263,157 @@ std::vector<int> fillArray(int n)
      txDequeue[TP]++;
  }
 
+ /**
+  * Options that only select outputs, left out of PrintConfiguration.
+  */
+ static const std::set<std::string> OUTPUT_OPTIONS = {"resultFd",
+                                                      "writeFiles",
+                                                      "printConfig",
+                                                      "eventLog",
+                                                      "superframeLog",
+                                                      "profile",
+                                                      "profileTop"};
+
+ /// The other command line values, by name, as printed by PrintConfiguration
+ static std::vector<std::pair<std::string, std::function<std::string()>>> configValues;
+
+ /**
+  * Add a command line value, recorded for PrintConfiguration unless it is in
+  * OUTPUT_OPTIONS.
+  *
+  * \param cmd the command line
+  * \param name the option name
+  * \param help the help text
+  * \param value the variable set by the option
+  */
+ template <typename T>
+ void
+ AddValue(CommandLine& cmd, const std::string& name, const std::string& help, T& value)
+ {
+     cmd.AddValue(name, help, value);
+     if (OUTPUT_OPTIONS.count(name) == 0)
+     {
+         configValues.emplace_back(name, [&value]() {
+             std::ostringstream oss;
+             oss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+             return oss.str();
+         });
+     }
+ }
+
+ void
+ PrintConfiguration(std::ostream& os)
+ {
+     // Everything that determines the results of a run, used by
+     // LrWpanSweepHelper to identify cached sweep points: every command line
+     // value but the output options, the trace replayed, the attributes set
+     // from their defaults (--ns3::...) and the global values (seed, run,
+     // scheduler).
+     for (const auto& [name, value] : configValues)
+     {
+         os << name << " " << value() << std::endl;
+     }
+     if (!TRAFFIC_TRACE.empty())
+     {
+         std::ifstream trace(TRAFFIC_TRACE, std::ios::binary);
+         std::ostringstream contents;
+         contents << trace.rdbuf();
+         os << "trafficTraceHash " << (trace ? std::to_string(Hash64(contents.str())) : "none")
+            << std::endl;
+     }
+     for (uint16_t i = 0; i < TypeId::GetRegisteredN(); i++)
+     {
+         TypeId tid = TypeId::GetRegistered(i);
+         for (std::size_t j = 0; j < tid.GetAttributeN(); j++)
+         {
+             TypeId::AttributeInformation info = tid.GetAttribute(j);
+             std::string value = info.initialValue->SerializeToString(info.checker);
+             if (value != info.originalInitialValue->SerializeToString(info.checker))
+             {
+                 os << "attribute " << tid.GetName() << "::" << info.name << " " << value
+                    << std::endl;
+             }
+         }
+     }
+     for (auto i = GlobalValue::Begin(); i != GlobalValue::End(); i++)
+     {
+         StringValue value;
+         (*i)->GetValue(value);
+         os << "global " << (*i)->GetName() << " " << value.Get() << std::endl;
+     }
+     os << "NODE_COUNT_PER_TP";
+     for (auto n : NODE_COUNT_PER_TP)
+     {
+         os << " " << n;
+     }
+     os << std::endl;
+
+     switch (CSMA_CA)
+     {
+     case CSMA_CA_NOBA:
+         LrWpanCsmaCaNoba::PrintConfiguration(os);
+         break;
+     case CSMA_CA_SW_NOBA:
+         LrWpanCsmaCaSwNoba::PrintConfiguration(os);
+         break;
+     case CSMA_CA_STANDARD:
+         LrWpanCsmaCaStandard::PrintConfiguration(os);
+         break;
+     case CSMA_CA_GNU_NOBA:
+         LrWpanCsmaCaGnuNoba::PrintConfiguration(os);
+         break;
+     default:
+         break;
+     }
+ }
+
+ void
+ WriteResults(int fd)
+ {
+     // per-TP counters as "name value" records, read by LrWpanReplicationHelper
+     LrWpanProcessPool::Records records;
+     for (int i = 0; i < TP_COUNT; i++)
+     {
+         std::string tp = ".tp" + std::to_string(i);
+         records.emplace_back("enqueuedTx" + tp, requestTX[i]);
+         records.emplace_back("dequeuedTx" + tp, txDequeue[i]);
+         records.emplace_back("successTx" + tp, successTX[i]);
+         records.emplace_back("failedTx" + tp, failTX[i]);
+         records.emplace_back("dynamicFailure" + tp, dynamicFailure[i]);
+         records.emplace_back("successRx" + tp, successRX[i]);
+         records.emplace_back("collisions" + tp, collisions[i]);
+         records.emplace_back("macTx" + tp, sentTX[i]);
+         if (rxDelay[i].GetCount() > 0)
+         {
+             records.emplace_back("minDelay" + tp, rxDelay[i].GetMin());
+             records.emplace_back("avgDelay" + tp, rxDelay[i].GetMean());
+             records.emplace_back("p50Delay" + tp, rxDelay[i].GetQuantile(0.5));
+             records.emplace_back("p90Delay" + tp, rxDelay[i].GetQuantile(0.9));
+             records.emplace_back("p99Delay" + tp, rxDelay[i].GetQuantile(0.99));
+             records.emplace_back("p999Delay" + tp, rxDelay[i].GetQuantile(0.999));
+             records.emplace_back("maxDelay" + tp, rxDelay[i].GetMax());
+         }
+     }
+     if (CAPTURE)
+     {
+         records.emplace_back("captureNone", captures[PHY_CAPTURE_NONE]);
+         records.emplace_back("captureFirst", captures[PHY_CAPTURE_FIRST]);
+         records.emplace_back("captureResync", captures[PHY_CAPTURE_RESYNC]);
+     }
+     if (STEADY_STATE)
+     {
+         records.emplace_back("simTime", SIM_TIME);
+         for (const auto& e : steadyState.GetEstimates())
+         {
+             records.emplace_back("ssMean." + e.name, e.mean);
+             records.emplace_back("ssHalfWidth." + e.name, e.halfWidth);
+             records.emplace_back("ssWarmup." + e.name, e.warmup);
+         }
+     }
+     LrWpanProcessPool::WriteRecords(fd, records);
+     close(fd);
+ }
+
  void
  GenerateTraffic(SequenceNumber8 macBsn)
  {
@@ -262,12 +462,28 @@ std::vector<int> fillArray(int n)
  {
      CommandLine cmd;
 
-     cmd.AddValue("csmaCa", "CSMA-CA algorithm (0: BEB, 1: NOBA, 2: SW_NOBA, 3: STANDARD, 4: GNU_NOBA)", CSMA_CA);
-     cmd.AddValue("packetSize", "Size of the packet", PACKET_SIZE);
-     cmd.AddValue("maxRetx", "Maximum number of retransmissions", MAX_RETX);
-     // cmd.AddValue("beaconOrder", "Beacon order value", BEACON_ORDER);
-     cmd.AddValue("simTime", "Simulation time (in seconds)", SIM_TIME);
-     cmd.AddValue("ncount", "node count", ncount);
+     AddValue(cmd, "csmaCa", "CSMA-CA algorithm (0: BEB, 1: NOBA, 2: SW_NOBA, 3: STANDARD, 4: GNU_NOBA)", CSMA_CA);
+     AddValue(cmd, "packetSize", "Size of the packet", PACKET_SIZE);
+     AddValue(cmd, "maxRetx", "Maximum number of retransmissions", MAX_RETX);
+     AddValue(cmd, "beaconOrder", "Beacon order value", BEACON_ORDER);
+     AddValue(cmd, "simTime", "Simulation time (in seconds)", SIM_TIME);
+     AddValue(cmd, "ncount", "node count", ncount);
+     AddValue(cmd, "resultFd", "File descriptor receiving per-TP result records (-1: none)", RESULT_FD);
+     AddValue(cmd, "writeFiles", "Write the .txt/.csv result files", WRITE_FILES);
+     AddValue(cmd, "printConfig", "Print the full configuration and exit", PRINT_CONFIG);
+     AddValue(cmd, "eventLog", "Binary per-packet event log file (empty: none)", EVENT_LOG);
+     AddValue(cmd, "superframeLog", "Binary per-superframe metrics file (empty: none)", SUPERFRAME_LOG);
+     AddValue(cmd, "steadyState", "Stop once the per-TP success ratios reach steady state", STEADY_STATE);
+     AddValue(cmd, "ssHalfWidth", "Target 95% CI half width of the steady-state success ratios", SS_HALF_WIDTH);
+     AddValue(cmd, "profile", "Profile the LR-WPAN handlers and print a report at exit", PROFILE);
+     AddValue(cmd, "profileTop", "Number of handlers listed in the profile report", PROFILE_TOP);
+     AddValue(cmd, "traffic", "Traffic source: beacon (one packet per node per beacon), poisson, periodic, onoff or trace", TRAFFIC);
+     AddValue(cmd, "trafficRate", "Packets per second per node (onoff: in the on state)", TRAFFIC_RATE);
+     AddValue(cmd, "trafficJitter", "Maximum jitter of the periodic traffic (s)", TRAFFIC_JITTER);
+     AddValue(cmd, "trafficTrace", "CSV trace of the trace traffic (time,node,size)", TRAFFIC_TRACE);
+     AddValue(cmd, "model", "Print the analytical estimate of LrWpanCsmaCaModel next to the results", MODEL);
+     AddValue(cmd, "capture", "Resolve overlapping frames with the SINR capture model of the PHY", CAPTURE);
+     AddValue(cmd, "autoAck", "Send the ACKs from the PHY, with fewer events and the same timing", AUTO_ACK);
 
      cmd.Parse(argc, argv);
 
@@ -282,10 +498,55 @@ std::vector<int> fillArray(int n)
      Callback<void, SequenceNumber8> cb;
      ns3::RngSeedManager::SetSeed(42);
 
+     if (PRINT_CONFIG)
+     {
+         if (RESULT_FD >= 0)
+         {
+             std::ostringstream oss;
+             PrintConfiguration(oss);
+             std::string config = oss.str();
+             ssize_t written [[maybe_unused]] = write(RESULT_FD, config.data(), config.size());
+             close(RESULT_FD);
+         }
+         else
+         {
+             PrintConfiguration(std::cout);
+         }
+         return 0;
+     }
+
+     if (PROFILE)
+     {
+         // before the simulator is created, to select the profiling implementation
+         LrWpanProfiler::Enable();
+     }
+
      SetupLogComponents();
 
+     // before the engines are created, Configure() resets the NOBA windows
+     if (MODEL)
+     {
+         LrWpanCsmaCaModel model;
+         model.Configure(static_cast<CsmaOption>(CSMA_CA));
+         model.SetSuperframe(BEACON_ORDER, BEACON_ORDER);
+         model.SetPayloadSize(PACKET_SIZE);
+         model.SetMaxFrameRetries(MAX_RETX);
+         // beacon traffic: one packet per node per beacon interval
+         double load = TRAFFIC == "beacon"
+                           ? 1.0 / (aBaseSuperframeDuration * (1 << BEACON_ORDER) / 62500.0)
+                           : TRAFFIC_RATE;
+         for (int i = 0; i < TP_COUNT; i++)
+         {
+             model.SetTraffic(i, NODE_COUNT_PER_TP[i], load);
+         }
+         modelEstimates = model.Estimate();
+     }
+
      // LrWpanHelper lrWpanHelper;
 
+     Config::SetDefault("ns3::lrwpan::LrWpanPhy::CaptureEnabled", BooleanValue(CAPTURE));
+     Config::SetDefault("ns3::lrwpan::LrWpanMac::AutoAck", BooleanValue(AUTO_ACK));
+
      ////////////////////////////// 1. SETUP HELPER //////////////////////////////
      Ptr<SingleModelSpectrumChannel> channel = Create<SingleModelSpectrumChannel>();
      Ptr<LogDistancePropagationLossModel> lossModel = Create<LogDistancePropagationLossModel>();
@@ -415,13 +676,18 @@ std::vector<int> fillArray(int n)
                                             &LrWpanMacBase::MlmeStartRequest,
                                             dev->GetMac(),
                                             params);
-             cb = MakeCallback(&GenerateTraffic);
-             dev->GetMac()->TraceConnectWithoutContext("BeaconStart",
-                                                   cb); // received RX(DATA ONLY)
+             if (TRAFFIC == "beacon")
+             {
+                 cb = MakeCallback(&GenerateTraffic);
+                 dev->GetMac()->TraceConnectWithoutContext("BeaconStart",
+                                                       cb); // received RX(DATA ONLY)
+             }
          }
 
          dev->GetPhy()->TraceConnectWithoutContext("PhyRxDrop",
                                                    MakeCallback(&PhyRxDrop)); // dropped RX
+         dev->GetPhy()->TraceConnectWithoutContext("PhyRxCapture",
+                                                   MakeCallback(&PhyRxCapture)); // overlaps
          dev->GetMac()->TraceConnectWithoutContext("MacRx",
                                                    MakeCallback(&MacRx)); // received RX(DATA ONLY)
          dev->GetMac()->TraceConnectWithoutContext("MacTxEnqueue",
@@ -496,7 +762,95 @@ std::vector<int> fillArray(int n)
          }
      }
 
+     if (!EVENT_LOG.empty())
+     {
+         eventLog = std::make_unique<LrWpanPacketEventLog>(EVENT_LOG);
+         eventLog->Install(devices);
+     }
+     if (!SUPERFRAME_LOG.empty())
+     {
+         superframeMonitor.AddSink(Create<LrWpanSuperframeFileSink>(SUPERFRAME_LOG));
+     }
+     if (STEADY_STATE)
+     {
+         // per-superframe success ratio of every populated TP
+         for (int tp = 0; tp < TP_COUNT; tp++)
+         {
+             if (NODE_COUNT_PER_TP[tp] == 0)
+             {
+                 continue;
+             }
+             steadyState.AddMetric(
+                 "successRatio.tp" + std::to_string(tp),
+                 LrWpanSteadyStateController::Metric([tp](const LrWpanSuperframeRecord& r) {
+                     return r.enqueued[tp] ? static_cast<double>(r.success[tp]) / r.enqueued[tp]
+                                           : std::nan("");
+                 }));
+         }
+         steadyState.SetTargetHalfWidth(SS_HALF_WIDTH);
+         superframeMonitor.AddSink(steadyState.GetSink());
+     }
+     if (!SUPERFRAME_LOG.empty() || STEADY_STATE)
+     {
+         superframeMonitor.Install(DynamicCast<LrWpanNetDevice>(devices.Get(0)), devices);
+     }
+
      ////////////////////////////// 5. DATA TRANSMISSION //////////////////////////////
+     if (TRAFFIC != "beacon")
+     {
+         traffic = CreateObject<LrWpanTrafficGenerator>();
+         traffic->SetAttribute("PacketSize", UintegerValue(PACKET_SIZE));
+         traffic->SetAttribute("PanId", UintegerValue(PAN_ID));
+         traffic->SetAttribute("Destination", Mac16AddressValue(Mac16Address(COORD_ADDR)));
+
+         NetDeviceContainer endDevices;
+         for (auto i = devices.Begin() + 1; i < devices.End(); i++)
+         {
+             endDevices.Add(*i);
+         }
+
+         if (TRAFFIC == "trace")
+         {
+             traffic->InstallTrace(endDevices, TRAFFIC_TRACE);
+         }
+         else
+         {
+             for (int tp = 0; tp < TP_COUNT; tp++)
+             {
+                 if (TRAFFIC == "poisson")
+                 {
+                     traffic->SetSource(tp,
+                                        "ns3::lrwpan::LrWpanPoissonTrafficSource",
+                                        "Rate", DoubleValue(TRAFFIC_RATE));
+                 }
+                 else if (TRAFFIC == "periodic")
+                 {
+                     traffic->SetSource(tp,
+                                        "ns3::lrwpan::LrWpanPeriodicTrafficSource",
+                                        "Period", TimeValue(Seconds(1.0 / TRAFFIC_RATE)),
+                                        "Jitter", TimeValue(Seconds(TRAFFIC_JITTER)),
+                                        "RandomPhase", BooleanValue(true));
+                 }
+                 else if (TRAFFIC == "onoff")
+                 {
+                     traffic->SetSource(tp,
+                                        "ns3::lrwpan::LrWpanOnOffTrafficSource",
+                                        "Rate", DoubleValue(TRAFFIC_RATE));
+                 }
+                 else
+                 {
+                     NS_ABORT_MSG("Unknown traffic " << TRAFFIC);
+                 }
+             }
+             for (auto i = endDevices.Begin(); i < endDevices.End(); i++)
+             {
+                 traffic->Install(DynamicCast<LrWpanNetDevice>(*i));
+             }
+         }
+         traffic->Start(Seconds(0.01));
+         traffic->Stop(Seconds(SIM_TIME));
+     }
+
      // Simulator::Schedule(Seconds(0), &GenerateTraffic, devices, INTERVAL);
 
      Simulator::Schedule(
@@ -511,10 +865,8 @@ std::vector<int> fillArray(int n)
     );
 
 
-     Simulator::Schedule(
-         Seconds(SIM_TIME + 30 - 0.00001),
-         MakeEvent(
-             [] () mutable -> void
+     auto report =
+             [] () -> void
              {
                  std::string str;
                  std::cout << std::endl << std::endl << std::endl;
@@ -550,7 +902,11 @@ std::vector<int> fillArray(int n)
                                 << "_retx" << MAX_RETX
                                 << "_bo" << BEACON_ORDER << ".txt";
                  std::string filename = filenameStream.str();
-                 std::ofstream outFile(filename);
+                 std::ofstream outFile;
+                 if (WRITE_FILES)
+                 {
+                     outFile.open(filename);
+                 }
                  std::ostream& out = outFile;  // 또는 std::cout 으로 쉽게 전환 가능
 
                  switch (CSMA_CA)
@@ -655,6 +1011,16 @@ std::vector<int> fillArray(int n)
                      std::cout << collisions[i] << "\t";
                      out << collisions[i] << "\t";
                  }
+                 if (CAPTURE)
+                 {
+                     // overlapping frames at the receivers: both lost, first kept, late kept
+                     std::cout << "\nCAPTURES N/F/R\t\t" << captures[PHY_CAPTURE_NONE] << "\t"
+                               << captures[PHY_CAPTURE_FIRST] << "\t"
+                               << captures[PHY_CAPTURE_RESYNC] << "\t";
+                     out << "\nCAPTURES N/F/R\t\t" << captures[PHY_CAPTURE_NONE] << "\t"
+                         << captures[PHY_CAPTURE_FIRST] << "\t" << captures[PHY_CAPTURE_RESYNC]
+                         << "\t";
+                 }
                  std::cout << "\nMAX DELAYS\t\t";
                  out << "\nMAX DELAYS\t\t";
                  for(int i = 0; i < TP_COUNT; i++)
@@ -665,8 +1031,8 @@ std::vector<int> fillArray(int n)
                          out << 0 << "\t";
                          continue;
                      }
-                     std::cout << *std::max_element(rxDelay[i].begin(), rxDelay[i].end()) << "\t";
-                     out << *std::max_element(rxDelay[i].begin(), rxDelay[i].end()) << "\t";
+                     std::cout << rxDelay[i].GetMax() << "\t";
+                     out << rxDelay[i].GetMax() << "\t";
                  }
                  std::cout << "\nAVG DELAYS\t\t";
                  out << "\nAVG DELAYS\t\t";
@@ -678,12 +1044,15 @@ std::vector<int> fillArray(int n)
                          out << 0 << "\t";
                          continue;
                      }
-                     std::cout
-                         << std::accumulate(rxDelay[i].begin(), rxDelay[i].end(), 0) / rxDelay[i].size()
-                         << "\t";
-                     out
-                         << std::accumulate(rxDelay[i].begin(), rxDelay[i].end(), 0) / rxDelay[i].size()
-                         << "\t";
+                     std::cout << rxDelay[i].GetMean() << "\t";
+                     out << rxDelay[i].GetMean() << "\t";
+                 }
+                 std::cout << "\nP99 DELAYS\t\t";
+                 out << "\nP99 DELAYS\t\t";
+                 for(int i = 0; i < TP_COUNT; i++)
+                 {
+                     std::cout << rxDelay[i].GetQuantile(0.99) << "\t";
+                     out << rxDelay[i].GetQuantile(0.99) << "\t";
                  }
                  std::cout << "\nMAC TX COUNTS\t\t";
                  out << "\nMAC TX COUNTS\t\t";
@@ -723,20 +1092,92 @@ std::vector<int> fillArray(int n)
                               << "_sim" << SIM_TIME
                               << "_retx" << MAX_RETX
                               << "_bo" << BEACON_ORDER << ".csv";
-                std::ofstream ou(filenameStream2.str());
+                std::ofstream ou;
+                if (WRITE_FILES)
+                {
+                    ou.open(filenameStream2.str());
+                }
                 std::ostream& out2 = ou;
+                 // per-TP delay distribution (ms), see LrWpanLatencyHistogram
+                 out2 << "TP, count, min, mean, p50, p90, p99, p99.9, max" << std::endl;
                  for(int i = 0; i < TP_COUNT; i++)
                  {
-                     out2 << "TP" << i << ", ";
-                     for (auto k = rxDelay[i].begin(); k != rxDelay[i].end(); k++)
+                     out2 << "TP" << i << ", " << rxDelay[i].GetCount() << ", "
+                          << rxDelay[i].GetMin() << ", " << rxDelay[i].GetMean() << ", "
+                          << rxDelay[i].GetQuantile(0.5) << ", " << rxDelay[i].GetQuantile(0.9)
+                          << ", " << rxDelay[i].GetQuantile(0.99) << ", "
+                          << rxDelay[i].GetQuantile(0.999) << ", " << rxDelay[i].GetMax()
+                          << std::endl;
+                 }
+
+                 // full histograms, which can be merged across replications
+                 std::ofstream hist;
+                 if (WRITE_FILES)
+                 {
+                     std::string histFilename = filenameStream2.str();
+                     hist.open(histFilename.replace(histFilename.size() - 4, 4, ".hist"));
+                 }
+                 for(int i = 0; i < TP_COUNT; i++)
+                 {
+                     rxDelay[i].Write(hist);
+                 }
+
+                 if (STEADY_STATE)
+                 {
+                     std::cout << "\nSTEADY STATE (" << (steadyState.IsConverged() ? "converged" : "not converged")
+                               << ", warm-up excluded)" << std::endl;
+                     for (const auto& e : steadyState.GetEstimates())
+                     {
+                         std::cout << e.name << "\t" << e.mean << " +/- " << e.halfWidth
+                                   << "\t(warm-up: " << e.warmup << " samples)" << std::endl;
+                     }
+                 }
+
+                 if (MODEL)
+                 {
+                     std::cout << "\nMODEL (analytical estimate / simulated)" << std::endl;
+                     std::cout << "TP\tsuccess\t\t\tdelay (ms)" << std::endl;
+                     for (int i = 0; i < TP_COUNT; i++)
                      {
-                         out2 << static_cast<double>(*k) << ", ";
+                         if (NODE_COUNT_PER_TP[i] == 0)
+                         {
+                             continue;
+                         }
+                         const auto& e = modelEstimates[i];
+                         std::cout << i << "\t" << e.success << " / "
+                                   << (requestTX[i] > 0 ? double(successTX[i]) / requestTX[i] : 0)
+                                   << "\t" << e.delay << " / " << rxDelay[i].GetMean()
+                                   << (e.saturated ? "\t(saturated)" : "") << std::endl;
                      }
-                     out2 << std::endl;
                  }
+
+                 if (RESULT_FD >= 0)
+                 {
+                     WriteResults(RESULT_FD);
+                 }
+             };
+     EventId reportEvent = Simulator::Schedule(Seconds(SIM_TIME + 30 - 0.00001), MakeEvent(report));
+
+     if (STEADY_STATE)
+     {
+         steadyState.SetConvergedCallback(Callback<void>(
+             [cb, report, reportEvent] () mutable -> void
+             {
+                 // stop the traffic, let the queues drain, then report as at the end of a full run
+                 NS_LOG_UNCOND("STEADY STATE REACHED AT " << Simulator::Now().As(Time::S));
+                 DynamicCast<LrWpanNetDevice>(devices.Get(0))->GetMac()
+                        ->TraceDisconnectWithoutContext("BeaconStart", cb);
+                 if (traffic)
+                 {
+                     traffic->Stop(Simulator::Now());
+                 }
+                 SIM_TIME = static_cast<int>(std::ceil(Simulator::Now().GetSeconds()));
+                 Simulator::Cancel(reportEvent);
+                 Simulator::Schedule(Seconds(30 - 0.00001), MakeEvent(report));
+                 Simulator::Stop(Seconds(30));
              }
-         )
-     );
+         ));
+     }
 
 
      Simulator::Schedule(
@@ -766,6 +1207,17 @@ std::vector<int> fillArray(int n)
      Simulator::Stop(Seconds(SIM_TIME + 30));
      Simulator::Run();
 
+     if (eventLog)
+     {
+         eventLog->Close();
+         std::cout << "EVENT LOG: " << eventLog->GetRecordCount() << " packets" << std::endl;
+     }
+
+     if (PROFILE)
+     {
+         LrWpanProfiler::Report(std::cout, PROFILE_TOP);
+     }
+
      Simulator::Destroy();
      return 0;
  }
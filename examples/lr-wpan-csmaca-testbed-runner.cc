@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * Runs independent replications of lr-wpan-csmaca-testbed-example on a pool of
+ * worker processes, one RngRun value per replication, and reports the mean and
+ * 95% confidence interval of every per-TP counter.
+ *
+ * Example:
+ *   ./ns3 run "lr-wpan-csmaca-testbed-runner --replications=64 --workers=64
+ *              --args='--csmaCa=4 --ncount=9 --simTime=600'"
+ *
+ * Outputs:
+ *   <prefix>_replications.csv  one row per replication
+ *   <prefix>_summary.csv       mean, stddev and 95% CI per metric
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-replication-helper.h>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LrWpanCsmaCaTestbedRunner");
+
+/**
+ * Locate the testbed binary next to this runner.
+ *
+ * \param self argv[0] of the runner
+ * \return the path of the testbed example
+ */
+static std::string
+DefaultProgram(std::string self)
+{
+    const std::string runner = "lr-wpan-csmaca-testbed-runner";
+    auto pos = self.rfind(runner);
+    if (pos == std::string::npos)
+    {
+        return "";
+    }
+    return self.replace(pos, runner.size(), "lr-wpan-csmaca-testbed-example");
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t replications = 10;
+    uint32_t firstRun = 1;
+    uint32_t workers = 0;
+    std::string program = DefaultProgram(argv[0]);
+    std::string args;
+    std::string prefix = "testbed";
+    bool verbose = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("replications", "Number of replications", replications);
+    cmd.AddValue("firstRun", "RngRun value of the first replication", firstRun);
+    cmd.AddValue("workers", "Maximum number of concurrent workers (0: one per CPU)", workers);
+    cmd.AddValue("program", "Path of the testbed binary", program);
+    cmd.AddValue("args", "Space separated arguments passed to every replication", args);
+    cmd.AddValue("prefix", "Prefix of the output files", prefix);
+    cmd.AddValue("verbose", "Show the output of the replications", verbose);
+    cmd.Parse(argc, argv);
+
+    if (program.empty())
+    {
+        NS_FATAL_ERROR("Cannot locate the testbed binary, use --program");
+    }
+
+    std::vector<std::string> programArgs;
+    std::istringstream iss(args);
+    std::string arg;
+    while (iss >> arg)
+    {
+        programArgs.push_back(arg);
+    }
+    // Replications only report through the result pipe.
+    programArgs.push_back("--writeFiles=false");
+
+    LrWpanReplicationHelper helper;
+    helper.SetProgram(program);
+    helper.SetArguments(programArgs);
+    helper.SetMaxWorkers(workers);
+    helper.SetQuiet(!verbose);
+
+    std::vector<LrWpanReplicationHelper::Replication> results =
+        helper.Run(firstRun, replications);
+
+    uint32_t failed = 0;
+    for (const auto& rep : results)
+    {
+        if (rep.status != 0)
+        {
+            std::cerr << "Replication with RngRun=" << rep.run << " failed (status "
+                      << rep.status << ")" << std::endl;
+            failed++;
+        }
+    }
+
+    std::vector<LrWpanReplicationHelper::Summary> summaries =
+        LrWpanReplicationHelper::Summarize(results);
+
+    std::ofstream repFile(prefix + "_replications.csv");
+    LrWpanReplicationHelper::WriteReplications(repFile, results);
+    std::ofstream sumFile(prefix + "_summary.csv");
+    LrWpanReplicationHelper::WriteSummary(sumFile, summaries);
+
+    std::cout << "REPLICATIONS: " << replications - failed << "/" << replications << std::endl;
+    std::cout << std::left << std::setw(24) << "METRIC" << std::setw(16) << "MEAN"
+              << "95% CI" << std::endl;
+    for (const auto& s : summaries)
+    {
+        std::cout << std::left << std::setw(24) << s.name << std::setw(16) << s.mean << "+/- "
+                  << s.ciHalfWidth << std::endl;
+    }
+
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * Runs every point of a parameter grid of lr-wpan-csmaca-testbed-example on a
+ * pool of worker processes. Results are stored by configuration hash, so a
+ * sweep can be interrupted and resumed, or its grid extended, without
+ * simulating a point twice.
+ *
+ * Grid file example:
+ *   csmaCa = 1 2 3 4
+ *   ncount = 1..9
+ *   RngRun = 1..10
+ *
+ *   ./ns3 run "lr-wpan-csmaca-testbed-sweep --grid=grid.txt --args='--simTime=600'"
+ *
+ * Outputs:
+ *   <store>/<hash>.rec  "name value" result records of one point
+ *   <store>/<hash>.cfg  the configuration of the point
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-sweep-helper.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LrWpanCsmaCaTestbedSweep");
+
+/**
+ * Locate the testbed binary next to this program.
+ *
+ * \param self argv[0] of the sweep
+ * \return the path of the testbed example
+ */
+static std::string
+DefaultProgram(std::string self)
+{
+    const std::string sweep = "lr-wpan-csmaca-testbed-sweep";
+    auto pos = self.rfind(sweep);
+    if (pos == std::string::npos)
+    {
+        return "";
+    }
+    return self.replace(pos, sweep.size(), "lr-wpan-csmaca-testbed-example");
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string grid;
+    std::string store = "sweep-results";
+    uint32_t workers = 0;
+    std::string program = DefaultProgram(argv[0]);
+    std::string args;
+    std::string costParameter = "ncount";
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("grid", "Grid file, one \"name = values\" line per parameter", grid);
+    cmd.AddValue("store", "Result store directory", store);
+    cmd.AddValue("workers", "Maximum number of concurrent workers (0: one per CPU)", workers);
+    cmd.AddValue("program", "Path of the testbed binary", program);
+    cmd.AddValue("args", "Space separated arguments passed to every point", args);
+    cmd.AddValue("costParameter", "Parameter whose largest values run first", costParameter);
+    cmd.Parse(argc, argv);
+
+    if (program.empty())
+    {
+        NS_FATAL_ERROR("Cannot locate the testbed binary, use --program");
+    }
+
+    std::ifstream gridFile(grid);
+    if (!gridFile)
+    {
+        NS_FATAL_ERROR("Cannot open the grid file \"" << grid << "\", use --grid");
+    }
+
+    std::vector<std::string> programArgs;
+    std::istringstream iss(args);
+    std::string arg;
+    while (iss >> arg)
+    {
+        programArgs.push_back(arg);
+    }
+    // Points only report through the result pipe.
+    programArgs.push_back("--writeFiles=false");
+
+    LrWpanSweepHelper helper;
+    helper.SetProgram(program);
+    helper.SetArguments(programArgs);
+    helper.SetStore(store);
+    helper.SetMaxWorkers(workers);
+    helper.SetCostParameter(costParameter);
+    helper.LoadGrid(gridFile);
+
+    LrWpanSweepHelper::Stats stats = helper.Run();
+
+    std::cout << "POINTS: " << stats.points << std::endl;
+    std::cout << "CACHED: " << stats.cached << std::endl;
+    std::cout << "SIMULATED: " << stats.done << std::endl;
+    std::cout << "FAILED: " << stats.failed << std::endl;
+
+    return stats.failed == 0 ? 0 : 1;
+}
@@ -20,9 +20,15 @@
     Node1                       Node2
    (dev0) --------------------->(dev1)
 
+   The distances are independent simulations, run in parallel worker processes
+   by a LrWpanPerSweepHelper, each with its own RngRun. The sweep starts every
+   --step meters and refines, down to 1 m, where the PSR of neighbouring
+   distances differs by more than --threshold.
+
    Usage:
 
    ./ns3 run "lr-wpan-error-distance-plot --txPower= 0 --rxSensitivity=-92"
+   ./ns3 run "lr-wpan-error-distance-plot --step=1 --workers=8"
 
 */
 #include <ns3/abort.h>
@@ -34,6 +40,7 @@
 #include <ns3/lr-wpan-error-model.h>
 #include <ns3/lr-wpan-mac.h>
 #include <ns3/lr-wpan-net-device.h>
+#include <ns3/lr-wpan-per-sweep-helper.h>
 #include <ns3/lr-wpan-spectrum-value-helper.h>
 #include <ns3/mac16-address.h>
 #include <ns3/multi-model-spectrum-channel.h>
@@ -71,36 +78,24 @@ LrWpanErrorDistanceCallback(McpsDataIndicationParams params, Ptr<Packet> p)
     g_packetsReceived++;
 }
 
-int
-main(int argc, char* argv[])
+/**
+ * Transmit frames at a fixed distance. Runs in a worker process of the sweep.
+ * \param distance the distance between the devices (m)
+ * \param maxPackets the frames transmitted
+ * \param packetSize the MSDU size (bytes)
+ * \param txPower the transmit power (dBm)
+ * \param channelNumber the channel number
+ * \param rxSensitivity the Rx sensitivity of the receiver (dBm)
+ * \return the packet success rate, in [0, 1]
+ */
+double
+SimulatePsr(double distance,
+            int maxPackets,
+            int packetSize,
+            double txPower,
+            uint32_t channelNumber,
+            double rxSensitivity)
 {
-    std::ostringstream os;
-    std::ofstream berfile("802.15.4-psr-distance.plt");
-
-    int minDistance = 1;
-    int maxDistance = 200; // meters
-    int increment = 1;
-    int maxPackets = 1000;
-    int packetSize = 7; // PSDU = 20 bytes (11 bytes MAC header + 7 bytes MSDU )
-    double txPower = 0;
-    uint32_t channelNumber = 11;
-    double rxSensitivity = -106.58; // dBm
-
-    CommandLine cmd(__FILE__);
-
-    cmd.AddValue("txPower", "transmit power (dBm)", txPower);
-    cmd.AddValue("packetSize", "packet (MSDU) size (bytes)", packetSize);
-    cmd.AddValue("channelNumber", "channel number", channelNumber);
-    cmd.AddValue("rxSensitivity", "the rx sensitivity (dBm)", rxSensitivity);
-
-    cmd.Parse(argc, argv);
-
-    os << "Packet (MSDU) size = " << packetSize << " bytes; tx power = " << txPower
-       << " dBm; channel = " << channelNumber << "; Rx sensitivity = " << rxSensitivity << " dBm";
-
-    Gnuplot psrplot = Gnuplot("802.15.4-psr-distance.eps");
-    Gnuplot2dDataset psrdataset("802.15.4-psr-vs-distance");
-
     Ptr<Node> n0 = CreateObject<Node>();
     Ptr<Node> n1 = CreateObject<Node>();
     Ptr<LrWpanNetDevice> dev0 = CreateObject<LrWpanNetDevice>();
@@ -140,20 +135,69 @@ main(int argc, char* argv[])
 
     Ptr<Packet> p;
     mob0->SetPosition(Vector(0, 0, 0));
-    mob1->SetPosition(Vector(minDistance, 0, 0));
-    for (int j = minDistance; j < maxDistance; j += increment)
+    mob1->SetPosition(Vector(distance, 0, 0));
+    for (int i = 0; i < maxPackets; i++)
+    {
+        p = Create<Packet>(packetSize);
+        Simulator::Schedule(Seconds(i), &LrWpanMac::McpsDataRequest, dev0->GetMac(), params, p);
+    }
+    Simulator::Run();
+    NS_LOG_DEBUG("Received " << g_packetsReceived << " packets for distance " << distance);
+    return static_cast<double>(g_packetsReceived) / maxPackets;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::ostringstream os;
+    std::ofstream berfile("802.15.4-psr-distance.plt");
+
+    int minDistance = 1;
+    int maxDistance = 200; // meters
+    int increment = 8;     // meters, first round of the sweep
+    double threshold = 0.02;
+    uint32_t workers = 0;
+    int maxPackets = 1000;
+    int packetSize = 7; // PSDU = 20 bytes (11 bytes MAC header + 7 bytes MSDU )
+    double txPower = 0;
+    uint32_t channelNumber = 11;
+    double rxSensitivity = -106.58; // dBm
+
+    CommandLine cmd(__FILE__);
+
+    cmd.AddValue("txPower", "transmit power (dBm)", txPower);
+    cmd.AddValue("packetSize", "packet (MSDU) size (bytes)", packetSize);
+    cmd.AddValue("channelNumber", "channel number", channelNumber);
+    cmd.AddValue("rxSensitivity", "the rx sensitivity (dBm)", rxSensitivity);
+    cmd.AddValue("step", "initial step of the sweep (m)", increment);
+    cmd.AddValue("threshold", "PSR difference between neighbouring points to refine", threshold);
+    cmd.AddValue("workers", "parallel worker processes, 0 for one per processor", workers);
+
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(increment < 1, "The sweep step must be at least 1 m");
+
+    os << "Packet (MSDU) size = " << packetSize << " bytes; tx power = " << txPower
+       << " dBm; channel = " << channelNumber << "; Rx sensitivity = " << rxSensitivity << " dBm";
+
+    Gnuplot psrplot = Gnuplot("802.15.4-psr-distance.eps");
+    Gnuplot2dDataset psrdataset("802.15.4-psr-vs-distance");
+
+    LrWpanPerSweepHelper sweep;
+    sweep.SetRange(minDistance, maxDistance - 1, increment);
+    sweep.SetResolution(1);
+    sweep.SetRefinementThreshold(threshold);
+    sweep.SetMaxWorkers(workers);
+    std::vector<LrWpanPerSweepHelper::Point> points = sweep.Run([=](double distance) {
+        return SimulatePsr(distance, maxPackets, packetSize, txPower, channelNumber, rxSensitivity);
+    });
+    NS_ABORT_MSG_IF(sweep.GetFailedPoints() > 0,
+                    sweep.GetFailedPoints() << " distances failed to simulate");
+    NS_LOG_DEBUG("Swept " << points.size() << " distances in " << sweep.GetRounds() << " rounds");
+
+    for (const auto& point : points)
     {
-        for (int i = 0; i < maxPackets; i++)
-        {
-            p = Create<Packet>(packetSize);
-            Simulator::Schedule(Seconds(i), &LrWpanMac::McpsDataRequest, dev0->GetMac(), params, p);
-        }
-        Simulator::Run();
-        NS_LOG_DEBUG("Received " << g_packetsReceived << " packets for distance " << j);
-        psrdataset.Add(j, g_packetsReceived / 1000.0);
-        g_packetsReceived = 0;
-
-        mob1->SetPosition(Vector(j, 0, 0));
+        psrdataset.Add(point.x, point.value);
     }
 
     psrplot.AddDataset(psrdataset);
@@ -169,6 +213,5 @@ main(int argc, char* argv[])
     psrplot.GenerateOutput(berfile);
     berfile.close();
 
-    Simulator::Destroy();
     return 0;
 }
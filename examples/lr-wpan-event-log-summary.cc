@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * Per-TP summary of a per-packet event log written with
+ * lr-wpan-csmaca-testbed-example --eventLog=<file>.
+ *
+ * The log is memory mapped and scanned column by column; nothing is parsed.
+ * RETRIES and CCAS are means per frame; a slotted CSMA/CA attempt makes two
+ * CCAs.
+ *
+ *   ./ns3 run "lr-wpan-event-log-summary --eventLog=events.bin"
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-packet-event-log.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    std::string filename;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("eventLog", "Event log file", filename);
+    cmd.Parse(argc, argv);
+
+    LrWpanPacketEventLogReader reader;
+    if (!reader.Open(filename))
+    {
+        NS_FATAL_ERROR("Cannot read the event log \"" << filename << "\"");
+    }
+
+    const uint32_t tpCount = 8;
+    uint64_t frames[tpCount] = {};
+    uint64_t success[tpCount] = {};
+    uint64_t dropped[tpCount] = {};
+    uint64_t sent[tpCount] = {};
+    uint64_t received[tpCount] = {};
+    double accessDelay[tpCount] = {};
+    double e2eDelay[tpCount] = {};
+    uint64_t retries[tpCount] = {};
+    uint64_t ccas[tpCount] = {};
+
+    for (uint32_t b = 0; b < reader.GetBlockCount(); b++)
+    {
+        const LrWpanPacketEventLogReader::Block& block = reader.GetBlock(b);
+        for (uint32_t i = 0; i < block.count; i++)
+        {
+            uint8_t tp = block.tp[i] % tpCount;
+            frames[tp]++;
+            success[tp] += block.outcome[i] == LrWpanPacketEventLog::OUTCOME_SUCCESS;
+            dropped[tp] += block.outcome[i] == LrWpanPacketEventLog::OUTCOME_DROPPED;
+            retries[tp] += block.retries[i];
+            ccas[tp] += block.ccaCount[i];
+            if (block.tx[i] >= 0)
+            {
+                sent[tp]++;
+                accessDelay[tp] += block.tx[i] - block.enqueue[i];
+            }
+            if (block.rx[i] >= 0)
+            {
+                received[tp]++;
+                e2eDelay[tp] += block.rx[i] - block.enqueue[i];
+            }
+        }
+    }
+
+    std::cout << "PACKETS: " << reader.GetRecordCount() << " in " << reader.GetBlockCount()
+              << " blocks" << std::endl;
+    std::cout << std::left << std::setw(6) << "TP" << std::setw(10) << "FRAMES" << std::setw(10)
+              << "SUCCESS" << std::setw(10) << "DROPPED" << std::setw(14) << "ACCESS(ms)"
+              << std::setw(14) << "DELAY(ms)" << std::setw(10) << "RETRIES" << "CCAS"
+              << std::endl;
+    for (uint32_t tp = 0; tp < tpCount; tp++)
+    {
+        if (frames[tp] == 0)
+        {
+            continue;
+        }
+        std::cout << std::left << std::setw(6) << tp << std::setw(10) << frames[tp]
+                  << std::setw(10) << success[tp] << std::setw(10) << dropped[tp]
+                  << std::setw(14) << (sent[tp] ? accessDelay[tp] / sent[tp] / 1e6 : 0)
+                  << std::setw(14) << (received[tp] ? e2eDelay[tp] / received[tp] / 1e6 : 0)
+                  << std::setw(10) << double(retries[tp]) / frames[tp]
+                  << double(ccas[tp]) / frames[tp] << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * Join time of a PAN whose devices all power up at once.
+ *
+ * A beacon-enabled coordinator is started, then every device starts joining
+ * it at the same instant through a LrWpanAssociationManager, which admits
+ * --budget devices per superframe and advertises an access probability in
+ * the beacons. With --unmanaged, the budget and the probability are opened
+ * (255 admissions, p = 1): every device requests association on the first
+ * beacon it hears, as lr-wpan-bootstrap does without its scan jitter.
+ *
+ * The program prints the association counters and the join latency and
+ * admission delay quantiles.
+ *
+ *   ./ns3 run "lr-wpan-join-storm --devices=200"
+ *   ./ns3 run "lr-wpan-join-storm --devices=200 --unmanaged"
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-association-manager.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/network-module.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+#define PAN_ID 5
+
+/**
+ * Print the quantiles of a latency histogram.
+ * \param name the name of the latency
+ * \param histogram the samples (s)
+ */
+static void
+PrintLatency(const std::string& name, const LrWpanLatencyHistogram& histogram)
+{
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed
+              << std::setprecision(3) << "n=" << histogram.GetCount()
+              << " mean=" << histogram.GetMean() << " p50=" << histogram.GetQuantile(0.5)
+              << " p95=" << histogram.GetQuantile(0.95) << " max=" << histogram.GetMax()
+              << " (s)" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t devices = 100;
+    uint32_t beaconOrder = 3;
+    uint32_t budget = 4;
+    double probability = 0.25;
+    bool unmanaged = false;
+    double simTime = 120;
+    uint32_t seed = 1;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("devices", "Devices joining the PAN", devices);
+    cmd.AddValue("beaconOrder", "Beacon and superframe order", beaconOrder);
+    cmd.AddValue("budget", "Admissions per superframe", budget);
+    cmd.AddValue("probability", "Initial access probability", probability);
+    cmd.AddValue("unmanaged", "Open the budget and the access probability", unmanaged);
+    cmd.AddValue("simTime", "Simulated time (s)", simTime);
+    cmd.AddValue("seed", "Run number", seed);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(beaconOrder > 5,
+                    "The join storm needs a beacon interval within macResponseWaitTime "
+                    "(BO <= 5)");
+    NS_ABORT_MSG_IF(budget == 0 || budget > 255, "Budget out of range: " << budget);
+    RngSeedManager::SetRun(seed);
+
+    NodeContainer nodes;
+    nodes.Create(devices + 1); // first one is coordinator
+
+    LrWpanHelper helper;
+    NetDeviceContainer netDevices = helper.Install(nodes);
+    helper.SetExtendedAddresses(netDevices);
+
+    Ptr<LrWpanNetDevice> coord = DynamicCast<LrWpanNetDevice>(netDevices.Get(0));
+    coord->GetMac()->SetShortAddress(Mac16Address("CA:FE"));
+
+    LrWpanAssociationManager manager;
+    manager.SetJoinBudget(unmanaged ? 255 : budget);
+    manager.SetInitialAccessProbability(unmanaged ? 1 : probability);
+    manager.AssignStreams(0);
+    manager.Install(coord);
+
+    MlmeStartRequestParams startParams;
+    startParams.m_panCoor = true;
+    startParams.m_PanId = PAN_ID;
+    startParams.m_bcnOrd = beaconOrder;
+    startParams.m_sfrmOrd = beaconOrder;
+    Simulator::ScheduleWithContext(coord->GetNode()->GetId(),
+                                   Seconds(0.01),
+                                   &LrWpanMacBase::MlmeStartRequest,
+                                   coord->GetMac(),
+                                   startParams);
+
+    MlmeAssociateRequestParams assocParams;
+    assocParams.m_chNum = 11;
+    assocParams.m_coordPanId = PAN_ID;
+    assocParams.m_coordAddrMode = SHORT_ADDR;
+    assocParams.m_coordShortAddr = Mac16Address("CA:FE");
+    CapabilityField capability;
+    capability.SetShortAddrAllocOn(true);
+    assocParams.m_capabilityInfo = capability.GetCapability();
+
+    // the whole PAN powers up at once
+    for (uint32_t i = 1; i < netDevices.GetN(); i++)
+    {
+        Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice>(netDevices.Get(i));
+        Simulator::ScheduleWithContext(dev->GetNode()->GetId(),
+                                       Seconds(1),
+                                       &LrWpanAssociationManager::Join,
+                                       &manager,
+                                       dev,
+                                       assocParams);
+    }
+
+    Simulator::Stop(Seconds(simTime));
+    Simulator::Run();
+
+    const LrWpanAssociationStats& stats = manager.GetStats();
+    std::cout << (unmanaged ? "Unmanaged" : "Managed") << " join of " << devices
+              << " devices, beacon order " << beaconOrder << std::endl;
+    std::cout << "joined " << stats.joined << "/" << devices << ", attempts " << stats.attempts
+              << ", requests received " << stats.requests << ", admitted " << stats.admitted
+              << ", deferred " << stats.deferred << ", expired " << stats.expired
+              << ", responses delivered " << stats.delivered << ", undelivered "
+              << stats.undelivered << std::endl;
+    PrintLatency("join latency", manager.GetJoinLatency());
+    PrintLatency("admission delay", manager.GetAdmissionDelay());
+
+    Simulator::Destroy();
+    return 0;
+}
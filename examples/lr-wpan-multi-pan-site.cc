@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * A site of beacon-enabled PANs run in parallel partitions.
+ *
+ * The PANs are laid on a grid of --spacing meters, each a coordinator with
+ * its devices on a circle of --radius meters around it. The channel is cut
+ * at --maxLoss dB, which has no default: the signals of a higher loss are
+ * dropped, which changes the results against an uncut channel (see
+ * LrWpanPartitionHelper). The PANs whose devices are within the cut of each
+ * other are coupled and share a partition; every partition is simulated on
+ * its own channel in a worker process, and the results of the site are their
+ * sum. Neighbouring PANs of a partition take turns: their superframes
+ * (BO > SO) start one superframe duration apart.
+ *
+ * The program prints the partitions, their results and the wall time of the
+ * site. With --serial, the site is first run with one worker, and the
+ * speedup of the parallel run is reported; both runs must give the same
+ * results. With --monolithic, the whole site is also run on one channel cut
+ * at the same loss, in one process: every PAN must give the same results as
+ * in its partition.
+ *
+ *   ./ns3 run "lr-wpan-multi-pan-site --pans=64 --spacing=400 --maxLoss=120 --serial"
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-helper.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/lr-wpan-partition-helper.h>
+#include <ns3/lr-wpan-traffic-generator.h>
+#include <ns3/node-container.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+/**
+ * Parameters of the PANs of the site.
+ */
+struct SiteParameters
+{
+    uint32_t devices = 20;        //!< Devices of a PAN, without the coordinator
+    double load = 2;              //!< Offered load of a PAN (packets/s)
+    double simTime = 10;          //!< Simulated window (s)
+    uint32_t beaconOrder = 6;     //!< Beacon order
+    uint32_t superframeOrder = 4; //!< Superframe order
+};
+
+/**
+ * Build and run the PANs of one partition.
+ *
+ * \param site the site, for the positions of the devices
+ * \param params the parameters of the PANs
+ * \param panIds the PANs of the partition
+ * \return the frames generated and the frames received by the coordinator
+ *         of each PAN, then the executed events
+ */
+static LrWpanProcessPool::Records
+RunPartition(const LrWpanPartitionHelper& site,
+             const SiteParameters& params,
+             const std::vector<uint16_t>& panIds)
+{
+    // the devices spread evenly over the TPs, the higher TPs first
+    std::vector<uint32_t> nodesPerTp(8, params.devices / 8);
+    for (uint32_t tp = 8 - params.devices % 8; tp < 8; tp++)
+    {
+        nodesPerTp[tp]++;
+    }
+    const Time superframeDuration = MicroSeconds(16 * 960) * (1 << params.superframeOrder);
+    const uint32_t turns = 1 << (params.beaconOrder - params.superframeOrder);
+
+    LrWpanHelper helper;
+    std::vector<uint64_t> delivered(panIds.size(), 0);
+    std::vector<Ptr<LrWpanTrafficGenerator>> generators;
+    for (std::size_t k = 0; k < panIds.size(); k++)
+    {
+        uint16_t panId = panIds[k];
+        NodeContainer nodes;
+        nodes.Create(params.devices + 1); // first one is coordinator
+        NetDeviceContainer devices = site.InstallPan(helper, nodes, panId, nodesPerTp);
+        // the streams of the PAN, whatever its partition
+        int64_t stream = LrWpanPartitionHelper::GetFirstStream(panId);
+        stream += helper.AssignStreams(devices, stream);
+
+        uint64_t& count = delivered[k];
+        DynamicCast<LrWpanNetDevice>(devices.Get(0))
+            ->GetMac()
+            ->TraceConnectWithoutContext("MacRx",
+                                         Callback<void, Ptr<const Packet>, uint8_t>(
+                                             [&count](Ptr<const Packet>, uint8_t) { count++; }));
+
+        NetDeviceContainer endDevices;
+        for (uint32_t i = 1; i < devices.GetN(); i++)
+        {
+            endDevices.Add(devices.Get(i));
+        }
+        Ptr<LrWpanTrafficGenerator> traffic = CreateObject<LrWpanTrafficGenerator>();
+        for (uint8_t tp = 0; tp < 8; tp++)
+        {
+            traffic->SetSource(tp,
+                               "ns3::lrwpan::LrWpanPoissonTrafficSource",
+                               "Rate",
+                               DoubleValue(params.load / params.devices));
+        }
+        helper.InstallTraffic(endDevices, traffic);
+        traffic->AssignStreams(stream);
+        helper.StartSynchronizedPan(devices,
+                                    params.beaconOrder,
+                                    params.superframeOrder,
+                                    Seconds(0.01) + superframeDuration * (panId % turns));
+        traffic->Start(Seconds(0.1));
+        traffic->Stop(Seconds(params.simTime));
+        generators.push_back(traffic);
+    }
+    site.ConfigureChannel(helper.GetChannel());
+
+    Simulator::Stop(Seconds(params.simTime));
+    Simulator::Run();
+
+    LrWpanProcessPool::Records records;
+    for (std::size_t k = 0; k < panIds.size(); k++)
+    {
+        std::string pan = std::to_string(panIds[k]);
+        records.emplace_back("generated." + pan,
+                             static_cast<double>(generators[k]->GetPacketCount()));
+        records.emplace_back("delivered." + pan, static_cast<double>(delivered[k]));
+    }
+    records.emplace_back("events", static_cast<double>(Simulator::GetEventCount()));
+    return records;
+}
+
+/**
+ * \param records the records of a partition or of the site
+ * \param name the name of a record
+ * \return its value, 0 if absent
+ */
+static double
+GetRecord(const LrWpanProcessPool::Records& records, const std::string& name)
+{
+    for (const auto& [key, value] : records)
+    {
+        if (key == name)
+        {
+            return value;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \param records the records of a partition or of the site
+ * \param name the name of a record of the PANs
+ * \return the sum of the record over the PANs
+ */
+static double
+SumPans(const LrWpanProcessPool::Records& records, const std::string& name)
+{
+    double sum = 0;
+    for (const auto& [key, value] : records)
+    {
+        if (key.compare(0, name.size() + 1, name + ".") == 0)
+        {
+            sum += value;
+        }
+    }
+    return sum;
+}
+
+/**
+ * Run the site and measure the wall time.
+ *
+ * \param site the site
+ * \param params the parameters of the PANs
+ * \param workers the maximum number of concurrent partitions
+ * \param wallTime the wall time of the run (s)
+ * \return the partitions and their results
+ */
+static std::vector<LrWpanPartitionHelper::Partition>
+RunSite(LrWpanPartitionHelper& site,
+        const SiteParameters& params,
+        uint32_t workers,
+        double& wallTime)
+{
+    site.SetMaxWorkers(workers);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<LrWpanPartitionHelper::Partition> partitions =
+        site.Run([&site, &params](const std::vector<uint16_t>& panIds) {
+            return RunPartition(site, params, panIds);
+        });
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+    wallTime = wall.count();
+    return partitions;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t pans = 16;
+    double spacing = 400;
+    double radius = 10;
+    double maxLoss = 0;
+    uint32_t workers = 0;
+    uint32_t seed = 1;
+    bool serial = false;
+    bool monolithic = false;
+    SiteParameters params;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("pans", "Number of PANs of the site", pans);
+    cmd.AddValue("spacing", "Distance between neighbouring coordinators (m)", spacing);
+    cmd.AddValue("radius", "Distance of the devices to their coordinator (m)", radius);
+    cmd.AddValue("maxLoss", "Loss above which a signal is not delivered (dB), required", maxLoss);
+    cmd.AddValue("workers", "Max concurrent partitions, 0 for one per processor", workers);
+    cmd.AddValue("seed", "RngRun of the partitions", seed);
+    cmd.AddValue("serial", "Also run the site with one worker and report the speedup", serial);
+    cmd.AddValue("monolithic", "Also run the whole site on one channel and compare", monolithic);
+    cmd.AddValue("devices", "PAN size (devices without the coordinator)", params.devices);
+    cmd.AddValue("load", "Offered load of a PAN (packets/s)", params.load);
+    cmd.AddValue("simTime", "Simulated window (s)", params.simTime);
+    cmd.AddValue("beaconOrder", "Beacon order", params.beaconOrder);
+    cmd.AddValue("superframeOrder", "Superframe order", params.superframeOrder);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(pans == 0 || pans > 0xFFFE, "Number of PANs out of range: " << pans);
+    NS_ABORT_MSG_IF(params.devices == 0 || params.devices > 65532,
+                    "PAN size out of range: " << params.devices);
+    NS_ABORT_MSG_IF(params.beaconOrder > 14 || params.superframeOrder > params.beaconOrder,
+                    "The site needs beacon-enabled PANs (SO <= BO <= 14)");
+    NS_ABORT_MSG_IF(maxLoss <= 0, "The loss of the cut, --maxLoss, is required");
+
+    LrWpanPartitionHelper site;
+    site.SetMaxLossDb(maxLoss);
+    site.SetRun(seed);
+    auto columns = static_cast<uint32_t>(std::ceil(std::sqrt(pans)));
+    for (uint32_t k = 0; k < pans; k++)
+    {
+        Vector center((k % columns) * spacing, (k / columns) * spacing, 0);
+        std::vector<Vector> positions{center};
+        for (uint32_t i = 0; i < params.devices; i++)
+        {
+            double angle = 2 * M_PI * i / params.devices;
+            positions.emplace_back(center.x + radius * std::cos(angle),
+                                   center.y + radius * std::sin(angle),
+                                   0);
+        }
+        site.AddPan(static_cast<uint16_t>(k + 1), positions);
+    }
+
+    double serialTime = 0;
+    std::vector<LrWpanPartitionHelper::Partition> reference;
+    if (serial)
+    {
+        reference = RunSite(site, params, 1, serialTime);
+    }
+    double wallTime = 0;
+    std::vector<LrWpanPartitionHelper::Partition> partitions =
+        RunSite(site, params, workers, wallTime);
+
+    LrWpanProcessPool::Records whole;
+    if (monolithic)
+    {
+        std::vector<uint16_t> panIds;
+        for (const auto& partition : partitions)
+        {
+            panIds.insert(panIds.end(), partition.panIds.begin(), partition.panIds.end());
+        }
+        std::sort(panIds.begin(), panIds.end());
+        RngSeedManager::SetRun(seed);
+        whole = RunPartition(site, params, panIds);
+        Simulator::Destroy();
+    }
+
+    std::cout << std::right << std::setw(10) << "partition" << std::setw(8) << "PANs"
+              << std::setw(10) << "devices" << std::setw(12) << "generated" << std::setw(12)
+              << "delivered" << std::setw(12) << "events" << std::endl;
+    uint32_t mismatches = 0;
+    for (std::size_t i = 0; i < partitions.size(); i++)
+    {
+        const auto& p = partitions[i];
+        std::cout << std::setw(10) << i << std::setw(8) << p.panIds.size() << std::setw(10)
+                  << p.devices;
+        if (p.status != 0)
+        {
+            std::cout << "  FAILED (status " << p.status << ")" << std::endl;
+            continue;
+        }
+        std::cout << std::fixed << std::setprecision(0) << std::setw(12)
+                  << SumPans(p.values, "generated") << std::setw(12)
+                  << SumPans(p.values, "delivered") << std::setw(12)
+                  << GetRecord(p.values, "events");
+        if (serial && reference[i].values != p.values)
+        {
+            // a partition does not depend on the number of workers
+            std::cout << "  MISMATCH";
+            mismatches++;
+        }
+        for (const auto& [name, value] : p.values)
+        {
+            // nor on the other partitions; the events of the runs differ
+            if (monolithic && name != "events" && GetRecord(whole, name) != value)
+            {
+                std::cout << "  MISMATCH " << name << " (one channel: "
+                          << GetRecord(whole, name) << ")";
+                mismatches++;
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    LrWpanProcessPool::Records total = LrWpanPartitionHelper::Sum(partitions);
+    std::cout << std::endl
+              << pans << " PANs in " << partitions.size() << " partitions, "
+              << site.GetFailedPartitions() << " failed" << std::endl
+              << "generated " << SumPans(total, "generated") << ", delivered "
+              << SumPans(total, "delivered") << ", events " << GetRecord(total, "events")
+              << std::endl
+              << std::setprecision(3) << "wall time " << wallTime << " s";
+    if (serial && wallTime > 0)
+    {
+        std::cout << ", one worker " << serialTime << " s, speedup " << std::setprecision(2)
+                  << serialTime / wallTime;
+    }
+    std::cout << std::endl;
+
+    if (mismatches > 0)
+    {
+        std::cerr << mismatches << " mismatch(es) with the serial or one-channel run"
+                  << std::endl;
+        return 1;
+    }
+    return site.GetFailedPartitions() > 0 ? 1 : 0;
+}
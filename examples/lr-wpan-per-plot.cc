@@ -12,20 +12,27 @@
    rate (PER) as a function of receive signal for the 802.15.4 model. As described by the standard,
    the PER is calculated with the transmission of frames with a PSDU of 20 bytes. This is equivalent
    to an MPDU = MAC header (11 bytes) + FCS (2 bytes) +  payload (MSDU 7 bytes). In the experimental
-   test, 1000 frames are transmitted for each Rx signal ranging from -130 dBm to -100 dBm with
-   increments of 0.01 dBm. The point before PER is < 1 % is the device receive sensitivity.
-   Theoretical and experimental Rx sensitivity is printed at the end of the end and a plot is
-   generated.
+   test, 1000 frames are transmitted for each Rx signal ranging from -111 dBm to -82 dBm. The point
+   before PER is < 1 % is the device receive sensitivity. Theoretical and experimental Rx
+   sensitivity is printed at the end of the end and a plot is generated.
+
+   The experimental points are independent simulations, run in parallel worker processes by a
+   LrWpanPerSweepHelper, each with its own RngRun. The sweep starts every --step dB and refines,
+   down to --resolution dB, where the PER of neighbouring points differs by more than
+   --threshold, so the points gather in the transition of the curve. The points around
+   PER = 1 % are always refined down to --resolution, to locate the sensitivity.
 
    Example usage:
 
    ./ns3 run "lr-wpan-per-plot --rxSensitivity=-92"
+   ./ns3 run "lr-wpan-per-plot --step=0.01 --workers=8"
 
 */
 
 #include <ns3/core-module.h>
 #include <ns3/gnuplot.h>
 #include <ns3/lr-wpan-module.h>
+#include <ns3/lr-wpan-per-sweep-helper.h>
 #include <ns3/mobility-module.h>
 #include <ns3/network-module.h>
 #include <ns3/propagation-module.h>
@@ -49,35 +56,24 @@ PacketReceivedCallback(McpsDataIndicationParams params, Ptr<Packet> p)
     g_packetsReceived++;
 }
 
-int
-main(int argc, char* argv[])
+/**
+ * Transmit frames at a fixed Rx signal. Runs in a worker process of the sweep.
+ * \param rxSignal the Rx signal (dBm)
+ * \param maxPackets the frames transmitted
+ * \param packetSize the MSDU size (bytes)
+ * \param txPower the transmit power (dBm)
+ * \param channelNumber the channel number
+ * \param rxSensitivity the Rx sensitivity of the receiver (dBm)
+ * \return the packet error rate, in [0, 1]
+ */
+double
+SimulatePer(double rxSignal,
+            int maxPackets,
+            int packetSize,
+            double txPower,
+            uint32_t channelNumber,
+            double rxSensitivity)
 {
-    LogComponentEnableAll(LogLevel(LOG_PREFIX_FUNC | LOG_PREFIX_NODE | LOG_PREFIX_TIME));
-
-    std::ostringstream os;
-    std::ofstream perfile("802.15.4-per-vs-rxSignal.plt");
-
-    double minRxSignal = -111; // dBm
-    double maxRxSignal = -82;  // dBm
-    double increment = 0.01;
-    int maxPackets = 1000;
-    int packetSize = 7; // bytes (MPDU payload)
-    double txPower = 0; // dBm
-    uint32_t channelNumber = 11;
-    double rxSensitivity = -106.58; // dBm
-
-    CommandLine cmd(__FILE__);
-
-    cmd.AddValue("txPower", "transmit power (dBm)", txPower);
-    cmd.AddValue("packetSize", "packet (MSDU) size (bytes)", packetSize);
-    cmd.AddValue("channelNumber", "channel number", channelNumber);
-    cmd.AddValue("rxSensitivity", "the rx sensitivity (dBm)", rxSensitivity);
-    cmd.Parse(argc, argv);
-
-    Gnuplot perplot = Gnuplot("802.15.4-per-vs-rxSignal.eps");
-    Gnuplot2dDataset perdatasetExperimental("Experimental");
-    Gnuplot2dDataset perdatasetTheoretical("Theoretical");
-
     Ptr<Node> n0 = CreateObject<Node>();
     Ptr<Node> n1 = CreateObject<Node>();
     Ptr<LrWpanNetDevice> dev0 = CreateObject<LrWpanNetDevice>();
@@ -111,42 +107,98 @@ main(int argc, char* argv[])
     cb0 = MakeCallback(&PacketReceivedCallback);
     dev1->GetMac()->SetMcpsDataIndicationCallback(cb0);
 
+    propModel->SetRss(rxSignal);
+    for (int i = 0; i < maxPackets; i++)
+    {
+        McpsDataRequestParams params;
+        params.m_srcAddrMode = SHORT_ADDR;
+        params.m_dstAddrMode = SHORT_ADDR;
+        params.m_dstPanId = 0;
+        params.m_dstAddr = Mac16Address("00:02");
+        params.m_msduHandle = 0;
+        params.m_txOptions = 0;
+        Ptr<Packet> p;
+        p = Create<Packet>(packetSize);
+        Simulator::Schedule(Seconds(i), &LrWpanMac::McpsDataRequest, dev0->GetMac(), params, p);
+    }
+
+    Simulator::Run();
+
+    return static_cast<double>(maxPackets - g_packetsReceived) / maxPackets;
+}
+
+int
+main(int argc, char* argv[])
+{
+    LogComponentEnableAll(LogLevel(LOG_PREFIX_FUNC | LOG_PREFIX_NODE | LOG_PREFIX_TIME));
+
+    std::ostringstream os;
+    std::ofstream perfile("802.15.4-per-vs-rxSignal.plt");
+
+    double minRxSignal = -111; // dBm
+    double maxRxSignal = -82;  // dBm
+    double increment = 0.01;
+    double step = 0.5;       // dBm, first round of the experimental sweep
+    double threshold = 0.02; // PER difference refined between neighbouring points
+    uint32_t workers = 0;
+    int maxPackets = 1000;
+    int packetSize = 7; // bytes (MPDU payload)
+    double txPower = 0; // dBm
+    uint32_t channelNumber = 11;
+    double rxSensitivity = -106.58; // dBm
+
+    CommandLine cmd(__FILE__);
+
+    cmd.AddValue("txPower", "transmit power (dBm)", txPower);
+    cmd.AddValue("packetSize", "packet (MSDU) size (bytes)", packetSize);
+    cmd.AddValue("channelNumber", "channel number", channelNumber);
+    cmd.AddValue("rxSensitivity", "the rx sensitivity (dBm)", rxSensitivity);
+    cmd.AddValue("step", "initial step of the experimental sweep (dB)", step);
+    cmd.AddValue("resolution", "finest step of the sweeps (dB)", increment);
+    cmd.AddValue("threshold", "PER difference between neighbouring points to refine", threshold);
+    cmd.AddValue("workers", "parallel worker processes, 0 for one per processor", workers);
+    cmd.AddValue("frames", "frames transmitted per experimental point", maxPackets);
+    cmd.Parse(argc, argv);
+
+    Gnuplot perplot = Gnuplot("802.15.4-per-vs-rxSignal.eps");
+    Gnuplot2dDataset perdatasetExperimental("Experimental");
+    Gnuplot2dDataset perdatasetTheoretical("Theoretical");
+
     //////////////////////////////////
     // Experimental  PER v.s Signal //
     //////////////////////////////////
 
+    LrWpanPerSweepHelper sweep;
+    sweep.SetRange(minRxSignal, maxRxSignal, step);
+    sweep.SetResolution(increment);
+    sweep.SetRefinementThreshold(threshold);
+    // the sensitivity is the first signal with a PER of at most 1 %
+    sweep.AddRefinementLevel(0.01);
+    sweep.SetMaxWorkers(workers);
+    std::vector<LrWpanPerSweepHelper::Point> points = sweep.Run([=](double rxSignal) {
+        return SimulatePer(rxSignal,
+                           maxPackets,
+                           packetSize,
+                           txPower,
+                           channelNumber,
+                           rxSensitivity);
+    });
+
     double per = 1;
     double sensitivityExp = 0;
     bool sensThreshold = true;
 
-    for (double j = minRxSignal; j < maxRxSignal; j += increment)
+    for (const auto& point : points)
     {
-        propModel->SetRss(j);
         if (sensThreshold)
         {
-            sensitivityExp = j;
+            sensitivityExp = point.x;
         }
 
-        for (int i = 0; i < maxPackets; i++)
-        {
-            McpsDataRequestParams params;
-            params.m_srcAddrMode = SHORT_ADDR;
-            params.m_dstAddrMode = SHORT_ADDR;
-            params.m_dstPanId = 0;
-            params.m_dstAddr = Mac16Address("00:02");
-            params.m_msduHandle = 0;
-            params.m_txOptions = 0;
-            Ptr<Packet> p;
-            p = Create<Packet>(packetSize);
-            Simulator::Schedule(Seconds(i), &LrWpanMac::McpsDataRequest, dev0->GetMac(), params, p);
-        }
-
-        Simulator::Run();
-
-        per = (static_cast<double>(maxPackets - g_packetsReceived) / maxPackets) * 100;
+        per = point.value * 100;
 
-        std::cout << "Experimental Test || Signal: " << j << " dBm | Received " << g_packetsReceived
-                  << " pkts"
+        std::cout << "Experimental Test || Signal: " << point.x << " dBm | Received "
+                  << std::lround(maxPackets * (1 - point.value)) << " pkts"
                   << "/" << maxPackets << " | PER " << per << " %\n";
 
         if (per <= 1 && sensThreshold)
@@ -154,9 +206,10 @@ main(int argc, char* argv[])
             sensThreshold = false;
         }
 
-        perdatasetExperimental.Add(j, per);
-        g_packetsReceived = 0;
+        perdatasetExperimental.Add(point.x, per);
     }
+    std::cout << "Experimental Test || " << points.size() << " points in " << sweep.GetRounds()
+              << " rounds, " << sweep.GetFailedPoints() << " failed\n";
 
     /////////////////////////////////
     // Theoretical PER v.s. Signal //
@@ -236,6 +289,5 @@ main(int argc, char* argv[])
     perplot.GenerateOutput(perfile);
     perfile.close();
 
-    Simulator::Destroy();
     return 0;
 }
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * Scaling of the simulation cost with the PAN size.
+ *
+ * For each CSMA/CA engine and each PAN size, a beacon-enabled star PAN is
+ * built with LrWpanHelper::InstallStarPan and driven by Poisson traffic of a
+ * fixed aggregate offered load (split evenly over the devices), for a fixed
+ * simulated window.
+ * The benchmark records the wall time, the peak RSS, the executed events (and
+ * events per simulated second) and the frames delivered to the coordinator.
+ * With --energy, every end device also gets a LrWpanRadioEnergyModel (CC2420
+ * currents, 3 V) and their radio energy per delivered frame is reported, to
+ * rank the engines. With --superframeOrder below the beacon order and
+ * --sleep, the devices turn their transceiver off in the inactive periods
+ * (LrWpanHelper::EnableInactiveSleep).
+ *
+ * With --baseline, the wall times are compared to those of a CSV written
+ * earlier with --csv, and the program fails when one of them exceeds its
+ * baseline by more than --maxSlowdown. Baseline runs shorter than
+ * --minBaselineTime are too noisy to compare and are skipped.
+ *
+ *   ./ns3 run "lr-wpan-scaling-benchmark --csv=baseline.csv"
+ *   ./ns3 run "lr-wpan-scaling-benchmark --baseline=baseline.csv --maxSlowdown=1.3"
+ */
+
+#include <ns3/basic-energy-source-helper.h>
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-helper.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/lr-wpan-radio-energy-model-helper.h>
+#include <ns3/lr-wpan-traffic-generator.h>
+#include <ns3/node-container.h>
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+#define PAN_ID 5
+
+/**
+ * Result of one engine on one PAN size.
+ */
+struct ScalingResult
+{
+    double wallTime = 0;    //!< Wall time of the setup and the run (s)
+    double peakRss = 0;     //!< Peak resident set size (MiB)
+    uint64_t events = 0;    //!< Executed events
+    uint64_t offered = 0;   //!< Packets handed to the MACs
+    uint64_t delivered = 0; //!< Frames received by the coordinator
+    double energy = 0;      //!< Radio energy of the end devices (J), with --energy
+};
+
+/**
+ * Reset the peak RSS of the process, so that the next reading covers one run.
+ * Only Linux supports it; elsewhere the peak covers all previous runs.
+ */
+static void
+ResetPeakRss()
+{
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs)
+    {
+        clearRefs << "5";
+    }
+}
+
+/**
+ * \return the peak RSS of the process (MiB)
+ */
+static double
+GetPeakRss()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind("VmHWM:", 0) == 0)
+        {
+            return std::stod(line.substr(6)) / 1024;
+        }
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+/**
+ * \param engine the engine name
+ * \return the TypeId name of the engine
+ */
+static std::string
+GetCsmaCaTypeId(const std::string& engine)
+{
+    static const std::map<std::string, std::string> typeIds = {
+        {"beb", "ns3::lrwpan::LrWpanCsmaCa"},
+        {"noba", "ns3::lrwpan::LrWpanCsmaCaNoba"},
+        {"swnoba", "ns3::lrwpan::LrWpanCsmaCaSwNoba"},
+        {"standard", "ns3::lrwpan::LrWpanCsmaCaStandard"},
+        {"gnunoba", "ns3::lrwpan::LrWpanCsmaCaGnuNoba"},
+    };
+    auto it = typeIds.find(engine);
+    NS_ABORT_MSG_IF(it == typeIds.end(), "Unknown engine " << engine);
+    return it->second;
+}
+
+/**
+ * Build and run one star PAN.
+ *
+ * \param engine the CSMA/CA engine of the devices
+ * \param size the number of devices, without the coordinator
+ * \param load the aggregate offered load (packets/s)
+ * \param simTime the simulated window (s)
+ * \param beaconOrder the beacon order
+ * \param superframeOrder the superframe order
+ * \param seed the run number
+ * \param energy whether to account the radio energy
+ * \param sleep whether the devices sleep in the inactive periods
+ * \return the measurement
+ */
+static ScalingResult
+RunStar(const std::string& engine,
+        uint32_t size,
+        double load,
+        double simTime,
+        uint8_t beaconOrder,
+        uint8_t superframeOrder,
+        uint32_t seed,
+        bool energy,
+        bool sleep)
+{
+    ScalingResult r;
+    uint64_t delivered = 0;
+    RngSeedManager::SetRun(seed);
+    ResetPeakRss();
+    auto start = std::chrono::steady_clock::now();
+    {
+        NodeContainer nodes;
+        nodes.Create(size + 1); // first one is coordinator
+
+        // the devices spread evenly over the TPs, the higher TPs first
+        std::vector<uint32_t> nodesPerTp(8, size / 8);
+        for (uint32_t tp = 8 - size % 8; tp < 8; tp++)
+        {
+            nodesPerTp[tp]++;
+        }
+
+        LrWpanHelper helper;
+        helper.SetCsmaCa(GetCsmaCaTypeId(engine));
+        NetDeviceContainer devices = helper.InstallStarPan(nodes, PAN_ID, nodesPerTp);
+
+        Ptr<LrWpanNetDevice> coord = DynamicCast<LrWpanNetDevice>(devices.Get(0));
+        coord->GetMac()->TraceConnectWithoutContext(
+            "MacRx",
+            Callback<void, Ptr<const Packet>, uint8_t>(
+                [&delivered](Ptr<const Packet>, uint8_t) { delivered++; }));
+
+        MlmeStartRequestParams params;
+        params.m_panCoor = true;
+        params.m_PanId = PAN_ID;
+        params.m_bcnOrd = beaconOrder;
+        params.m_sfrmOrd = superframeOrder;
+        Simulator::ScheduleWithContext(1,
+                                       Seconds(0.01),
+                                       &LrWpanMacBase::MlmeStartRequest,
+                                       coord->GetMac(),
+                                       params);
+
+        NetDeviceContainer endDevices;
+        for (uint32_t i = 1; i < devices.GetN(); i++)
+        {
+            endDevices.Add(devices.Get(i));
+        }
+        if (sleep)
+        {
+            helper.EnableInactiveSleep(endDevices, MicroSeconds(320));
+        }
+
+        energy::DeviceEnergyModelContainer radioModels;
+        if (energy)
+        {
+            // enough for the window not to drain any battery
+            BasicEnergySourceHelper sourceHelper;
+            sourceHelper.Set("BasicEnergySourceInitialEnergyJ", DoubleValue(1e6));
+            sourceHelper.Set("BasicEnergySupplyVoltageV", DoubleValue(3.0));
+            NodeContainer endNodes;
+            for (uint32_t i = 1; i < nodes.GetN(); i++)
+            {
+                endNodes.Add(nodes.Get(i));
+            }
+            energy::EnergySourceContainer sources = sourceHelper.Install(endNodes);
+            LrWpanRadioEnergyModelHelper radioHelper;
+            radioModels = radioHelper.Install(endDevices, sources);
+        }
+
+        Ptr<LrWpanTrafficGenerator> traffic = CreateObject<LrWpanTrafficGenerator>();
+        for (uint8_t tp = 0; tp < 8; tp++)
+        {
+            traffic->SetSource(tp,
+                               "ns3::lrwpan::LrWpanPoissonTrafficSource",
+                               "Rate",
+                               DoubleValue(load / size));
+        }
+        helper.InstallTraffic(endDevices, traffic);
+        traffic->Start(Seconds(0.1));
+        traffic->Stop(Seconds(simTime));
+
+        Simulator::Stop(Seconds(simTime));
+        Simulator::Run();
+
+        r.events = Simulator::GetEventCount();
+        r.offered = traffic->GetPacketCount();
+        r.delivered = delivered;
+        for (auto i = radioModels.Begin(); i != radioModels.End(); i++)
+        {
+            r.energy += (*i)->GetTotalEnergyConsumption();
+        }
+    }
+    Simulator::Destroy();
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+    r.wallTime = wall.count();
+    r.peakRss = GetPeakRss();
+    return r;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string sizes = "10,20,50,100,200,500,1000,2000";
+    std::string engines = "beb,noba,swnoba,standard,gnunoba";
+    double load = 20;
+    double simTime = 10;
+    uint32_t beaconOrder = 6;
+    int32_t superframeOrder = -1;
+    uint32_t seed = 1;
+    std::string csvFile;
+    std::string baselineFile;
+    double maxSlowdown = 1.5;
+    double minBaselineTime = 0.1;
+    bool energy = false;
+    bool sleep = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("sizes", "Comma separated PAN sizes (devices without the coordinator)", sizes);
+    cmd.AddValue("engines", "Comma separated engines: beb, noba, swnoba, standard, gnunoba", engines);
+    cmd.AddValue("load", "Aggregate offered load (packets/s)", load);
+    cmd.AddValue("simTime", "Simulated window (s)", simTime);
+    cmd.AddValue("beaconOrder", "Beacon order", beaconOrder);
+    cmd.AddValue("superframeOrder", "Superframe order (-1: the beacon order)", superframeOrder);
+    cmd.AddValue("seed", "Run number", seed);
+    cmd.AddValue("csv", "Write the results as CSV to this file (empty: none)", csvFile);
+    cmd.AddValue("baseline", "CSV of a previous run to compare the wall times to", baselineFile);
+    cmd.AddValue("maxSlowdown", "Fail above this wall time ratio to the baseline", maxSlowdown);
+    cmd.AddValue("minBaselineTime",
+                 "Skip the comparison of baseline runs shorter than this (s)",
+                 minBaselineTime);
+    cmd.AddValue("energy", "Account the radio energy per delivered frame", energy);
+    cmd.AddValue("sleep", "Turn the devices off in the inactive periods", sleep);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(beaconOrder > 14, "The scaling benchmark needs a beacon-enabled PAN");
+    if (superframeOrder < 0)
+    {
+        superframeOrder = beaconOrder;
+    }
+    NS_ABORT_MSG_IF(static_cast<uint32_t>(superframeOrder) > beaconOrder,
+                    "The superframe order must not exceed the beacon order");
+
+    // engine,size -> baseline wall time
+    std::map<std::pair<std::string, uint32_t>, double> baseline;
+    if (!baselineFile.empty())
+    {
+        std::ifstream in(baselineFile);
+        NS_ABORT_MSG_IF(!in, "Cannot read " << baselineFile);
+        std::string line;
+        std::getline(in, line); // header
+        while (std::getline(in, line))
+        {
+            std::istringstream fields(line);
+            std::string engine;
+            std::string size;
+            std::string wallTime;
+            std::getline(fields, engine, ',');
+            std::getline(fields, size, ',');
+            std::getline(fields, wallTime, ',');
+            if (!wallTime.empty())
+            {
+                baseline[{engine, std::stoul(size)}] = std::stod(wallTime);
+            }
+        }
+    }
+
+    std::ofstream csv;
+    if (!csvFile.empty())
+    {
+        csv.open(csvFile);
+        NS_ABORT_MSG_IF(!csv, "Cannot write " << csvFile);
+        csv << "engine,devices,wallTime,peakRssMiB,events,eventsPerSimSecond,offered,delivered,"
+               "mJPerFrame"
+            << std::endl;
+    }
+
+    std::cout << std::left << std::setw(10) << "engine" << std::right << std::setw(8)
+              << "devices" << std::setw(10) << "wall (s)" << std::setw(10) << "RSS MiB"
+              << std::setw(12) << "events" << std::setw(12) << "events/s" << std::setw(10)
+              << "offered" << std::setw(10) << "delivered" << std::setw(12) << "mJ/frame"
+              << std::setw(10) << "slowdown" << std::endl;
+
+    uint32_t regressions = 0;
+    std::istringstream engineList(engines);
+    std::string engine;
+    while (std::getline(engineList, engine, ','))
+    {
+        std::istringstream sizeList(sizes);
+        std::string sizeField;
+        while (std::getline(sizeList, sizeField, ','))
+        {
+            uint32_t size = std::stoul(sizeField);
+            NS_ABORT_MSG_IF(size == 0 || size > 65532, "PAN size out of range: " << size);
+            ScalingResult r = RunStar(engine,
+                                      size,
+                                      load,
+                                      simTime,
+                                      beaconOrder,
+                                      superframeOrder,
+                                      seed,
+                                      energy,
+                                      sleep);
+            double mJPerFrame = r.delivered > 0 ? 1e3 * r.energy / r.delivered : 0;
+
+            std::cout << std::left << std::setw(10) << engine << std::right << std::setw(8)
+                      << size << std::fixed << std::setprecision(2) << std::setw(10)
+                      << r.wallTime << std::setprecision(1) << std::setw(10) << r.peakRss
+                      << std::setw(12) << r.events << std::setw(12) << r.events / simTime
+                      << std::setw(10) << r.offered << std::setw(10) << r.delivered
+                      << std::setprecision(3) << std::setw(12) << mJPerFrame;
+            auto it = baseline.find({engine, size});
+            if (it != baseline.end() && it->second >= minBaselineTime)
+            {
+                double slowdown = r.wallTime / it->second;
+                std::cout << std::setprecision(2) << std::setw(10) << slowdown;
+                if (slowdown > maxSlowdown)
+                {
+                    std::cout << "  REGRESSION";
+                    regressions++;
+                }
+            }
+            std::cout << std::endl;
+
+            if (csv.is_open())
+            {
+                csv << engine << "," << size << "," << r.wallTime << "," << r.peakRss << ","
+                    << r.events << "," << r.events / simTime << "," << r.offered << ","
+                    << r.delivered << "," << mJPerFrame << std::endl;
+            }
+        }
+    }
+
+    if (regressions > 0)
+    {
+        std::cerr << regressions << " run(s) slower than " << maxSlowdown
+                  << " times the baseline" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+
+/*
+ * Cost of the event schedulers on a beacon-enabled PAN.
+ *
+ * The testbed scenario, a beacon-enabled star PAN built with
+ * LrWpanHelper::InstallStarPan whose devices are synchronized to the
+ * superframe and driven by Poisson traffic, is run once per scheduler
+ * (SchedulerType): the ns-3 map, heap, calendar and list schedulers and the
+ * backoff period calendar of this module (LrWpanSlotScheduler). Each run
+ * uses the same streams, so every scheduler must execute the same events
+ * and deliver the same frames; the program fails otherwise.
+ *
+ * The benchmark reports the wall time of the run (the setup excluded), the
+ * executed events, the events per wall second and the speedup over the
+ * first scheduler of the list, and writes them as CSV.
+ *
+ *   ./ns3 run "lr-wpan-scheduler-benchmark --devices=500 --csv=schedulers.csv"
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-helper.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/lr-wpan-traffic-generator.h>
+#include <ns3/node-container.h>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+#define PAN_ID 5
+
+/**
+ * Result of one scheduler.
+ */
+struct SchedulerResult
+{
+    double wallTime = 0;    //!< Wall time of the run (s)
+    uint64_t events = 0;    //!< Executed events
+    uint64_t delivered = 0; //!< Frames received by the coordinator
+};
+
+/**
+ * \param scheduler the scheduler name
+ * \return the TypeId name of the scheduler
+ */
+static std::string
+GetSchedulerTypeId(const std::string& scheduler)
+{
+    static const std::map<std::string, std::string> typeIds = {
+        {"map", "ns3::MapScheduler"},
+        {"heap", "ns3::HeapScheduler"},
+        {"calendar", "ns3::CalendarScheduler"},
+        {"list", "ns3::ListScheduler"},
+        {"slot", "ns3::lrwpan::LrWpanSlotScheduler"},
+    };
+    auto it = typeIds.find(scheduler);
+    NS_ABORT_MSG_IF(it == typeIds.end(), "Unknown scheduler " << scheduler);
+    return it->second;
+}
+
+/**
+ * Build and run one star PAN with a scheduler.
+ *
+ * \param scheduler the TypeId name of the scheduler
+ * \param size the number of devices, without the coordinator
+ * \param load the aggregate offered load (packets/s)
+ * \param simTime the simulated window (s)
+ * \param beaconOrder the beacon order
+ * \param seed the run number
+ * \return the measurement
+ */
+static SchedulerResult
+RunPan(const std::string& scheduler,
+       uint32_t size,
+       double load,
+       double simTime,
+       uint8_t beaconOrder,
+       uint32_t seed)
+{
+    SchedulerResult r;
+    RngSeedManager::SetRun(seed);
+    GlobalValue::Bind("SchedulerType", StringValue(scheduler));
+    {
+        NodeContainer nodes;
+        nodes.Create(size + 1); // first one is coordinator
+
+        // the devices spread evenly over the TPs, the higher TPs first
+        std::vector<uint32_t> nodesPerTp(8, size / 8);
+        for (uint32_t tp = 8 - size % 8; tp < 8; tp++)
+        {
+            nodesPerTp[tp]++;
+        }
+
+        LrWpanHelper helper;
+        NetDeviceContainer devices = helper.InstallStarPan(nodes, PAN_ID, nodesPerTp);
+        helper.AssignStreams(devices, 0);
+
+        uint64_t delivered = 0;
+        DynamicCast<LrWpanNetDevice>(devices.Get(0))
+            ->GetMac()
+            ->TraceConnectWithoutContext("MacRx",
+                                         Callback<void, Ptr<const Packet>, uint8_t>(
+                                             [&delivered](Ptr<const Packet>, uint8_t) {
+                                                 delivered++;
+                                             }));
+
+        NetDeviceContainer endDevices;
+        for (uint32_t i = 1; i < devices.GetN(); i++)
+        {
+            endDevices.Add(devices.Get(i));
+        }
+        Ptr<LrWpanTrafficGenerator> traffic = CreateObject<LrWpanTrafficGenerator>();
+        for (uint8_t tp = 0; tp < 8; tp++)
+        {
+            traffic->SetSource(tp,
+                               "ns3::lrwpan::LrWpanPoissonTrafficSource",
+                               "Rate",
+                               DoubleValue(load / size));
+        }
+        helper.InstallTraffic(endDevices, traffic);
+        traffic->AssignStreams(devices.GetN() * 100);
+        helper.StartSynchronizedPan(devices, beaconOrder, beaconOrder, Seconds(0.01));
+        traffic->Start(Seconds(0.1));
+        traffic->Stop(Seconds(simTime));
+
+        Simulator::Stop(Seconds(simTime));
+        auto start = std::chrono::steady_clock::now();
+        Simulator::Run();
+        std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+        r.wallTime = wall.count();
+        r.events = Simulator::GetEventCount();
+        r.delivered = delivered;
+    }
+    Simulator::Destroy();
+    return r;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string schedulers = "map,heap,calendar,slot";
+    uint32_t devices = 200;
+    double load = 20;
+    double simTime = 10;
+    uint32_t beaconOrder = 6;
+    uint32_t seed = 1;
+    std::string csvFile;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("schedulers",
+                 "Comma separated schedulers: map, heap, calendar, list, slot",
+                 schedulers);
+    cmd.AddValue("devices", "PAN size (devices without the coordinator)", devices);
+    cmd.AddValue("load", "Aggregate offered load (packets/s)", load);
+    cmd.AddValue("simTime", "Simulated window (s)", simTime);
+    cmd.AddValue("beaconOrder", "Beacon order (and superframe order)", beaconOrder);
+    cmd.AddValue("seed", "Run number", seed);
+    cmd.AddValue("csv", "Write the results as CSV to this file (empty: none)", csvFile);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(beaconOrder > 14, "The scheduler benchmark needs a beacon-enabled PAN");
+    NS_ABORT_MSG_IF(devices == 0 || devices > 65532, "PAN size out of range: " << devices);
+
+    std::ofstream csv;
+    if (!csvFile.empty())
+    {
+        csv.open(csvFile);
+        NS_ABORT_MSG_IF(!csv, "Cannot write " << csvFile);
+        csv << "scheduler,devices,wallTime,events,eventsPerWallSecond,delivered,speedup"
+            << std::endl;
+    }
+
+    std::cout << std::left << std::setw(10) << "scheduler" << std::right << std::setw(10)
+              << "wall (s)" << std::setw(12) << "events" << std::setw(14) << "events/wall s"
+              << std::setw(10) << "delivered" << std::setw(10) << "speedup" << std::endl;
+
+    bool first = true;
+    SchedulerResult reference;
+    uint32_t mismatches = 0;
+    std::istringstream schedulerList(schedulers);
+    std::string scheduler;
+    while (std::getline(schedulerList, scheduler, ','))
+    {
+        SchedulerResult r =
+            RunPan(GetSchedulerTypeId(scheduler), devices, load, simTime, beaconOrder, seed);
+        if (first)
+        {
+            reference = r;
+            first = false;
+        }
+        double speedup = r.wallTime > 0 ? reference.wallTime / r.wallTime : 0;
+        double eventRate = r.wallTime > 0 ? r.events / r.wallTime : 0;
+
+        std::cout << std::left << std::setw(10) << scheduler << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << r.wallTime << std::setw(12)
+                  << r.events << std::setprecision(0) << std::setw(14) << eventRate
+                  << std::setw(10) << r.delivered << std::setprecision(2) << std::setw(10)
+                  << speedup;
+        if (r.events != reference.events || r.delivered != reference.delivered)
+        {
+            // the order of the events must not depend on the scheduler
+            std::cout << "  MISMATCH";
+            mismatches++;
+        }
+        std::cout << std::endl;
+
+        if (csv.is_open())
+        {
+            csv << scheduler << "," << devices << "," << r.wallTime << "," << r.events << ","
+                << eventRate << "," << r.delivered << "," << speedup << std::endl;
+        }
+    }
+
+    if (mismatches > 0)
+    {
+        std::cerr << mismatches << " scheduler(s) did not reproduce the first run" << std::endl;
+        return 1;
+    }
+    return 0;
+}
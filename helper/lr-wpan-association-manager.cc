@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-association-manager.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-constants.h>
+#include <ns3/lr-wpan-fields.h>
+#include <ns3/simulator.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanAssociationManager");
+
+/// Smallest advertised access probability, one step of its octet
+static const double MIN_ACCESS_PROBABILITY = 1.0 / 255;
+
+/// Failed attempts after which a joiner stops lowering its access probability
+static const uint32_t MAX_JOINER_BACKOFF = 4;
+
+LrWpanAssociationManager::LrWpanAssociationManager()
+    : m_budget(4),
+      m_admittedInSuperframe(0),
+      m_requestsInSuperframe(0),
+      m_probability(0.25),
+      m_started(false),
+      m_nextShortAddress(1)
+{
+    m_random = CreateObject<UniformRandomVariable>();
+}
+
+void
+LrWpanAssociationManager::SetJoinBudget(uint8_t budget)
+{
+    NS_ABORT_MSG_IF(budget == 0, "The join budget must admit at least one device");
+    m_budget = budget;
+}
+
+void
+LrWpanAssociationManager::SetInitialAccessProbability(double probability)
+{
+    NS_ABORT_MSG_IF(probability <= 0 || probability > 1,
+                    "Access probability out of range: " << probability);
+    m_probability = std::max(probability, MIN_ACCESS_PROBABILITY);
+}
+
+int64_t
+LrWpanAssociationManager::AssignStreams(int64_t stream)
+{
+    m_random->SetStream(stream);
+    return 1;
+}
+
+void
+LrWpanAssociationManager::Install(Ptr<lrwpan::LrWpanNetDevice> coordinator)
+{
+    NS_ABORT_MSG_IF(m_coordinator, "The manager already has a coordinator");
+    m_coordinator = coordinator;
+
+    Ptr<lrwpan::LrWpanMac> mac = coordinator->GetMac();
+    mac->SetMlmeAssociateIndicationCallback(
+        MakeCallback(&LrWpanAssociationManager::AssociateIndication, this));
+    mac->SetMlmeCommStatusIndicationCallback(
+        MakeCallback(&LrWpanAssociationManager::CommStatusIndication, this));
+    mac->TraceConnectWithoutContext("BeaconStart",
+                                    MakeCallback(&LrWpanAssociationManager::BeaconStart, this));
+
+    // macResponseWaitTime, at its default of 32 base superframes
+    m_responseWaitTime = Seconds(32.0 * lrwpan::aBaseSuperframeDuration /
+                                 coordinator->GetPhy()->GetDataOrSymbolRate(false));
+    UpdateBeaconPayload();
+}
+
+void
+LrWpanAssociationManager::Join(Ptr<lrwpan::LrWpanNetDevice> device,
+                               lrwpan::MlmeAssociateRequestParams params)
+{
+    NS_ABORT_MSG_IF(!m_coordinator, "Install the manager on a coordinator first");
+    uint32_t index = m_joiners.size();
+    m_joiners.push_back({device, params, Simulator::Now(), 0, false, false});
+
+    Ptr<lrwpan::LrWpanMac> mac = device->GetMac();
+    mac->SetMlmeBeaconNotifyIndicationCallback(
+        Callback<void, lrwpan::MlmeBeaconNotifyIndicationParams>(
+            [this, index](lrwpan::MlmeBeaconNotifyIndicationParams p) {
+                JoinerBeaconNotify(index, p);
+            }));
+    mac->SetMlmeAssociateConfirmCallback(Callback<void, lrwpan::MlmeAssociateConfirmParams>(
+        [this, index](lrwpan::MlmeAssociateConfirmParams p) { JoinerAssociateConfirm(index, p); }));
+    mac->SetMlmePollConfirmCallback(Callback<void, lrwpan::MlmePollConfirmParams>(
+        [this, index](lrwpan::MlmePollConfirmParams p) { JoinerPollConfirm(index, p); }));
+
+    Ptr<lrwpan::MacPibAttributes> pib = Create<lrwpan::MacPibAttributes>();
+    pib->pCurrentChannel = params.m_chNum;
+    mac->MlmeSetRequest(lrwpan::pCurrentChannel, pib);
+    mac->SetRxOnWhenIdle(true);
+}
+
+bool
+LrWpanAssociationManager::ParseBeaconPayload(Ptr<const Packet> sdu,
+                                             uint8_t& budget,
+                                             double& probability)
+{
+    if (!sdu || sdu->GetSize() != 2)
+    {
+        return false;
+    }
+    uint8_t octets[2];
+    sdu->CopyData(octets, 2);
+    budget = octets[0];
+    probability = octets[1] / 255.0;
+    return octets[1] > 0;
+}
+
+double
+LrWpanAssociationManager::GetAccessProbability() const
+{
+    return m_probability;
+}
+
+uint32_t
+LrWpanAssociationManager::GetPendingCount() const
+{
+    return m_pending.size();
+}
+
+const LrWpanAssociationStats&
+LrWpanAssociationManager::GetStats() const
+{
+    return m_stats;
+}
+
+const lrwpan::LrWpanLatencyHistogram&
+LrWpanAssociationManager::GetJoinLatency() const
+{
+    return m_joinLatency;
+}
+
+const lrwpan::LrWpanLatencyHistogram&
+LrWpanAssociationManager::GetAdmissionDelay() const
+{
+    return m_admissionDelay;
+}
+
+void
+LrWpanAssociationManager::AssociateIndication(lrwpan::MlmeAssociateIndicationParams params)
+{
+    NS_LOG_FUNCTION(this << params.m_extDevAddr);
+    m_stats.requests++;
+    m_requestsInSuperframe++;
+    m_firstRequest.emplace(params.m_extDevAddr, Simulator::Now());
+
+    // A device asking again while held restarts its wait for the response
+    for (auto& request : m_pending)
+    {
+        if (request.address == params.m_extDevAddr)
+        {
+            request.capability = params.capabilityInfo;
+            request.received = Simulator::Now();
+            return;
+        }
+    }
+
+    if (m_pending.empty() && m_admittedInSuperframe < m_budget)
+    {
+        Admit(params.m_extDevAddr, params.capabilityInfo);
+    }
+    else
+    {
+        m_pending.push_back({params.m_extDevAddr, params.capabilityInfo, Simulator::Now()});
+        m_stats.deferred++;
+    }
+}
+
+void
+LrWpanAssociationManager::CommStatusIndication(lrwpan::MlmeCommStatusIndicationParams params)
+{
+    NS_LOG_FUNCTION(this << params.m_dstExtAddr << params.m_status);
+    auto it = m_firstRequest.find(params.m_dstExtAddr);
+    if (it == m_firstRequest.end())
+    {
+        return;
+    }
+
+    if (params.m_status == lrwpan::MacStatus::SUCCESS)
+    {
+        m_stats.delivered++;
+        m_admissionDelay.Record((Simulator::Now() - it->second).GetSeconds());
+        m_firstRequest.erase(it);
+    }
+    else
+    {
+        // The device asks again, its first request still counts
+        m_stats.undelivered++;
+    }
+}
+
+void
+LrWpanAssociationManager::BeaconStart(SequenceNumber8 bsn)
+{
+    NS_LOG_FUNCTION(this << bsn);
+
+    if (!m_started)
+    {
+        // the held requests are answered at the next beacon, in time or never
+        Ptr<lrwpan::LrWpanMac> mac = m_coordinator->GetMac();
+        Time beaconInterval =
+            Seconds(static_cast<double>(lrwpan::aBaseSuperframeDuration << mac->m_macBeaconOrder) /
+                    m_coordinator->GetPhy()->GetDataOrSymbolRate(false));
+        NS_ABORT_MSG_IF(beaconInterval > m_responseWaitTime,
+                        "Beacon order " << +mac->m_macBeaconOrder
+                                        << ": the held association requests would expire before "
+                                           "the next beacon (BO <= 5)");
+    }
+
+    // Adapt the access probability to the requests of the superframe that ended
+    if (m_started)
+    {
+        if (m_requestsInSuperframe > m_budget)
+        {
+            m_probability *= static_cast<double>(m_budget) / m_requestsInSuperframe;
+        }
+        else if (m_requestsInSuperframe < m_budget && m_pending.empty())
+        {
+            m_probability *= 2;
+        }
+        m_probability = std::clamp(m_probability, MIN_ACCESS_PROBABILITY, 1.0);
+    }
+    m_started = true;
+    m_admittedInSuperframe = 0;
+    m_requestsInSuperframe = 0;
+
+    // Answer the held requests whose device still waits, oldest first
+    while (!m_pending.empty() && m_admittedInSuperframe < m_budget)
+    {
+        PendingRequest request = m_pending.front();
+        m_pending.pop_front();
+        if (Simulator::Now() - request.received >= m_responseWaitTime)
+        {
+            m_stats.expired++;
+            continue;
+        }
+        Admit(request.address, request.capability);
+    }
+    UpdateBeaconPayload();
+}
+
+void
+LrWpanAssociationManager::Admit(Mac64Address address, uint8_t capability)
+{
+    NS_LOG_FUNCTION(this << address);
+    lrwpan::MlmeAssociateResponseParams params;
+    params.m_extDevAddr = address;
+    params.m_status = lrwpan::MacStatus::SUCCESS;
+
+    lrwpan::CapabilityField capabilityField(capability);
+    if (capabilityField.IsShortAddrAllocOn())
+    {
+        auto it = m_addresses.find(address);
+        if (it == m_addresses.end())
+        {
+            Mac16Address coordinatorAddress = m_coordinator->GetMac()->GetShortAddress();
+            Mac16Address shortAddress;
+            do
+            {
+                NS_ABORT_MSG_IF(m_nextShortAddress >= 0xfffe, "No short address left");
+                uint8_t buffer[2] = {static_cast<uint8_t>(m_nextShortAddress >> 8),
+                                     static_cast<uint8_t>(m_nextShortAddress & 0xff)};
+                shortAddress.CopyFrom(buffer);
+                m_nextShortAddress++;
+            } while (shortAddress == coordinatorAddress);
+            it = m_addresses.emplace(address, shortAddress).first;
+        }
+        params.m_assocShortAddr = it->second;
+    }
+    else
+    {
+        // The device keeps using its extended address (802.15.4-2011, 5.3.2.2)
+        params.m_assocShortAddr = Mac16Address("ff:fe");
+    }
+
+    m_admittedInSuperframe++;
+    m_stats.admitted++;
+    m_coordinator->GetMac()->MlmeAssociateResponse(params);
+}
+
+void
+LrWpanAssociationManager::UpdateBeaconPayload()
+{
+    uint32_t committed = m_admittedInSuperframe + m_pending.size();
+    uint8_t open = committed < m_budget ? m_budget - committed : 0;
+
+    std::vector<uint8_t> payload = {open,
+                                    static_cast<uint8_t>(std::lround(m_probability * 255))};
+    if (payload == m_beaconPayload)
+    {
+        // setting the payload invalidates the beacon template of the MAC
+        return;
+    }
+    m_beaconPayload = payload;
+
+    Ptr<lrwpan::MacPibAttributes> pib = Create<lrwpan::MacPibAttributes>();
+    pib->macBeaconPayload = payload;
+    m_coordinator->GetMac()->MlmeSetRequest(lrwpan::macBeaconPayload, pib);
+}
+
+void
+LrWpanAssociationManager::JoinerBeaconNotify(uint32_t index,
+                                             lrwpan::MlmeBeaconNotifyIndicationParams params)
+{
+    Joiner& joiner = m_joiners[index];
+    if (joiner.joined || joiner.requesting ||
+        params.m_panDescriptor.m_coorPanId != joiner.params.m_coordPanId)
+    {
+        return;
+    }
+
+    uint8_t budget;
+    double probability;
+    if (!ParseBeaconPayload(params.m_sdu, budget, probability) || budget == 0)
+    {
+        return;
+    }
+
+    probability /= 1 << std::min(joiner.failures, MAX_JOINER_BACKOFF);
+    if (m_random->GetValue() >= probability)
+    {
+        return;
+    }
+
+    NS_LOG_DEBUG("Joiner " << index << " requests association, attempt "
+                           << joiner.failures + 1);
+    joiner.requesting = true;
+    m_stats.attempts++;
+    Simulator::ScheduleNow(&lrwpan::LrWpanMac::MlmeAssociateRequest,
+                           joiner.device->GetMac(),
+                           joiner.params);
+}
+
+void
+LrWpanAssociationManager::JoinerAssociateConfirm(uint32_t index,
+                                                 lrwpan::MlmeAssociateConfirmParams params)
+{
+    Joiner& joiner = m_joiners[index];
+    joiner.requesting = false;
+    if (params.m_status == lrwpan::MacStatus::SUCCESS)
+    {
+        joiner.joined = true;
+        m_stats.joined++;
+        m_joinLatency.Record((Simulator::Now() - joiner.start).GetSeconds());
+    }
+    else
+    {
+        joiner.failures++;
+    }
+}
+
+void
+LrWpanAssociationManager::JoinerPollConfirm(uint32_t index, lrwpan::MlmePollConfirmParams params)
+{
+    // A failed data request ends the attempt without MLME-ASSOCIATE.confirm
+    Joiner& joiner = m_joiners[index];
+    if (joiner.requesting && params.m_status != lrwpan::MacStatus::SUCCESS)
+    {
+        joiner.requesting = false;
+        joiner.failures++;
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_ASSOCIATION_MANAGER_H
+#define LR_WPAN_ASSOCIATION_MANAGER_H
+
+#include <ns3/lr-wpan-latency-histogram.h>
+#include <ns3/lr-wpan-net-device.h>
+#include <ns3/mac16-address.h>
+#include <ns3/mac64-address.h>
+#include <ns3/nstime.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/sequence-number.h>
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Counters of a LrWpanAssociationManager.
+ */
+struct LrWpanAssociationStats
+{
+    uint64_t requests = 0;    //!< Association requests received by the coordinator
+    uint64_t admitted = 0;    //!< Association responses queued
+    uint64_t deferred = 0;    //!< Requests held over the budget of their superframe
+    uint64_t expired = 0;     //!< Held requests dropped, their device no longer waiting
+    uint64_t delivered = 0;   //!< Association responses acknowledged by their device
+    uint64_t undelivered = 0; //!< Association responses expired or not acknowledged
+    uint64_t attempts = 0;    //!< Association requests issued by the joiners
+    uint64_t joined = 0;      //!< Joiners associated
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Admission control of the association of many devices to a
+ *        beacon-enabled PAN coordinator.
+ *
+ * When a whole PAN powers up at once, the association requests and the data
+ * requests that fetch the responses collide in the CAP, and most devices
+ * retry after their response is lost. The manager answers the MLME-ASSOCIATE
+ * indications of the coordinator with a budget of admissions per superframe:
+ *
+ * - requests within the budget are answered at once; the others are held and
+ *   answered in a batch at the next beacons (the BeaconStart trace), oldest
+ *   first, as long as their device still waits for the response
+ *   (macResponseWaitTime); a repeated request refreshes the held one;
+ * - short addresses are allocated in sequence, and kept by a device that
+ *   asks again;
+ * - every beacon payload advertises the admissions still open in the
+ *   superframe and an access probability p, in two octets (see
+ *   ParseBeaconPayload).
+ *
+ * p is adapted per superframe like the access class barring of cellular
+ * networks: when more requests than the budget reached the coordinator, it
+ * is scaled down by budget / requests; when fewer did and no request is held,
+ * it is doubled.
+ *
+ * The joiners given to Join() follow the beacons: on each one with open
+ * admissions, a joiner requests association with probability p, halved by
+ * each of its failed attempts (at most four times), so that the collisions
+ * the coordinator cannot count also slow the storm down.
+ *
+ * The manager takes over the MLME-ASSOCIATE and MLME-COMM-STATUS callbacks of
+ * the coordinator and its beacon payload, and the MLME-BEACON-NOTIFY,
+ * MLME-ASSOCIATE.confirm and MLME-POLL.confirm callbacks of the joiners. It
+ * records the join latency, from Join() to the successful
+ * MLME-ASSOCIATE.confirm, and the admission delay, from the first request of
+ * a device received by the coordinator to the acknowledgment of its response.
+ */
+class LrWpanAssociationManager
+{
+  public:
+    LrWpanAssociationManager();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    LrWpanAssociationManager(const LrWpanAssociationManager&) = delete;
+    LrWpanAssociationManager& operator=(const LrWpanAssociationManager&) = delete;
+
+    /**
+     * \param budget the admissions per superframe, 1 to 255 (default 4)
+     */
+    void SetJoinBudget(uint8_t budget);
+
+    /**
+     * \param probability the access probability advertised before the first
+     *        adaptation, in (0, 1] (default 0.25)
+     */
+    void SetInitialAccessProbability(double probability);
+
+    /**
+     * \param stream the first stream index of the random variables
+     * \return the number of streams used
+     */
+    int64_t AssignStreams(int64_t stream);
+
+    /**
+     * \brief Manage the associations to a coordinator.
+     *
+     * To be called before the coordinator starts its beacons, with its short
+     * address set. The held requests must still be waited for at the next
+     * beacon: the beacon interval may not exceed macResponseWaitTime, 32 base
+     * superframes, so the beacon order must be at most 5. The simulation
+     * aborts at the first beacon otherwise.
+     *
+     * \param coordinator the PAN coordinator
+     */
+    void Install(Ptr<lrwpan::LrWpanNetDevice> coordinator);
+
+    /**
+     * \brief Start the association of a device to the managed coordinator.
+     *
+     * The device is tuned to the channel of params and listens to the beacons;
+     * to be called in the context of its node. The MLME-BEACON-NOTIFY,
+     * MLME-ASSOCIATE.confirm and MLME-POLL.confirm callbacks already set on
+     * the MAC of the device are replaced, not chained.
+     *
+     * \param device the joiner, not associated
+     * \param params the association request, as after a scan
+     */
+    void Join(Ptr<lrwpan::LrWpanNetDevice> device, lrwpan::MlmeAssociateRequestParams params);
+
+    /**
+     * \brief Read a beacon payload written by a manager.
+     * \param sdu the beacon payload
+     * \param budget the admissions still open in the superframe
+     * \param probability the access probability
+     * \return false if the payload is not the one of a manager
+     */
+    static bool ParseBeaconPayload(Ptr<const Packet> sdu, uint8_t& budget, double& probability);
+
+    /**
+     * \return the access probability in effect
+     */
+    double GetAccessProbability() const;
+
+    /**
+     * \return the number of requests held
+     */
+    uint32_t GetPendingCount() const;
+
+    /**
+     * \return the counters
+     */
+    const LrWpanAssociationStats& GetStats() const;
+
+    /**
+     * \return the join latencies of the joiners (s)
+     */
+    const lrwpan::LrWpanLatencyHistogram& GetJoinLatency() const;
+
+    /**
+     * \return the admission delays seen by the coordinator (s)
+     */
+    const lrwpan::LrWpanLatencyHistogram& GetAdmissionDelay() const;
+
+  private:
+    /**
+     * A request held over the budget.
+     */
+    struct PendingRequest
+    {
+        Mac64Address address; //!< Extended address of the device
+        uint8_t capability;   //!< Capability information of the request
+        Time received;        //!< Reception of the last request of the device
+    };
+
+    /**
+     * A device joining through Join().
+     */
+    struct Joiner
+    {
+        Ptr<lrwpan::LrWpanNetDevice> device;       //!< The device
+        lrwpan::MlmeAssociateRequestParams params; //!< Its association request
+        Time start;                                //!< Call of Join()
+        uint32_t failures;                         //!< Failed attempts
+        bool requesting;                           //!< An attempt is in progress
+        bool joined;                               //!< Associated
+    };
+
+    /**
+     * \param params the MLME-ASSOCIATE.indication of the coordinator
+     */
+    void AssociateIndication(lrwpan::MlmeAssociateIndicationParams params);
+
+    /**
+     * \param params the MLME-COMM-STATUS.indication of the coordinator
+     */
+    void CommStatusIndication(lrwpan::MlmeCommStatusIndicationParams params);
+
+    /**
+     * \param bsn the sequence number of the previous beacon
+     */
+    void BeaconStart(SequenceNumber8 bsn);
+
+    /**
+     * \brief Queue the association response of a device.
+     * \param address the extended address of the device
+     * \param capability the capability information of its request
+     */
+    void Admit(Mac64Address address, uint8_t capability);
+
+    /**
+     * \brief Advertise the open admissions and the access probability, if
+     *        they changed since the last beacon.
+     */
+    void UpdateBeaconPayload();
+
+    /**
+     * \param index the joiner
+     * \param params the MLME-BEACON-NOTIFY.indication of the joiner
+     */
+    void JoinerBeaconNotify(uint32_t index, lrwpan::MlmeBeaconNotifyIndicationParams params);
+
+    /**
+     * \param index the joiner
+     * \param params the MLME-ASSOCIATE.confirm of the joiner
+     */
+    void JoinerAssociateConfirm(uint32_t index, lrwpan::MlmeAssociateConfirmParams params);
+
+    /**
+     * \param index the joiner
+     * \param params the MLME-POLL.confirm of the joiner, for the data request
+     *        that fetches its association response
+     */
+    void JoinerPollConfirm(uint32_t index, lrwpan::MlmePollConfirmParams params);
+
+    Ptr<lrwpan::LrWpanNetDevice> m_coordinator;       //!< The managed coordinator
+    uint8_t m_budget;                                 //!< Admissions per superframe
+    uint8_t m_admittedInSuperframe;                   //!< Admissions of the current superframe
+    uint32_t m_requestsInSuperframe;                  //!< Requests of the current superframe
+    double m_probability;                             //!< Advertised access probability
+    bool m_started;                                   //!< A superframe is in progress
+    Time m_responseWaitTime;                          //!< How long a device waits for its response
+    uint16_t m_nextShortAddress;                      //!< Next short address to allocate
+    std::deque<PendingRequest> m_pending;             //!< Requests held, oldest first
+    std::map<Mac64Address, Mac16Address> m_addresses; //!< Allocated short addresses
+    std::map<Mac64Address, Time> m_firstRequest;      //!< First request of the devices not served
+    std::vector<Joiner> m_joiners;                    //!< Devices joining
+    std::vector<uint8_t> m_beaconPayload;             //!< Payload set in the coordinator MAC
+    Ptr<UniformRandomVariable> m_random;              //!< Access draws of the joiners
+    LrWpanAssociationStats m_stats;                   //!< Counters
+    lrwpan::LrWpanLatencyHistogram m_joinLatency;     //!< Join() to association
+    lrwpan::LrWpanLatencyHistogram m_admissionDelay;  //!< First request to acknowledged response
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_ASSOCIATION_MANAGER_H */
@@ -10,14 +10,18 @@
 #include "lr-wpan-helper.h"
 
 #include "ns3/names.h"
+#include <ns3/boolean.h>
 #include <ns3/log.h>
 #include <ns3/lr-wpan-csmaca.h>
 #include <ns3/lr-wpan-error-model.h>
 #include <ns3/lr-wpan-net-device.h>
+#include <ns3/lr-wpan-sleeping-phy-filter.h>
 #include <ns3/mobility-model.h>
 #include <ns3/multi-model-spectrum-channel.h>
 #include <ns3/single-model-spectrum-channel.h>
 
+#include <numeric>
+
 namespace ns3
 {
 
@@ -52,17 +56,23 @@ AsciiLrWpanMacTransmitSinkWithoutContext(Ptr<OutputStreamWrapper> stream, Ptr<co
 LrWpanHelper::LrWpanHelper()
 {
     m_useMultiModelSpectrumChannel = false;
+    SetCsmaCa("ns3::lrwpan::LrWpanCsmaCa");
 }
 
 LrWpanHelper::LrWpanHelper(bool useMultiModelSpectrumChannel)
 {
     m_useMultiModelSpectrumChannel = useMultiModelSpectrumChannel;
+    SetCsmaCa("ns3::lrwpan::LrWpanCsmaCa");
 }
 
 LrWpanHelper::~LrWpanHelper()
 {
-    m_channel->Dispose();
-    m_channel = nullptr;
+    // the channel is only created by Install or InstallStarPan
+    if (m_channel)
+    {
+        m_channel->Dispose();
+        m_channel = nullptr;
+    }
 }
 
 void
@@ -140,8 +150,8 @@ LrWpanHelper::AddMobility(Ptr<lrwpan::LrWpanPhy> phy, Ptr<MobilityModel> m)
     phy->SetMobility(m);
 }
 
-NetDeviceContainer
-LrWpanHelper::Install(NodeContainer c)
+void
+LrWpanHelper::PrepareChannel()
 {
     if (!m_channel)
     {
@@ -181,6 +191,12 @@ LrWpanHelper::Install(NodeContainer c)
             NS_FATAL_ERROR("No propagation loss model added to the channel");
         }
     }
+}
+
+NetDeviceContainer
+LrWpanHelper::Install(NodeContainer c)
+{
+    PrepareChannel();
 
     NetDeviceContainer devices;
     for (auto i = c.Begin(); i != c.End(); i++)
@@ -281,6 +297,152 @@ LrWpanHelper::CreateAssociatedPan(NetDeviceContainer c, uint16_t panId)
     }
 }
 
+NetDeviceContainer
+LrWpanHelper::InstallStarPan(NodeContainer c,
+                             uint16_t panId,
+                             const std::vector<uint32_t>& nodesPerTp)
+{
+    NS_ABORT_MSG_IF(nodesPerTp.size() > 8, "Only 8 TPs supported");
+    uint32_t count = 1 + std::accumulate(nodesPerTp.begin(), nodesPerTp.end(), 0U);
+    NS_ABORT_MSG_IF(c.GetN() != count,
+                    "The PAN needs " << count << " nodes, the coordinator first, not "
+                                     << c.GetN());
+    NS_ABORT_MSG_IF(count > 0xFFFD, "Only 65533 addresses supported. Range [00:01]-[FF:FD]");
+
+    PrepareChannel();
+
+    NetDeviceContainer devices;
+    uint8_t idBuf[2] = {0, 0};
+    uint8_t idBuf2[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    Mac16Address address16;
+    Mac64Address address64;
+    Mac16Address coordShortAddr;
+    Mac64Address coordExtAddr;
+
+    uint8_t deviceTp = 0;
+    uint32_t tpLeft = nodesPerTp.empty() ? 0 : nodesPerTp[0];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint16_t id = i + 1;
+        idBuf[0] = (id >> 8) & 0xff;
+        idBuf[1] = (id >> 0) & 0xff;
+        address16.CopyFrom(idBuf);
+        idBuf2[6] = (id >> 8) & 0xff;
+        idBuf2[7] = (id >> 0) & 0xff;
+        address64.CopyFrom(idBuf2);
+
+        uint8_t tp;
+        Ptr<lrwpan::LrWpanCsmaCaCommon> csma;
+        if (i == 0)
+        {
+            // We use the first node as coordinator
+            coordShortAddr = address16;
+            coordExtAddr = address64;
+            tp = 7;
+            csma = CreateObject<lrwpan::LrWpanCsmaCa>(tp);
+        }
+        else
+        {
+            while (tpLeft == 0)
+            {
+                tpLeft = nodesPerTp[++deviceTp];
+            }
+            tpLeft--;
+            tp = deviceTp;
+            csma = m_csmaCa.Create<lrwpan::LrWpanCsmaCaCommon>();
+            csma->SetTP(tp);
+        }
+
+        // Everything but the node first, the device is wired when added to it.
+        Ptr<lrwpan::LrWpanNetDevice> netDevice = CreateObject<lrwpan::LrWpanNetDevice>();
+        netDevice->SetChannel(m_channel);
+        netDevice->SetCsmaCa(csma);
+        netDevice->GetMac()->SetCsmaCaOption(csma->GetCsmaOption());
+        netDevice->GetMac()->SetExtendedAddress(address64);
+        netDevice->SetPanAssociation(panId, coordExtAddr, coordShortAddr, address16);
+        c.Get(i)->AddDevice(netDevice);
+        // the MAC sets the priority of its PHY, known once wired
+        netDevice->GetMac()->setPriority(tp);
+
+        devices.Add(netDevice);
+    }
+    return devices;
+}
+
+void
+LrWpanHelper::StartSynchronizedPan(NetDeviceContainer c,
+                                   uint8_t beaconOrder,
+                                   uint8_t superframeOrder,
+                                   Time startTime)
+{
+    NS_ABORT_MSG_IF(beaconOrder >= 15 || superframeOrder > beaconOrder,
+                    "Invalid beacon order " << +beaconOrder << " or superframe order "
+                                            << +superframeOrder);
+    Ptr<lrwpan::LrWpanNetDevice> coord = DynamicCast<lrwpan::LrWpanNetDevice>(c.Get(0));
+    NS_ABORT_MSG_IF(!coord, "The PAN coordinator must be a LrWpanNetDevice");
+
+    // The superframe specification of the coordinator beacons
+    lrwpan::SuperframeField superframe;
+    superframe.SetBeaconOrder(beaconOrder);
+    superframe.SetSuperframeOrder(superframeOrder);
+    superframe.SetFinalCapSlot(15);
+    superframe.SetPanCoor(true);
+
+    // The devices first, to be tracking when the first beacon is sent
+    for (auto i = c.Begin() + 1; i != c.End(); i++)
+    {
+        Ptr<lrwpan::LrWpanNetDevice> device = DynamicCast<lrwpan::LrWpanNetDevice>(*i);
+        if (device)
+        {
+            Simulator::ScheduleWithContext(device->GetNode()->GetId(),
+                                           startTime,
+                                           &lrwpan::LrWpanMac::PresetSync,
+                                           device->GetMac(),
+                                           superframe);
+        }
+    }
+
+    lrwpan::MlmeStartRequestParams params;
+    params.m_panCoor = true;
+    params.m_PanId = coord->GetMac()->GetPanId();
+    params.m_bcnOrd = beaconOrder;
+    params.m_sfrmOrd = superframeOrder;
+    Simulator::ScheduleWithContext(coord->GetNode()->GetId(),
+                                   startTime,
+                                   &lrwpan::LrWpanMacBase::MlmeStartRequest,
+                                   coord->GetMac(),
+                                   params);
+}
+
+void
+LrWpanHelper::EnableInactiveSleep(NetDeviceContainer c, Time guardTime)
+{
+    for (auto i = c.Begin(); i != c.End(); i++)
+    {
+        Ptr<lrwpan::LrWpanNetDevice> device = DynamicCast<lrwpan::LrWpanNetDevice>(*i);
+        NS_ABORT_MSG_IF(!device, "Not a LrWpanNetDevice");
+        device->GetMac()->SetAttribute("InactiveSleep", BooleanValue(true));
+        device->GetMac()->SetAttribute("BeaconGuardTime", TimeValue(guardTime));
+
+        Ptr<SpectrumChannel> channel = DynamicCast<SpectrumChannel>(device->GetChannel());
+        if (!channel)
+        {
+            continue;
+        }
+        bool filtered = false;
+        for (Ptr<const SpectrumTransmitFilter> filter = channel->GetSpectrumTransmitFilter();
+             filter && !filtered;
+             filter = filter->GetNext())
+        {
+            filtered = DynamicCast<const lrwpan::LrWpanSleepingPhyFilter>(filter) != nullptr;
+        }
+        if (!filtered)
+        {
+            channel->AddSpectrumTransmitFilter(CreateObject<lrwpan::LrWpanSleepingPhyFilter>());
+        }
+    }
+}
+
 void
 LrWpanHelper::SetExtendedAddresses(NetDeviceContainer c)
 {
@@ -314,6 +476,19 @@ LrWpanHelper::SetExtendedAddresses(NetDeviceContainer c)
     }
 }
 
+void
+LrWpanHelper::InstallTraffic(NetDeviceContainer c, Ptr<lrwpan::LrWpanTrafficGenerator> generator)
+{
+    for (auto i = c.Begin(); i != c.End(); i++)
+    {
+        Ptr<lrwpan::LrWpanNetDevice> device = DynamicCast<lrwpan::LrWpanNetDevice>(*i);
+        if (device)
+        {
+            generator->Install(device);
+        }
+    }
+}
+
 /**
  * @brief Write a packet in a PCAP file
  * @param file the output file
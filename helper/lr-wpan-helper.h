@@ -12,6 +12,7 @@
 
 #include <ns3/lr-wpan-mac.h>
 #include <ns3/lr-wpan-phy.h>
+#include <ns3/lr-wpan-traffic-generator.h>
 #include <ns3/node-container.h>
 #include <ns3/trace-helper.h>
 
@@ -94,6 +95,17 @@ class LrWpanHelper : public PcapHelperForDevice, public AsciiTraceHelperForDevic
     template <typename... Ts>
     void SetPropagationDelayModel(std::string name, Ts&&... args);
 
+    /**
+     * \tparam Ts \deduced Argument types
+     * \param name the TypeId of the CSMA/CA variant, e.g. "ns3::lrwpan::LrWpanCsmaCaNoba"
+     * \param [in] args Name and AttributeValue pairs to set.
+     *
+     * Set the CSMA/CA variant, and its attributes, installed on the devices of the PANs built
+     * by InstallStarPan. The default is the IEEE 802.15.4 CSMA/CA (LrWpanCsmaCa).
+     */
+    template <typename... Ts>
+    void SetCsmaCa(std::string name, Ts&&... args);
+
     /**
      * \brief Add mobility model to a physical device
      * \param phy the physical device
@@ -128,6 +140,63 @@ class LrWpanHelper : public PcapHelperForDevice, public AsciiTraceHelperForDevic
      */
     void CreateAssociatedPan(NetDeviceContainer c, uint16_t panId);
 
+    /**
+     * \brief Build a star PAN in one pass: install a LrWpanNetDevice in each node, as
+     *        Install does, and associate it, as CreateAssociatedPan does, with its TP
+     *        and CSMA/CA variant (see SetCsmaCa) set.
+     *
+     * The first node becomes the PAN coordinator, which runs the IEEE 802.15.4 CSMA/CA
+     * with TP 7. The nodesPerTp[0] following nodes get TP 0, the nodesPerTp[1] next ones
+     * TP 1, and so on. Each device is configured before it is added to its node, so that
+     * it is wired to its channel, MAC, PHY and CSMA/CA once.
+     *
+     * Several PANs built by the same helper share its channel. The coordinator is not
+     * started: its MLME-START.request is left to the caller.
+     *
+     * \param c The nodes of the PAN, the coordinator first, 1 + the sum of nodesPerTp of them.
+     * \param panId The PAN identifier.
+     * \param nodesPerTp The number of devices of each TP, at most 8 entries.
+     * \returns A container holding the coordinator then the devices.
+     */
+    NetDeviceContainer InstallStarPan(NodeContainer c,
+                                      uint16_t panId,
+                                      const std::vector<uint32_t>& nodesPerTp);
+
+    /**
+     * \brief Start a beacon-enabled PAN whose devices are already synchronized to
+     *        its superframe, without scanning and associating.
+     *
+     * At the start time, every device is put in the beacon tracking state of a
+     * completed MLME-SYNC.request with the superframe of the coordinator preloaded
+     * (see lrwpan::LrWpanMac::PresetSync), then the coordinator is started with an
+     * MLME-START.request. The first CAP of every device starts with the first beacon.
+     *
+     * \param c The NetDevice container of an associated PAN, the PAN coordinator first
+     *          (see CreateAssociatedPan and InstallStarPan).
+     * \param beaconOrder The beacon order, below 15.
+     * \param superframeOrder The superframe order, at most the beacon order.
+     * \param startTime The time the coordinator starts the superframe.
+     */
+    void StartSynchronizedPan(NetDeviceContainer c,
+                              uint8_t beaconOrder,
+                              uint8_t superframeOrder,
+                              Time startTime);
+
+    /**
+     * \brief Turn the transceivers of a group of LrWpanNetDevices off in the
+     *        inactive periods of their incoming superframe.
+     *
+     * Each device wakes guardTime before the expected beacon, the window
+     * widening with each beacon missed in a row (see
+     * lrwpan::LrWpanMac::GetSleepEnd). The channels of the devices get a
+     * lrwpan::LrWpanSleepingPhyFilter, so that the signals that end while a
+     * device sleeps are not delivered to it.
+     *
+     * \param c The NetDevice container, the PAN coordinator left out.
+     * \param guardTime The time the receiver is turned on before an expected beacon.
+     */
+    void EnableInactiveSleep(NetDeviceContainer c, Time guardTime);
+
     /**
      * \brief Set the extended 64 bit addresses (EUI-64) for a group of
      *        LrWpanNetDevices
@@ -137,6 +206,16 @@ class LrWpanHelper : public PcapHelperForDevice, public AsciiTraceHelperForDevic
      */
     void SetExtendedAddresses(NetDeviceContainer c);
 
+    /**
+     * \brief Drive a group of LrWpanNetDevices with a traffic generator, each
+     *        device with the source of its TP (see
+     *        lrwpan::LrWpanTrafficGenerator::SetSource).
+     *
+     * \param c The NetDevice container, without the PAN coordinator.
+     * \param generator The traffic generator, to be started.
+     */
+    void InstallTraffic(NetDeviceContainer c, Ptr<lrwpan::LrWpanTrafficGenerator> generator);
+
     /**
      * Helper to enable all LrWpan log components with one statement
      */
@@ -170,6 +249,12 @@ class LrWpanHelper : public PcapHelperForDevice, public AsciiTraceHelperForDevic
     int64_t AssignStreams(NetDeviceContainer c, int64_t stream);
 
   private:
+    /**
+     * \brief Create the channel with its propagation models if it is not set, or check
+     *        that the set channel has them.
+     */
+    void PrepareChannel();
+
     /**
      * \brief Enable pcap output on the indicated net device.
      *
@@ -207,6 +292,7 @@ class LrWpanHelper : public PcapHelperForDevice, public AsciiTraceHelperForDevic
     bool m_useMultiModelSpectrumChannel; //!< indicates whether a MultiModelSpectrumChannel is used
     std::vector<ObjectFactory> m_propagationLoss; ///< vector of propagation loss models
     ObjectFactory m_propagationDelay;             ///< propagation delay model
+    ObjectFactory m_csmaCa;                       ///< CSMA/CA variant of InstallStarPan
 };
 
 /***************************************************************
@@ -227,6 +313,13 @@ LrWpanHelper::SetPropagationDelayModel(std::string name, Ts&&... args)
     m_propagationDelay = ObjectFactory(name, std::forward<Ts>(args)...);
 }
 
+template <typename... Ts>
+void
+LrWpanHelper::SetCsmaCa(std::string name, Ts&&... args)
+{
+    m_csmaCa = ObjectFactory(name, std::forward<Ts>(args)...);
+}
+
 } // namespace ns3
 
 #endif /* LR_WPAN_HELPER_H */
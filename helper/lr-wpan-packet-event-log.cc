@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-packet-event-log.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-mac-header.h>
+#include <ns3/lr-wpan-net-device.h>
+#include <ns3/node.h>
+#include <ns3/simulator.h>
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanPacketEventLog");
+
+/// File magic
+static const char EVENT_LOG_MAGIC[8] = {'L', 'W', 'P', 'E', 'V', 'L', 'O', 'G'};
+/// File format version
+static constexpr uint32_t EVENT_LOG_VERSION = 2;
+/// Number of columns of a block
+static constexpr uint32_t EVENT_LOG_COLUMNS = 10;
+
+/**
+ * \param bytes a column size
+ * \return the size padded to 8 bytes
+ */
+static std::size_t
+Pad8(std::size_t bytes)
+{
+    return (bytes + 7) & ~std::size_t(7);
+}
+
+/**
+ * \param count the number of records of a block
+ * \return the size of the columns of the block
+ */
+static std::size_t
+BlockBytes(uint32_t count)
+{
+    return 4 * Pad8(count * sizeof(int64_t)) + Pad8(count * sizeof(uint32_t)) +
+           Pad8(count * sizeof(uint16_t)) + 4 * Pad8(count * sizeof(uint8_t));
+}
+
+LrWpanPacketEventLog::LrWpanPacketEventLog(std::string filename, uint32_t blockSize)
+    : m_blockSize(blockSize),
+      m_records(0)
+{
+    NS_ABORT_MSG_IF(blockSize == 0, "Empty event log blocks");
+    m_file.open(filename, std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!m_file, "Cannot open event log " << filename);
+    m_file.write(EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC));
+    m_file.write(reinterpret_cast<const char*>(&EVENT_LOG_VERSION), sizeof(uint32_t));
+    m_file.write(reinterpret_cast<const char*>(&EVENT_LOG_COLUMNS), sizeof(uint32_t));
+    m_block.reserve(blockSize);
+}
+
+LrWpanPacketEventLog::~LrWpanPacketEventLog()
+{
+    Close();
+}
+
+void
+LrWpanPacketEventLog::Install(NetDeviceContainer devices)
+{
+    for (auto i = devices.Begin(); i != devices.End(); i++)
+    {
+        Ptr<lrwpan::LrWpanNetDevice> dev = DynamicCast<lrwpan::LrWpanNetDevice>(*i);
+        NS_ABORT_MSG_IF(!dev, "Not a LrWpanNetDevice");
+        uint32_t node = dev->GetNode() ? dev->GetNode()->GetId() : dev->GetIfIndex();
+        Ptr<lrwpan::LrWpanMac> mac = dev->GetMac();
+
+        mac->TraceConnectWithoutContext(
+            "MacTxEnqueue",
+            Callback<void, Ptr<const Packet>, uint8_t>(
+                [this, node](Ptr<const Packet> p, uint8_t tp) { TxEnqueue(node, p, tp); }));
+        mac->TraceConnectWithoutContext(
+            "MacTx",
+            Callback<void, Ptr<const Packet>, uint8_t>(
+                [this, node](Ptr<const Packet> p, uint8_t) { Tx(node, p); }));
+        mac->TraceConnectWithoutContext(
+            "MacTxOk",
+            Callback<void, Ptr<const Packet>, uint8_t>([this, node](Ptr<const Packet> p, uint8_t) {
+                TxDone(node, p, OUTCOME_SUCCESS);
+            }));
+        mac->TraceConnectWithoutContext(
+            "MacTxDrop",
+            Callback<void, Ptr<const Packet>, uint8_t>([this, node](Ptr<const Packet> p, uint8_t) {
+                TxDone(node, p, OUTCOME_DROPPED);
+            }));
+        // the third argument of MacSentPkt counts CSMA/CA attempts, not CCAs
+        mac->TraceConnectWithoutContext(
+            "MacSentPkt",
+            Callback<void, Ptr<const Packet>, uint8_t, uint8_t>(
+                [this](Ptr<const Packet> p, uint8_t transmissions, uint8_t) {
+                    SentPkt(p, transmissions);
+                }));
+        dev->GetPhy()->TraceConnectWithoutContext(
+            "PhyCcaBegin",
+            Callback<void, Time>([this, node](Time) { CcaBegin(node); }));
+        mac->TraceConnectWithoutContext(
+            "MacRx",
+            Callback<void, Ptr<const Packet>, uint8_t>(
+                [this](Ptr<const Packet> p, uint8_t) { Rx(p); }));
+    }
+}
+
+void
+LrWpanPacketEventLog::TxEnqueue(uint32_t node, Ptr<const Packet> p, uint8_t tp)
+{
+    lrwpan::LrWpanMacHeader header;
+    p->PeekHeader(header);
+
+    Entry& e = m_pending[p->GetUid()];
+    e.node = node;
+    e.tp = tp;
+    e.seq = header.GetSeqNum();
+    e.outcome = OUTCOME_PENDING;
+    e.retries = 0;
+    e.cca = 0;
+    e.enqueue = Simulator::Now().GetNanoSeconds();
+    e.tx = -1;
+    e.ack = -1;
+    e.rx = -1;
+    e.txCount = 0;
+}
+
+void
+LrWpanPacketEventLog::Tx(uint32_t node, Ptr<const Packet> p)
+{
+    auto it = m_pending.find(p->GetUid());
+    if (it == m_pending.end())
+    {
+        // beacons, acknowledgments and commands: the CCAs were for a command
+        lrwpan::LrWpanMacHeader header;
+        p->PeekHeader(header);
+        if (header.IsCommand())
+        {
+            m_ccas[node] = 0;
+        }
+        return;
+    }
+    if (it->second.tx < 0)
+    {
+        it->second.tx = Simulator::Now().GetNanoSeconds();
+    }
+    it->second.txCount++;
+}
+
+void
+LrWpanPacketEventLog::CcaBegin(uint32_t node)
+{
+    m_ccas[node]++;
+}
+
+void
+LrWpanPacketEventLog::TxDone(uint32_t node, Ptr<const Packet> p, Outcome outcome)
+{
+    auto it = m_pending.find(p->GetUid());
+    if (it == m_pending.end() || it->second.outcome != OUTCOME_PENDING)
+    {
+        return;
+    }
+    Entry& e = it->second;
+    e.outcome = outcome;
+    if (outcome == OUTCOME_SUCCESS)
+    {
+        e.ack = Simulator::Now().GetNanoSeconds();
+    }
+    e.retries = e.txCount > 0 ? e.txCount - 1 : 0;
+    e.cca = m_ccas[node];
+    m_ccas[node] = 0;
+    // MacSentPkt, which reports the transmissions, follows within the same event.
+    Simulator::ScheduleNow(&LrWpanPacketEventLog::Finish, this, p->GetUid());
+}
+
+void
+LrWpanPacketEventLog::SentPkt(Ptr<const Packet> p, uint8_t transmissions)
+{
+    auto it = m_pending.find(p->GetUid());
+    if (it == m_pending.end())
+    {
+        return;
+    }
+    it->second.retries = transmissions > 0 ? transmissions - 1 : 0;
+}
+
+void
+LrWpanPacketEventLog::Rx(Ptr<const Packet> p)
+{
+    auto it = m_pending.find(p->GetUid());
+    if (it != m_pending.end() && it->second.rx < 0)
+    {
+        it->second.rx = Simulator::Now().GetNanoSeconds();
+    }
+}
+
+void
+LrWpanPacketEventLog::Finish(uint64_t uid)
+{
+    auto it = m_pending.find(uid);
+    if (it == m_pending.end())
+    {
+        return;
+    }
+    Append(it->second);
+    m_pending.erase(it);
+}
+
+void
+LrWpanPacketEventLog::Append(const Entry& entry)
+{
+    m_block.push_back(entry);
+    m_records++;
+    if (m_block.size() == m_blockSize)
+    {
+        WriteBlock();
+    }
+}
+
+void
+LrWpanPacketEventLog::WriteBlock()
+{
+    if (m_block.empty())
+    {
+        return;
+    }
+    uint32_t count = m_block.size();
+    std::vector<char> buffer(8 + BlockBytes(count), 0);
+    std::memcpy(buffer.data(), &count, sizeof(count));
+    char* column = buffer.data() + 8;
+
+    // Transpose the records into columns, in the order of the reader's Block.
+    auto put = [&column, count, this](auto field) {
+        using T = decltype(field(m_block[0]));
+        T* out = reinterpret_cast<T*>(column);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            out[i] = field(m_block[i]);
+        }
+        column += Pad8(count * sizeof(T));
+    };
+    put([](const Entry& e) { return e.enqueue; });
+    put([](const Entry& e) { return e.tx; });
+    put([](const Entry& e) { return e.ack; });
+    put([](const Entry& e) { return e.rx; });
+    put([](const Entry& e) { return e.node; });
+    put([](const Entry& e) { return e.cca; });
+    put([](const Entry& e) { return e.tp; });
+    put([](const Entry& e) { return e.seq; });
+    put([](const Entry& e) { return e.outcome; });
+    put([](const Entry& e) { return e.retries; });
+
+    m_file.write(buffer.data(), buffer.size());
+    m_block.clear();
+}
+
+void
+LrWpanPacketEventLog::Close()
+{
+    if (!m_file.is_open())
+    {
+        return;
+    }
+    for (const auto& [uid, entry] : m_pending)
+    {
+        Append(entry);
+    }
+    m_pending.clear();
+    WriteBlock();
+    m_file.close();
+}
+
+uint64_t
+LrWpanPacketEventLog::GetRecordCount() const
+{
+    return m_records;
+}
+
+LrWpanPacketEventLogReader::LrWpanPacketEventLogReader()
+    : m_data(nullptr),
+      m_size(0)
+{
+}
+
+LrWpanPacketEventLogReader::~LrWpanPacketEventLogReader()
+{
+    Close();
+}
+
+bool
+LrWpanPacketEventLogReader::Open(std::string filename)
+{
+    Close();
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size < 16)
+    {
+        close(fd);
+        return false;
+    }
+    m_size = st.st_size;
+    m_data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (m_data == MAP_FAILED)
+    {
+        m_data = nullptr;
+        return false;
+    }
+
+    const char* base = static_cast<const char*>(m_data);
+    uint32_t version;
+    uint32_t columns;
+    std::memcpy(&version, base + 8, sizeof(version));
+    std::memcpy(&columns, base + 12, sizeof(columns));
+    if (std::memcmp(base, EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC)) != 0 ||
+        version != EVENT_LOG_VERSION || columns != EVENT_LOG_COLUMNS)
+    {
+        Close();
+        return false;
+    }
+
+    std::size_t offset = 16;
+    while (offset + 8 <= m_size)
+    {
+        Block b;
+        std::memcpy(&b.count, base + offset, sizeof(b.count));
+        if (offset + 8 + BlockBytes(b.count) > m_size)
+        {
+            NS_LOG_WARN("Truncated block at offset " << offset << " ignored");
+            break;
+        }
+        const char* column = base + offset + 8;
+        auto get = [&column, &b](auto& out) {
+            out = reinterpret_cast<std::remove_reference_t<decltype(out)>>(column);
+            column += Pad8(b.count * sizeof(*out));
+        };
+        get(b.enqueue);
+        get(b.tx);
+        get(b.ack);
+        get(b.rx);
+        get(b.node);
+        get(b.ccaCount);
+        get(b.tp);
+        get(b.seq);
+        get(b.outcome);
+        get(b.retries);
+        m_blocks.push_back(b);
+        offset += 8 + BlockBytes(b.count);
+    }
+    return true;
+}
+
+void
+LrWpanPacketEventLogReader::Close()
+{
+    if (m_data)
+    {
+        munmap(m_data, m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_blocks.clear();
+}
+
+uint32_t
+LrWpanPacketEventLogReader::GetBlockCount() const
+{
+    return m_blocks.size();
+}
+
+const LrWpanPacketEventLogReader::Block&
+LrWpanPacketEventLogReader::GetBlock(uint32_t i) const
+{
+    NS_ASSERT(i < m_blocks.size());
+    return m_blocks[i];
+}
+
+uint64_t
+LrWpanPacketEventLogReader::GetRecordCount() const
+{
+    uint64_t count = 0;
+    for (const auto& b : m_blocks)
+    {
+        count += b.count;
+    }
+    return count;
+}
+
+} // namespace ns3
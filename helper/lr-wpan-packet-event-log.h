@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_PACKET_EVENT_LOG_H
+#define LR_WPAN_PACKET_EVENT_LOG_H
+
+#include <ns3/net-device-container.h>
+#include <ns3/packet.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Binary per-packet event log, one record per MAC data frame.
+ *
+ * Each record holds the transmitting node, its TP, the MAC sequence number,
+ * the enqueue, first transmission, acknowledgment and reception times, the
+ * number of retransmissions and of CCAs and the outcome. A record is
+ * assembled from the MAC traces of the transmitter (MacTxEnqueue, MacTx,
+ * MacTxOk, MacTxDrop, MacSentPkt) and of the receiver (MacRx), matched by
+ * packet uid, and written when the transmitter is done with the frame.
+ *
+ * The CCAs are counted from the PhyCcaBegin trace of the transmitter: every
+ * CCA of the frame in CSMA/CA, all its transmissions included, so two per
+ * attempt of a slotted CSMA/CA (CW = 2). The CCAs of a command frame are
+ * dropped when it is sent; those of a frame given up without a MacTxOk or
+ * MacTxDrop count for the next data frame of the device.
+ *
+ * Records are buffered and appended to the file in blocks. Inside a block
+ * every field is stored as a contiguous fixed-width column, so that
+ * LrWpanPacketEventLogReader can map the file and scan a column without
+ * parsing or copying anything. File layout, in host byte order:
+ *
+ * - header: "LWPEVLOG", uint32_t version, uint32_t column count
+ * - blocks: uint32_t record count, uint32_t reserved, then the columns in
+ *   the order of LrWpanPacketEventLogReader::Block, each padded to 8 bytes.
+ *
+ * Times are in nanoseconds, -1 when the event did not happen.
+ */
+class LrWpanPacketEventLog
+{
+  public:
+    /**
+     * The outcome of a frame.
+     */
+    enum Outcome : uint8_t
+    {
+        OUTCOME_PENDING = 0, //!< Still queued or in flight at the end of the log
+        OUTCOME_SUCCESS = 1, //!< Acknowledged
+        OUTCOME_DROPPED = 2, //!< Dropped by the transmitter
+    };
+
+    /**
+     * \param filename the log file, truncated if it exists
+     * \param blockSize the number of records per block
+     */
+    LrWpanPacketEventLog(std::string filename, uint32_t blockSize = 4096);
+
+    ~LrWpanPacketEventLog();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    LrWpanPacketEventLog(const LrWpanPacketEventLog&) = delete;
+    LrWpanPacketEventLog& operator=(const LrWpanPacketEventLog&) = delete;
+
+    /**
+     * \brief Log the frames sent and received by the devices.
+     * \param devices LrWpanNetDevice devices
+     */
+    void Install(NetDeviceContainer devices);
+
+    /**
+     * \brief Write the frames still in flight as pending, then close the file.
+     *
+     * Called by the destructor if needed.
+     */
+    void Close();
+
+    /**
+     * \return the number of records written or buffered
+     */
+    uint64_t GetRecordCount() const;
+
+  private:
+    /**
+     * The record of a frame being transmitted.
+     */
+    struct Entry
+    {
+        uint32_t node;    //!< Transmitting node id
+        uint8_t tp;       //!< Transmitter TP
+        uint8_t seq;      //!< MAC sequence number
+        uint8_t outcome;  //!< Outcome
+        uint8_t retries;  //!< Retransmissions
+        uint16_t cca;     //!< CCAs
+        int64_t enqueue;  //!< Enqueue time
+        int64_t tx;       //!< First transmission time
+        int64_t ack;      //!< Acknowledgment time
+        int64_t rx;       //!< Reception time
+        uint16_t txCount; //!< Transmissions seen so far
+    };
+
+    /**
+     * \param node the node id
+     * \param p the enqueued packet
+     * \param tp the TP of the transmitter
+     */
+    void TxEnqueue(uint32_t node, Ptr<const Packet> p, uint8_t tp);
+    /**
+     * \param node the node id
+     * \param p the transmitted packet
+     */
+    void Tx(uint32_t node, Ptr<const Packet> p);
+    /**
+     * \param node the node id of the device starting a CCA
+     */
+    void CcaBegin(uint32_t node);
+    /**
+     * \param node the node id
+     * \param p the packet
+     * \param outcome the outcome
+     */
+    void TxDone(uint32_t node, Ptr<const Packet> p, Outcome outcome);
+    /**
+     * \param p the packet
+     * \param transmissions the number of transmissions
+     */
+    void SentPkt(Ptr<const Packet> p, uint8_t transmissions);
+    /**
+     * \param p the received packet
+     */
+    void Rx(Ptr<const Packet> p);
+    /**
+     * \brief Move a finished frame to the current block.
+     * \param uid the packet uid
+     */
+    void Finish(uint64_t uid);
+    /**
+     * \param entry the record to append
+     */
+    void Append(const Entry& entry);
+    /**
+     * \brief Write the current block.
+     */
+    void WriteBlock();
+
+    std::ofstream m_file;                          //!< The log file
+    uint32_t m_blockSize;                          //!< Records per block
+    uint64_t m_records;                            //!< Records appended
+    std::unordered_map<uint64_t, Entry> m_pending; //!< Frames in flight, by packet uid
+    std::unordered_map<uint32_t, uint16_t> m_ccas; //!< CCAs of the frame in CSMA/CA, by node
+    std::vector<Entry> m_block;                    //!< The current block
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Zero-copy reader of the files written by LrWpanPacketEventLog.
+ *
+ * The file is memory mapped and the column pointers of every block point
+ * directly into the mapping, which stays valid until Close().
+ */
+class LrWpanPacketEventLogReader
+{
+  public:
+    /**
+     * The columns of one block, each with count elements.
+     */
+    struct Block
+    {
+        uint32_t count;           //!< Number of records
+        const int64_t* enqueue;   //!< Enqueue times (ns)
+        const int64_t* tx;        //!< First transmission times (ns), -1 if never sent
+        const int64_t* ack;       //!< Acknowledgment times (ns), -1 if not acknowledged
+        const int64_t* rx;        //!< Reception times (ns), -1 if not received
+        const uint32_t* node;     //!< Transmitting node ids
+        const uint16_t* ccaCount; //!< CCAs
+        const uint8_t* tp;        //!< Transmitter TPs
+        const uint8_t* seq;       //!< MAC sequence numbers
+        const uint8_t* outcome;   //!< LrWpanPacketEventLog::Outcome values
+        const uint8_t* retries;   //!< Retransmissions
+    };
+
+    LrWpanPacketEventLogReader();
+    ~LrWpanPacketEventLogReader();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    LrWpanPacketEventLogReader(const LrWpanPacketEventLogReader&) = delete;
+    LrWpanPacketEventLogReader& operator=(const LrWpanPacketEventLogReader&) = delete;
+
+    /**
+     * \brief Map a log file and index its blocks.
+     * \param filename the log file
+     * \return false if the file cannot be mapped or is not a valid log
+     */
+    bool Open(std::string filename);
+
+    /**
+     * \brief Unmap the file.
+     */
+    void Close();
+
+    /**
+     * \return the number of blocks
+     */
+    uint32_t GetBlockCount() const;
+
+    /**
+     * \param i the block index
+     * \return the block
+     */
+    const Block& GetBlock(uint32_t i) const;
+
+    /**
+     * \return the number of records in all blocks
+     */
+    uint64_t GetRecordCount() const;
+
+  private:
+    void* m_data;                //!< The mapping
+    std::size_t m_size;          //!< The mapping size
+    std::vector<Block> m_blocks; //!< The block index
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_PACKET_EVENT_LOG_H */
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-partition-helper.h"
+
+#include <ns3/abort.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-net-device.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-channel.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanPartitionHelper");
+
+LrWpanPartitionHelper::LrWpanPartitionHelper()
+    : m_maxLossDb(0),
+      m_maxWorkers(0),
+      m_run(1),
+      m_failed(0)
+{
+}
+
+void
+LrWpanPartitionHelper::AddPan(uint16_t panId, const std::vector<Vector>& positions)
+{
+    NS_ABORT_MSG_IF(positions.empty(), "PAN " << panId << " has no device");
+    NS_ABORT_MSG_IF(m_pans.count(panId), "PAN " << panId << " added twice");
+    m_pans[panId] = positions;
+}
+
+const std::vector<Vector>&
+LrWpanPartitionHelper::GetPositions(uint16_t panId) const
+{
+    auto it = m_pans.find(panId);
+    NS_ABORT_MSG_IF(it == m_pans.end(), "Unknown PAN " << panId);
+    return it->second;
+}
+
+void
+LrWpanPartitionHelper::SetPropagationLossModel(Ptr<PropagationLossModel> model)
+{
+    m_lossModel = model;
+}
+
+void
+LrWpanPartitionHelper::SetMaxLossDb(double maxLossDb)
+{
+    NS_ABORT_MSG_IF(maxLossDb <= 0, "Max loss must be positive: " << maxLossDb);
+    m_maxLossDb = maxLossDb;
+}
+
+void
+LrWpanPartitionHelper::SetMaxWorkers(uint32_t workers)
+{
+    m_maxWorkers = workers;
+}
+
+void
+LrWpanPartitionHelper::SetRun(uint32_t run)
+{
+    m_run = run;
+}
+
+NetDeviceContainer
+LrWpanPartitionHelper::InstallPan(LrWpanHelper& helper,
+                                  NodeContainer nodes,
+                                  uint16_t panId,
+                                  const std::vector<uint32_t>& nodesPerTp) const
+{
+    const std::vector<Vector>& positions = GetPositions(panId);
+    NS_ABORT_MSG_IF(nodes.GetN() != positions.size(),
+                    "PAN " << panId << " has " << positions.size() << " devices, not "
+                           << nodes.GetN());
+    NetDeviceContainer devices = helper.InstallStarPan(nodes, panId, nodesPerTp);
+    for (uint32_t i = 0; i < devices.GetN(); i++)
+    {
+        Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel>();
+        mobility->SetPosition(positions[i]);
+        helper.AddMobility(DynamicCast<lrwpan::LrWpanNetDevice>(devices.Get(i))->GetPhy(),
+                           mobility);
+    }
+    return devices;
+}
+
+int64_t
+LrWpanPartitionHelper::GetFirstStream(uint16_t panId)
+{
+    return panId * STREAMS_PER_PAN;
+}
+
+void
+LrWpanPartitionHelper::ConfigureChannel(Ptr<SpectrumChannel> channel) const
+{
+    NS_ABORT_MSG_IF(m_maxLossDb == 0, "The max loss of the cut is not set");
+    channel->SetAttribute("MaxLossDb", DoubleValue(m_maxLossDb));
+}
+
+uint32_t
+LrWpanPartitionHelper::GetFailedPartitions() const
+{
+    return m_failed;
+}
+
+bool
+LrWpanPartitionHelper::AreCoupled(Ptr<PropagationLossModel> lossModel,
+                                  const std::vector<Ptr<MobilityModel>>& a,
+                                  const std::vector<Ptr<MobilityModel>>& b) const
+{
+    for (const auto& ma : a)
+    {
+        for (const auto& mb : b)
+        {
+            // the channel computes the loss from the sender: check both ways
+            if (-lossModel->CalcRxPower(0, ma, mb) <= m_maxLossDb ||
+                -lossModel->CalcRxPower(0, mb, ma) <= m_maxLossDb)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::vector<LrWpanPartitionHelper::Partition>
+LrWpanPartitionHelper::GetPartitions() const
+{
+    NS_ABORT_MSG_IF(m_maxLossDb == 0, "The max loss of the cut is not set");
+    Ptr<PropagationLossModel> lossModel = m_lossModel;
+    if (!lossModel)
+    {
+        // the default loss model of LrWpanHelper::PrepareChannel()
+        lossModel = CreateObject<LogDistancePropagationLossModel>();
+    }
+
+    std::vector<uint16_t> panIds;
+    std::vector<std::vector<Ptr<MobilityModel>>> mobility;
+    for (const auto& [panId, positions] : m_pans)
+    {
+        panIds.push_back(panId);
+        mobility.emplace_back();
+        for (const auto& position : positions)
+        {
+            Ptr<ConstantPositionMobilityModel> m = CreateObject<ConstantPositionMobilityModel>();
+            m->SetPosition(position);
+            mobility.back().push_back(m);
+        }
+    }
+
+    // union-find of the coupled PANs, the root of a set is its smallest PAN
+    std::vector<std::size_t> parent(panIds.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](std::size_t i) {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (std::size_t i = 0; i < panIds.size(); i++)
+    {
+        for (std::size_t j = i + 1; j < panIds.size(); j++)
+        {
+            std::size_t ri = find(i);
+            std::size_t rj = find(j);
+            if (ri != rj && AreCoupled(lossModel, mobility[i], mobility[j]))
+            {
+                parent[std::max(ri, rj)] = std::min(ri, rj);
+            }
+        }
+    }
+
+    std::vector<Partition> partitions;
+    std::map<std::size_t, std::size_t> index; // by root
+    for (std::size_t i = 0; i < panIds.size(); i++)
+    {
+        std::size_t root = find(i);
+        auto it = index.find(root);
+        if (it == index.end())
+        {
+            it = index.emplace(root, partitions.size()).first;
+            partitions.push_back({{}, 0, 0, {}});
+        }
+        Partition& partition = partitions[it->second];
+        partition.panIds.push_back(panIds[i]);
+        partition.devices += static_cast<uint32_t>(mobility[i].size());
+    }
+    NS_LOG_INFO(m_pans.size() << " PANs in " << partitions.size() << " partitions");
+    return partitions;
+}
+
+std::vector<LrWpanPartitionHelper::Partition>
+LrWpanPartitionHelper::Run(PartitionFunction partition)
+{
+    std::vector<Partition> partitions = GetPartitions();
+
+    // the largest partitions first, so that the last workers are short
+    std::vector<std::size_t> order(partitions.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&partitions](std::size_t a, std::size_t b) {
+        return partitions[a].devices > partitions[b].devices;
+    });
+
+    LrWpanProcessPool pool(m_maxWorkers);
+    std::map<uint32_t, std::size_t> jobs;
+    for (std::size_t i : order)
+    {
+        std::vector<uint16_t> panIds = partitions[i].panIds;
+        uint32_t run = m_run;
+        uint32_t id = pool.AddTask([partition, panIds, run](int fd) {
+            RngSeedManager::SetRun(run);
+            LrWpanProcessPool::Records values = partition(panIds);
+            Simulator::Destroy();
+            LrWpanProcessPool::WriteRecords(fd, values);
+        });
+        jobs[id] = i;
+    }
+
+    m_failed = 0;
+    pool.SetCompletionCallback(LrWpanProcessPool::CompletionCallback(
+        [this, &jobs, &partitions](uint32_t id, int status, const std::string& output) {
+            Partition& p = partitions[jobs[id]];
+            p.status = status;
+            if (status != 0)
+            {
+                NS_LOG_WARN("Partition of PAN " << p.panIds.front() << " failed with status "
+                                                << status);
+                m_failed++;
+                return;
+            }
+            p.values = LrWpanProcessPool::ParseRecords(output);
+        }));
+    pool.Run();
+    return partitions;
+}
+
+LrWpanProcessPool::Records
+LrWpanPartitionHelper::Sum(const std::vector<Partition>& partitions)
+{
+    LrWpanProcessPool::Records sum;
+    for (const auto& partition : partitions)
+    {
+        if (partition.status != 0)
+        {
+            continue;
+        }
+        for (const auto& [name, value] : partition.values)
+        {
+            auto it = std::find_if(sum.begin(), sum.end(), [&name](const auto& record) {
+                return record.first == name;
+            });
+            if (it == sum.end())
+            {
+                sum.emplace_back(name, value);
+            }
+            else
+            {
+                it->second += value;
+            }
+        }
+    }
+    return sum;
+}
+
+} // namespace ns3
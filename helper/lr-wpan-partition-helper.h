@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_PARTITION_HELPER_H
+#define LR_WPAN_PARTITION_HELPER_H
+
+#include "lr-wpan-helper.h"
+#include "lr-wpan-process-pool.h"
+
+#include <ns3/net-device-container.h>
+#include <ns3/node-container.h>
+#include <ns3/ptr.h>
+#include <ns3/vector.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+class MobilityModel;
+class PropagationLossModel;
+class SpectrumChannel;
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Partitioned parallel execution of a site of PANs, with the signals
+ *        weaker than a max loss cut.
+ *
+ * A site is made of many PANs, each a coordinator and its devices at known
+ * positions. The helper cuts the channel at a max loss, SetMaxLossDb(), which
+ * has no default: a SpectrumChannel whose MaxLossDb attribute is set does
+ * not deliver the signals of a higher loss, so two devices beyond the cut
+ * neither hear nor disturb each other. The PANs are grouped in partitions,
+ * the connected components of their coupling: two PANs are coupled if some
+ * device of one is within the cut of some device of the other. No signal
+ * crosses a partition, so each one is simulated alone, on its own channel
+ * and simulator, and the site is the union of the partitions.
+ *
+ * The cut is an approximation of the site: the signals above it, far below
+ * the sensitivity but summed as interference by a channel without a cut, are
+ * lost, and the results change with it. Choose it where their sum is
+ * negligible against the thermal noise of the receivers, about -111 dBm
+ * over the 2 MHz of an O-QPSK 2.4 GHz channel: with 0 dBm transmitters, a
+ * cut of 120 dB keeps each dropped signal 10 dB below the noise, not their
+ * sum. The partitioned run reproduces a run of the whole site on one channel
+ * cut at the same loss, not a run without a cut.
+ *
+ * Each partition runs in a fork()ed worker of a LrWpanProcessPool, the
+ * largest first: the partition function builds the PANs it is given with
+ * InstallPan() on one channel, assigns their streams from GetFirstStream(),
+ * calls ConfigureChannel() on the channel, runs the simulator and returns
+ * its results as records. Every partition runs with the same RngRun, and a
+ * PAN draws from the streams of its PAN identifier: it draws the same
+ * numbers whatever its partition and the number of workers, or in a run of
+ * the whole site. The site runs as fast as its largest partition, on as many
+ * processors as it has partitions.
+ */
+class LrWpanPartitionHelper
+{
+  public:
+    /**
+     * The function of one partition: builds and simulates the PANs of the
+     * partition and returns its results. Executed in a worker process.
+     */
+    typedef std::function<LrWpanProcessPool::Records(const std::vector<uint16_t>&)>
+        PartitionFunction;
+
+    /**
+     * A partition of the site.
+     */
+    struct Partition
+    {
+        std::vector<uint16_t> panIds;      //!< The PANs, in increasing order
+        uint32_t devices;                  //!< The devices of the PANs
+        int status;                        //!< Exit status of the worker
+        LrWpanProcessPool::Records values; //!< Records returned by the partition function
+    };
+
+    /**
+     * The random variable streams reserved for each PAN, from GetFirstStream().
+     */
+    static constexpr int64_t STREAMS_PER_PAN = 1 << 20;
+
+    LrWpanPartitionHelper();
+
+    /**
+     * \brief Add a PAN to the site.
+     * \param panId the PAN identifier
+     * \param positions the positions of the devices, the coordinator first
+     */
+    void AddPan(uint16_t panId, const std::vector<Vector>& positions);
+
+    /**
+     * \param panId a PAN of the site
+     * \return the positions of its devices, the coordinator first
+     */
+    const std::vector<Vector>& GetPositions(uint16_t panId) const;
+
+    /**
+     * \param model the propagation loss model of the channel, used to couple
+     *        the PANs (default: a LogDistancePropagationLossModel, as
+     *        LrWpanHelper); it must be deterministic
+     */
+    void SetPropagationLossModel(Ptr<PropagationLossModel> model);
+
+    /**
+     * \param maxLossDb the loss of the cut, above which a signal is not
+     *        delivered, in dB; required
+     */
+    void SetMaxLossDb(double maxLossDb);
+
+    /**
+     * \param workers the maximum number of concurrent partitions, 0 for one per processor
+     */
+    void SetMaxWorkers(uint32_t workers);
+
+    /**
+     * \param run the RngRun of the partitions (default 1)
+     */
+    void SetRun(uint32_t run);
+
+    /**
+     * \brief Build a PAN of the site with LrWpanHelper::InstallStarPan, its
+     *        devices at their positions.
+     * \param helper the helper, whose channel gets the PAN
+     * \param nodes the nodes of the PAN, the coordinator first
+     * \param panId the PAN identifier
+     * \param nodesPerTp the number of devices of each TP
+     * \return the devices of the PAN
+     */
+    NetDeviceContainer InstallPan(LrWpanHelper& helper,
+                                  NodeContainer nodes,
+                                  uint16_t panId,
+                                  const std::vector<uint32_t>& nodesPerTp) const;
+
+    /**
+     * \param panId a PAN identifier
+     * \return the first of the STREAMS_PER_PAN streams of the PAN
+     */
+    static int64_t GetFirstStream(uint16_t panId);
+
+    /**
+     * \brief Cut a channel at the max loss.
+     * \param channel the channel of a partition, or of the whole site
+     */
+    void ConfigureChannel(Ptr<SpectrumChannel> channel) const;
+
+    /**
+     * \return the partitions of the site, in increasing order of their first PAN
+     */
+    std::vector<Partition> GetPartitions() const;
+
+    /**
+     * \brief Run every partition of the site.
+     * \param partition the partition function
+     * \return the partitions and their results, in the order of GetPartitions()
+     */
+    std::vector<Partition> Run(PartitionFunction partition);
+
+    /**
+     * \return the partitions of the last run whose worker failed
+     */
+    uint32_t GetFailedPartitions() const;
+
+    /**
+     * \brief Sum the results of the partitions.
+     * \param partitions the partitions of a run
+     * \return the sum of each record over the partitions that succeeded, in
+     *         the order the records first appear
+     */
+    static LrWpanProcessPool::Records Sum(const std::vector<Partition>& partitions);
+
+  private:
+    /**
+     * \param lossModel the propagation loss model
+     * \param a the mobility of the devices of a PAN
+     * \param b the mobility of the devices of another PAN
+     * \return true if a device of a is within the max loss of a device of b
+     */
+    bool AreCoupled(Ptr<PropagationLossModel> lossModel,
+                    const std::vector<Ptr<MobilityModel>>& a,
+                    const std::vector<Ptr<MobilityModel>>& b) const;
+
+    std::map<uint16_t, std::vector<Vector>> m_pans; //!< The device positions, by PAN
+    Ptr<PropagationLossModel> m_lossModel;          //!< Loss model of the channel
+    double m_maxLossDb;                             //!< Loss of the cut, 0 if not set
+    uint32_t m_maxWorkers;                          //!< Max concurrent workers
+    uint32_t m_run;                                 //!< RngRun of the partitions
+    uint32_t m_failed;                              //!< Failed partitions of the last run
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_PARTITION_HELPER_H */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-per-sweep-helper.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/simulator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <set>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanPerSweepHelper");
+
+LrWpanPerSweepHelper::LrWpanPerSweepHelper()
+    : m_min(0),
+      m_max(0),
+      m_step(1),
+      m_resolution(0),
+      m_threshold(0.05),
+      m_maxWorkers(0),
+      m_firstRun(1),
+      m_rounds(0),
+      m_failed(0)
+{
+}
+
+void
+LrWpanPerSweepHelper::SetRange(double min, double max, double step)
+{
+    NS_ABORT_MSG_IF(max < min, "Empty sweep range [" << min << ", " << max << "]");
+    NS_ABORT_MSG_IF(step <= 0, "Sweep step must be positive: " << step);
+    m_min = min;
+    m_max = max;
+    m_step = step;
+}
+
+void
+LrWpanPerSweepHelper::SetResolution(double resolution)
+{
+    NS_ABORT_MSG_IF(resolution < 0, "Sweep resolution must not be negative: " << resolution);
+    m_resolution = resolution;
+}
+
+void
+LrWpanPerSweepHelper::SetRefinementThreshold(double threshold)
+{
+    m_threshold = threshold;
+}
+
+void
+LrWpanPerSweepHelper::AddRefinementLevel(double level)
+{
+    m_levels.push_back(level);
+}
+
+void
+LrWpanPerSweepHelper::SetMaxWorkers(uint32_t workers)
+{
+    m_maxWorkers = workers;
+}
+
+void
+LrWpanPerSweepHelper::SetFirstRun(uint32_t run)
+{
+    m_firstRun = run;
+}
+
+uint32_t
+LrWpanPerSweepHelper::GetRounds() const
+{
+    return m_rounds;
+}
+
+uint32_t
+LrWpanPerSweepHelper::GetFailedPoints() const
+{
+    return m_failed;
+}
+
+std::vector<LrWpanPerSweepHelper::Point>
+LrWpanPerSweepHelper::Run(PointFunction point)
+{
+    double resolution = m_resolution > 0 ? std::min(m_resolution, m_step) : m_step;
+    // the small margin keeps max on the grid despite the rounding of the division
+    auto last = static_cast<int64_t>(std::floor((m_max - m_min) / resolution + 1e-9));
+    auto stride = std::max<int64_t>(1, std::llround(m_step / resolution));
+
+    std::vector<int64_t> indexes;
+    for (int64_t k = 0; k <= last; k += stride)
+    {
+        indexes.push_back(k);
+    }
+    if (indexes.back() != last)
+    {
+        indexes.push_back(last);
+    }
+
+    m_rounds = 0;
+    m_failed = 0;
+    std::map<int64_t, double> results;
+    std::set<int64_t> tried;
+    while (!indexes.empty())
+    {
+        m_rounds++;
+        tried.insert(indexes.begin(), indexes.end());
+        RunRound(point, resolution, indexes, results);
+
+        indexes.clear();
+        for (auto it = results.begin(); it != results.end() && std::next(it) != results.end();
+             ++it)
+        {
+            auto next = std::next(it);
+            int64_t middle = (it->first + next->first) / 2;
+            bool crossing = std::any_of(m_levels.begin(), m_levels.end(), [&](double level) {
+                return (it->second > level) != (next->second > level);
+            });
+            if (next->first - it->first > 1 &&
+                (std::abs(next->second - it->second) > m_threshold || crossing) &&
+                !tried.count(middle))
+            {
+                indexes.push_back(middle);
+            }
+        }
+        NS_LOG_INFO("Round " << m_rounds << ": " << results.size() << " points, "
+                             << indexes.size() << " to add");
+    }
+
+    std::vector<Point> points;
+    points.reserve(results.size());
+    for (const auto& [k, value] : results)
+    {
+        points.push_back({m_min + k * resolution, value});
+    }
+    return points;
+}
+
+void
+LrWpanPerSweepHelper::RunRound(PointFunction point,
+                               double resolution,
+                               const std::vector<int64_t>& indexes,
+                               std::map<int64_t, double>& results)
+{
+    LrWpanProcessPool pool(m_maxWorkers);
+    std::map<uint32_t, int64_t> jobs;
+    for (int64_t k : indexes)
+    {
+        double x = m_min + k * resolution;
+        uint32_t run = m_firstRun + static_cast<uint32_t>(k);
+        uint32_t id = pool.AddTask([point, x, run](int fd) {
+            RngSeedManager::SetRun(run);
+            double value = point(x);
+            Simulator::Destroy();
+            LrWpanProcessPool::WriteRecords(fd, {{"value", value}});
+        });
+        jobs[id] = k;
+    }
+
+    pool.SetCompletionCallback(LrWpanProcessPool::CompletionCallback(
+        [this, resolution, &jobs, &results](uint32_t id,
+                                            int status,
+                                            const std::string& output) {
+            int64_t k = jobs[id];
+            LrWpanProcessPool::Records records = LrWpanProcessPool::ParseRecords(output);
+            if (status != 0 || records.empty() || records.front().first != "value")
+            {
+                NS_LOG_WARN("Point " << m_min + k * resolution << " failed with status "
+                                     << status);
+                m_failed++;
+                return;
+            }
+            results[k] = records.front().second;
+        }));
+    pool.Run();
+}
+
+} // namespace ns3
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_PER_SWEEP_HELPER_H
+#define LR_WPAN_PER_SWEEP_HELPER_H
+
+#include "lr-wpan-process-pool.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Parallel, adaptively refined sweep of a packet success or error rate
+ *        over one variable (Rx signal, distance, ...).
+ *
+ * The points of a characterization curve are independent simulations. The
+ * helper runs each of them in a fork()ed worker of a LrWpanProcessPool: the
+ * point function builds its own topology, runs the simulator and returns the
+ * rate, which is sent back to the parent as a record. The simulator is
+ * destroyed by the worker, the parent never runs it.
+ *
+ * The points lie on a grid of spacing SetResolution() from the start of the
+ * range. The sweep starts with every SetRange() step, then refines in rounds:
+ * between two neighbouring points whose rates differ by more than
+ * SetRefinementThreshold(), the middle grid point is added, until the points
+ * are one resolution apart. The points thus gather in the transition of the
+ * curve, where the rate changes, and the flat parts keep the coarse step. The
+ * crossings of the levels given to AddRefinementLevel() are always refined.
+ *
+ * Each point runs with its own RngRun, the first run plus the index of the
+ * point on the grid, so its result does not depend on the number of workers,
+ * on the refinement round where it was added, nor on the other points.
+ */
+class LrWpanPerSweepHelper
+{
+  public:
+    /**
+     * The function of one point: simulates the point at x and returns its
+     * rate, in [0, 1]. Executed in a worker process.
+     */
+    typedef std::function<double(double)> PointFunction;
+
+    /**
+     * A point of the curve.
+     */
+    struct Point
+    {
+        double x;     //!< The swept variable
+        double value; //!< The rate returned by the point function
+    };
+
+    LrWpanPerSweepHelper();
+
+    /**
+     * \brief Set the range and the initial step of the sweep.
+     * \param min the first point
+     * \param max the last point (included if on the grid)
+     * \param step the spacing of the points of the first round
+     */
+    void SetRange(double min, double max, double step);
+
+    /**
+     * \param resolution the spacing of the grid, the finest refinement; 0 to
+     *        sweep only the initial step (default)
+     */
+    void SetResolution(double resolution);
+
+    /**
+     * \param threshold the rate difference between two neighbouring points
+     *        above which the interval is refined (default 0.05)
+     */
+    void SetRefinementThreshold(double threshold);
+
+    /**
+     * \brief Refine down to the resolution wherever the rate crosses a level.
+     *
+     * The interval between two neighbouring points whose rates lie on both
+     * sides of the level is refined whatever their difference, so that the
+     * crossing, e.g. the 1 % PER of the receive sensitivity, is located to the
+     * resolution even if it is smaller than the refinement threshold.
+     *
+     * \param level the rate whose crossing is located
+     */
+    void AddRefinementLevel(double level);
+
+    /**
+     * \param workers the maximum number of concurrent points, 0 for one per processor
+     */
+    void SetMaxWorkers(uint32_t workers);
+
+    /**
+     * \param run the RngRun of the first grid point (default 1)
+     */
+    void SetFirstRun(uint32_t run);
+
+    /**
+     * \brief Run the sweep.
+     * \param point the point function
+     * \return the points, in increasing order of x
+     */
+    std::vector<Point> Run(PointFunction point);
+
+    /**
+     * \return the refinement rounds of the last sweep, the first one included
+     */
+    uint32_t GetRounds() const;
+
+    /**
+     * \return the points of the last sweep whose worker failed
+     */
+    uint32_t GetFailedPoints() const;
+
+  private:
+    /**
+     * \brief Simulate points in parallel.
+     * \param point the point function
+     * \param resolution the spacing of the grid
+     * \param indexes the grid indexes of the points
+     * \param results the rates, by grid index
+     */
+    void RunRound(PointFunction point,
+                  double resolution,
+                  const std::vector<int64_t>& indexes,
+                  std::map<int64_t, double>& results);
+
+    double m_min;                 //!< First point
+    double m_max;                 //!< Last point
+    double m_step;                //!< Initial step
+    double m_resolution;          //!< Grid spacing
+    double m_threshold;           //!< Refinement threshold
+    std::vector<double> m_levels; //!< Rates whose crossings are always refined
+    uint32_t m_maxWorkers;        //!< Max concurrent workers
+    uint32_t m_firstRun;          //!< RngRun of the grid index 0
+    uint32_t m_rounds;            //!< Rounds of the last sweep
+    uint32_t m_failed;            //!< Failed points of the last sweep
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_PER_SWEEP_HELPER_H */
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-process-pool.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iomanip>
+#include <iostream>
+#include <poll.h>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanProcessPool");
+
+LrWpanProcessPool::LrWpanProcessPool(uint32_t maxWorkers)
+    : m_maxWorkers(maxWorkers),
+      m_nextId(0),
+      m_quiet(false)
+{
+    if (m_maxWorkers == 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        m_maxWorkers = cpus > 0 ? static_cast<uint32_t>(cpus) : 1;
+    }
+}
+
+LrWpanProcessPool::~LrWpanProcessPool()
+{
+    for (auto& [pid, worker] : m_running)
+    {
+        if (worker.fd >= 0)
+        {
+            close(worker.fd);
+        }
+        kill(pid, SIGTERM);
+        waitpid(pid, nullptr, 0);
+    }
+}
+
+uint32_t
+LrWpanProcessPool::AddCommand(const std::vector<std::string>& argv)
+{
+    NS_ASSERT_MSG(!argv.empty(), "Empty command line");
+    Job job;
+    job.id = m_nextId++;
+    job.argv = argv;
+    m_pending.push_back(std::move(job));
+    return m_pending.back().id;
+}
+
+uint32_t
+LrWpanProcessPool::AddTask(Task task)
+{
+    Job job;
+    job.id = m_nextId++;
+    job.task = std::move(task);
+    m_pending.push_back(std::move(job));
+    return m_pending.back().id;
+}
+
+void
+LrWpanProcessPool::SetCompletionCallback(CompletionCallback cb)
+{
+    m_completionCallback = cb;
+}
+
+void
+LrWpanProcessPool::SetQuiet(bool quiet)
+{
+    m_quiet = quiet;
+}
+
+uint32_t
+LrWpanProcessPool::GetMaxWorkers() const
+{
+    return m_maxWorkers;
+}
+
+uint32_t
+LrWpanProcessPool::GetPendingJobs() const
+{
+    return m_pending.size();
+}
+
+void
+LrWpanProcessPool::Spawn(Job& job)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        NS_FATAL_ERROR("pipe() failed: " << std::strerror(errno));
+    }
+
+    // Do not let the child inherit unflushed parent output.
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        NS_FATAL_ERROR("fork() failed: " << std::strerror(errno));
+    }
+
+    if (pid == 0)
+    {
+        // Worker process. Never return to the caller: static destructors and
+        // the simulator state belong to the parent.
+        close(fds[0]);
+        for (const auto& [otherPid, worker] : m_running)
+        {
+            if (worker.fd >= 0)
+            {
+                close(worker.fd);
+            }
+        }
+
+        if (m_quiet)
+        {
+            int devNull = open("/dev/null", O_WRONLY);
+            if (devNull >= 0)
+            {
+                dup2(devNull, STDOUT_FILENO);
+                dup2(devNull, STDERR_FILENO);
+                close(devNull);
+            }
+        }
+
+        if (job.argv.empty())
+        {
+            job.task(fds[1]);
+            std::cout.flush();
+            std::fflush(nullptr);
+            close(fds[1]);
+            _exit(0);
+        }
+
+        if (fds[1] != RESULT_FD)
+        {
+            dup2(fds[1], RESULT_FD);
+            close(fds[1]);
+        }
+        std::vector<char*> args;
+        args.reserve(job.argv.size() + 1);
+        for (auto& arg : job.argv)
+        {
+            args.push_back(arg.data());
+        }
+        args.push_back(nullptr);
+        execvp(args[0], args.data());
+        std::fprintf(stderr, "execvp(%s) failed: %s\n", args[0], std::strerror(errno));
+        _exit(127);
+    }
+
+    close(fds[1]);
+    NS_LOG_DEBUG("Started job " << job.id << " as pid " << pid);
+
+    Worker worker;
+    worker.id = job.id;
+    worker.fd = fds[0];
+    m_running.emplace(pid, std::move(worker));
+}
+
+void
+LrWpanProcessPool::Poll()
+{
+    std::vector<pollfd> pfds;
+    std::vector<int> pids;
+    pfds.reserve(m_running.size());
+    pids.reserve(m_running.size());
+    for (const auto& [pid, worker] : m_running)
+    {
+        if (worker.fd >= 0)
+        {
+            pfds.push_back({worker.fd, POLLIN, 0});
+            pids.push_back(pid);
+        }
+    }
+
+    // Workers which closed their pipe are reaped below; keep a short timeout so
+    // that a worker closing its pipe before exiting does not stall the pool.
+    int timeout = pfds.size() == m_running.size() ? -1 : 50;
+    int ready = poll(pfds.data(), pfds.size(), timeout);
+    if (ready < 0 && errno != EINTR)
+    {
+        NS_FATAL_ERROR("poll() failed: " << std::strerror(errno));
+    }
+
+    char buf[4096];
+    for (std::size_t i = 0; ready > 0 && i < pfds.size(); i++)
+    {
+        if (pfds[i].revents == 0)
+        {
+            continue;
+        }
+        Worker& worker = m_running[pids[i]];
+        ssize_t n = read(worker.fd, buf, sizeof(buf));
+        if (n > 0)
+        {
+            worker.output.append(buf, n);
+        }
+        else if (n == 0 || errno != EINTR)
+        {
+            close(worker.fd);
+            worker.fd = -1;
+        }
+    }
+
+    for (auto it = m_running.begin(); it != m_running.end();)
+    {
+        if (it->second.fd >= 0)
+        {
+            ++it;
+            continue;
+        }
+        int wstatus = 0;
+        pid_t r = waitpid(it->first, &wstatus, WNOHANG);
+        if (r == 0)
+        {
+            ++it;
+            continue;
+        }
+        int status = -1;
+        if (r > 0 && WIFEXITED(wstatus))
+        {
+            status = WEXITSTATUS(wstatus);
+        }
+        uint32_t id = it->second.id;
+        std::string output = std::move(it->second.output);
+        it = m_running.erase(it);
+
+        NS_LOG_DEBUG("Job " << id << " terminated with status " << status);
+        if (!m_completionCallback.IsNull())
+        {
+            m_completionCallback(id, status, output);
+        }
+    }
+}
+
+void
+LrWpanProcessPool::Run()
+{
+    while (!m_pending.empty() || !m_running.empty())
+    {
+        while (!m_pending.empty() && m_running.size() < m_maxWorkers)
+        {
+            Job job = std::move(m_pending.front());
+            m_pending.pop_front();
+            Spawn(job);
+        }
+        Poll();
+    }
+}
+
+bool
+LrWpanProcessPool::WriteRecords(int fd, const Records& records)
+{
+    std::ostringstream oss;
+    oss << std::setprecision(17);
+    for (const auto& [name, value] : records)
+    {
+        oss << name << ' ' << value << '\n';
+    }
+
+    std::string data = oss.str();
+    std::size_t written = 0;
+    while (written < data.size())
+    {
+        ssize_t n = write(fd, data.data() + written, data.size() - written);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        written += n;
+    }
+    return true;
+}
+
+LrWpanProcessPool::Records
+LrWpanProcessPool::ParseRecords(const std::string& output)
+{
+    Records records;
+    std::istringstream iss(output);
+    std::string line;
+    while (std::getline(iss, line))
+    {
+        std::istringstream ls(line);
+        std::string name;
+        double value;
+        if (ls >> name >> value)
+        {
+            records.emplace_back(name, value);
+        }
+    }
+    return records;
+}
+
+} // namespace ns3
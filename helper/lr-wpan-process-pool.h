@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_PROCESS_POOL_H
+#define LR_WPAN_PROCESS_POOL_H
+
+#include <ns3/callback.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Runs independent simulation jobs on a bounded pool of worker processes.
+ *
+ * ns-3 simulations are single threaded and keep their state in globals, so
+ * independent runs (replications, sweep points, PER points) are executed in
+ * separate processes. Each job is either a command line executed with execvp()
+ * or a function executed in a fork()ed copy of the caller. A job reports its
+ * results through a pipe using a line oriented "name value" record format
+ * (see WriteRecords() and ParseRecords()); for command jobs the write end of
+ * the pipe is always available as file descriptor RESULT_FD.
+ *
+ * Jobs are dispatched in submission order to whichever worker becomes free
+ * first, so long and short jobs balance themselves across the pool.
+ */
+class LrWpanProcessPool
+{
+  public:
+    /**
+     * The file descriptor where command jobs find the result pipe.
+     */
+    static constexpr int RESULT_FD = 3;
+
+    /**
+     * A list of named values reported by a job.
+     */
+    typedef std::vector<std::pair<std::string, double>> Records;
+
+    /**
+     * A function executed in a forked worker. The argument is the write end of the
+     * result pipe.
+     */
+    typedef std::function<void(int)> Task;
+
+    /**
+     * Callback invoked in the parent when a job has finished.
+     * Arguments: job id, exit status (-1 if killed by a signal), raw pipe output.
+     */
+    typedef Callback<void, uint32_t, int, const std::string&> CompletionCallback;
+
+    /**
+     * \brief Create a pool.
+     * \param maxWorkers the maximum number of concurrent workers, 0 selects the
+     *        number of online processors.
+     */
+    LrWpanProcessPool(uint32_t maxWorkers = 0);
+    ~LrWpanProcessPool();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    LrWpanProcessPool(const LrWpanProcessPool&) = delete;
+    LrWpanProcessPool& operator=(const LrWpanProcessPool&) = delete;
+
+    /**
+     * \brief Queue the execution of an external program.
+     * \param argv the program (argv[0], searched in PATH) followed by its arguments
+     * \return the job id
+     */
+    uint32_t AddCommand(const std::vector<std::string>& argv);
+
+    /**
+     * \brief Queue the execution of a function in a forked worker.
+     * \param task the function to run; the worker exits when it returns
+     * \return the job id
+     */
+    uint32_t AddTask(Task task);
+
+    /**
+     * \param cb the callback fired each time a job terminates
+     */
+    void SetCompletionCallback(CompletionCallback cb);
+
+    /**
+     * \param quiet if true, the standard output and error of the workers are
+     *        redirected to /dev/null
+     */
+    void SetQuiet(bool quiet);
+
+    /**
+     * \return the maximum number of concurrent workers
+     */
+    uint32_t GetMaxWorkers() const;
+
+    /**
+     * \return the number of queued jobs which have not been started yet
+     */
+    uint32_t GetPendingJobs() const;
+
+    /**
+     * \brief Run all queued jobs and block until they have terminated.
+     *
+     * Jobs may be added from the completion callback.
+     */
+    void Run();
+
+    /**
+     * \brief Write a list of records to a file descriptor.
+     * \param fd the destination file descriptor
+     * \param records the records to write
+     * \return true if all the data was written
+     */
+    static bool WriteRecords(int fd, const Records& records);
+
+    /**
+     * \brief Parse the output of a job into records. Malformed lines are ignored.
+     * \param output the raw pipe output
+     * \return the parsed records, in order of appearance
+     */
+    static Records ParseRecords(const std::string& output);
+
+  private:
+    /**
+     * A queued job.
+     */
+    struct Job
+    {
+        uint32_t id;                   //!< The job id
+        std::vector<std::string> argv; //!< The command line (empty for task jobs)
+        Task task;                     //!< The task (only for task jobs)
+    };
+
+    /**
+     * A running job.
+     */
+    struct Worker
+    {
+        uint32_t id;        //!< The job id
+        int fd;             //!< Read end of the result pipe, -1 once closed
+        std::string output; //!< Data read so far
+    };
+
+    /**
+     * \brief Fork a worker for a job.
+     * \param job the job to start
+     */
+    void Spawn(Job& job);
+
+    /**
+     * \brief Read available data from the workers, reap terminated ones.
+     */
+    void Poll();
+
+    uint32_t m_maxWorkers;                //!< Maximum number of concurrent workers
+    uint32_t m_nextId;                    //!< Id of the next queued job
+    bool m_quiet;                         //!< Silence the worker output
+    std::deque<Job> m_pending;            //!< Jobs not yet started
+    std::map<int, Worker> m_running;      //!< Running workers, indexed by pid
+    CompletionCallback m_completionCallback; //!< Job completion callback
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_PROCESS_POOL_H */
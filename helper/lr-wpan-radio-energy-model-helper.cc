@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-radio-energy-model-helper.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-net-device.h>
+#include <ns3/simulator.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanRadioEnergyModelHelper");
+
+LrWpanRadioEnergyModelHelper::LrWpanRadioEnergyModelHelper()
+    : m_hasTransceiver(false),
+      m_transceiver(lrwpan::LrWpanRadioEnergyModel::CC2420)
+{
+    m_radioEnergy.SetTypeId("ns3::lrwpan::LrWpanRadioEnergyModel");
+}
+
+LrWpanRadioEnergyModelHelper::~LrWpanRadioEnergyModelHelper()
+{
+}
+
+void
+LrWpanRadioEnergyModelHelper::Set(std::string name, const AttributeValue& v)
+{
+    m_radioEnergy.Set(name, v);
+}
+
+void
+LrWpanRadioEnergyModelHelper::SetTransceiver(
+    lrwpan::LrWpanRadioEnergyModel::Transceiver transceiver)
+{
+    m_hasTransceiver = true;
+    m_transceiver = transceiver;
+}
+
+void
+LrWpanRadioEnergyModelHelper::SetDepletionCallback(
+    lrwpan::LrWpanRadioEnergyModel::EnergyCallback callback)
+{
+    m_depletionCallback = callback;
+}
+
+void
+LrWpanRadioEnergyModelHelper::SetRechargedCallback(
+    lrwpan::LrWpanRadioEnergyModel::EnergyCallback callback)
+{
+    m_rechargedCallback = callback;
+}
+
+Ptr<energy::DeviceEnergyModel>
+LrWpanRadioEnergyModelHelper::DoInstall(Ptr<NetDevice> device,
+                                        Ptr<energy::EnergySource> source) const
+{
+    NS_ASSERT(device);
+    NS_ASSERT(source);
+    Ptr<lrwpan::LrWpanNetDevice> dev = DynamicCast<lrwpan::LrWpanNetDevice>(device);
+    NS_ABORT_MSG_IF(!dev, "Not a LrWpanNetDevice");
+
+    Ptr<lrwpan::LrWpanRadioEnergyModel> model =
+        m_radioEnergy.Create<lrwpan::LrWpanRadioEnergyModel>();
+    if (m_hasTransceiver)
+    {
+        model->SetTransceiver(m_transceiver);
+    }
+
+    if (m_depletionCallback.IsNull())
+    {
+        Ptr<lrwpan::LrWpanMac> mac = dev->GetMac();
+        model->SetEnergyDepletionCallback(
+            lrwpan::LrWpanRadioEnergyModel::EnergyCallback([mac]() {
+                // out of the PHY state change that drained the source
+                NS_LOG_DEBUG("Energy depleted, receiver off when idle");
+                Simulator::ScheduleNow(&lrwpan::LrWpanMac::SetRxOnWhenIdle, mac, false);
+            }));
+    }
+    else
+    {
+        model->SetEnergyDepletionCallback(m_depletionCallback);
+    }
+    model->SetEnergyRechargedCallback(m_rechargedCallback);
+
+    source->AppendDeviceEnergyModel(model);
+    model->SetEnergySource(source);
+
+    Ptr<lrwpan::LrWpanPhy> phy = dev->GetPhy();
+    if (phy->GetTrxState() != lrwpan::IEEE_802_15_4_PHY_TRX_OFF)
+    {
+        model->ChangeState(phy->GetTrxState());
+    }
+    phy->TraceConnectWithoutContext(
+        "TrxStateValue",
+        MakeCallback(&lrwpan::LrWpanRadioEnergyModel::TrxStateChanged, model));
+    phy->TraceConnectWithoutContext("PhyCcaBegin",
+                                    MakeCallback(&lrwpan::LrWpanRadioEnergyModel::CcaBegin, model));
+    phy->TraceConnectWithoutContext("PhyEdBegin",
+                                    MakeCallback(&lrwpan::LrWpanRadioEnergyModel::EdBegin, model));
+    return model;
+}
+
+} // namespace ns3
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_RADIO_ENERGY_MODEL_HELPER_H
+#define LR_WPAN_RADIO_ENERGY_MODEL_HELPER_H
+
+#include <ns3/energy-model-helper.h>
+#include <ns3/lr-wpan-radio-energy-model.h>
+#include <ns3/object-factory.h>
+
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Install a LrWpanRadioEnergyModel on LrWpanNetDevices.
+ *
+ * Each model is attached to the energy source given with its device and
+ * connected to the TrxStateValue, PhyCcaBegin and PhyEdBegin traces of the
+ * device PHY. Unless SetDepletionCallback() says otherwise, a depleted source
+ * stops the receiver of the device from being turned on when idle.
+ */
+class LrWpanRadioEnergyModelHelper : public DeviceEnergyModelHelper
+{
+  public:
+    LrWpanRadioEnergyModelHelper();
+    ~LrWpanRadioEnergyModelHelper() override;
+
+    /**
+     * \param name the name of a LrWpanRadioEnergyModel attribute
+     * \param v the value of the attribute
+     */
+    void Set(std::string name, const AttributeValue& v) override;
+
+    /**
+     * \brief Load the currents of a common transceiver into the models.
+     * \param transceiver the transceiver
+     */
+    void SetTransceiver(lrwpan::LrWpanRadioEnergyModel::Transceiver transceiver);
+
+    /**
+     * \param callback called when the energy source of a device is depleted
+     */
+    void SetDepletionCallback(lrwpan::LrWpanRadioEnergyModel::EnergyCallback callback);
+
+    /**
+     * \param callback called when the energy source of a device is recharged
+     */
+    void SetRechargedCallback(lrwpan::LrWpanRadioEnergyModel::EnergyCallback callback);
+
+  private:
+    /**
+     * \param device the LrWpanNetDevice
+     * \param source its energy source
+     * \return the model installed
+     */
+    Ptr<energy::DeviceEnergyModel> DoInstall(Ptr<NetDevice> device,
+                                             Ptr<energy::EnergySource> source) const override;
+
+    ObjectFactory m_radioEnergy;                                       //!< Model factory
+    bool m_hasTransceiver;                                             //!< A transceiver is set
+    lrwpan::LrWpanRadioEnergyModel::Transceiver m_transceiver;         //!< The transceiver
+    lrwpan::LrWpanRadioEnergyModel::EnergyCallback m_depletionCallback; //!< Depletion callback
+    lrwpan::LrWpanRadioEnergyModel::EnergyCallback m_rechargedCallback; //!< Recharge callback
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_RADIO_ENERGY_MODEL_HELPER_H */
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-replication-helper.h"
+
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanReplicationHelper");
+
+LrWpanReplicationHelper::LrWpanReplicationHelper()
+    : m_maxWorkers(0),
+      m_quiet(true)
+{
+}
+
+void
+LrWpanReplicationHelper::SetProgram(std::string program)
+{
+    m_program = program;
+}
+
+void
+LrWpanReplicationHelper::SetArguments(std::vector<std::string> args)
+{
+    m_args = args;
+}
+
+void
+LrWpanReplicationHelper::SetMaxWorkers(uint32_t workers)
+{
+    m_maxWorkers = workers;
+}
+
+void
+LrWpanReplicationHelper::SetQuiet(bool quiet)
+{
+    m_quiet = quiet;
+}
+
+std::vector<LrWpanReplicationHelper::Replication>
+LrWpanReplicationHelper::Run(uint32_t firstRun, uint32_t count)
+{
+    NS_ASSERT_MSG(!m_program.empty(), "No program to replicate");
+
+    std::vector<Replication> replications(count);
+    LrWpanProcessPool pool(m_maxWorkers);
+    pool.SetQuiet(m_quiet);
+
+    uint32_t done = 0;
+    pool.SetCompletionCallback(LrWpanProcessPool::CompletionCallback(
+        [&replications, &done, count](uint32_t id, int status, const std::string& output) {
+            replications[id].status = status;
+            replications[id].metrics = LrWpanProcessPool::ParseRecords(output);
+            done++;
+            NS_LOG_INFO("Replication " << replications[id].run << " finished with status "
+                                       << status << " (" << done << "/" << count << ")");
+        }));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        replications[i].run = firstRun + i;
+        replications[i].status = -1;
+
+        std::vector<std::string> argv;
+        argv.reserve(m_args.size() + 3);
+        argv.push_back(m_program);
+        argv.insert(argv.end(), m_args.begin(), m_args.end());
+        argv.push_back("--RngRun=" + std::to_string(firstRun + i));
+        argv.push_back("--resultFd=" + std::to_string(LrWpanProcessPool::RESULT_FD));
+        pool.AddCommand(argv);
+    }
+
+    NS_LOG_INFO("Running " << count << " replications on " << pool.GetMaxWorkers()
+                           << " workers");
+    pool.Run();
+    return replications;
+}
+
+double
+LrWpanReplicationHelper::StudentT95(uint32_t df)
+{
+    NS_ASSERT(df >= 1);
+    static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306,
+                                   2.262,  2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120,
+                                   2.110,  2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064,
+                                   2.060,  2.056, 2.052, 2.048, 2.045, 2.042};
+    if (df <= 30)
+    {
+        return table[df - 1];
+    }
+    // Cornish-Fisher expansion around the normal quantile, accurate to 1e-3 for df > 30.
+    const double z = 1.959964;
+    double n = df;
+    return z + (z * z * z + z) / (4 * n) +
+           (5 * std::pow(z, 5) + 16 * z * z * z + 3 * z) / (96 * n * n);
+}
+
+std::vector<LrWpanReplicationHelper::Summary>
+LrWpanReplicationHelper::Summarize(const std::vector<Replication>& replications)
+{
+    std::vector<Summary> summaries;
+    std::map<std::string, std::size_t> index;
+    // Welford accumulators, one per metric
+    std::vector<double> m2;
+
+    for (const auto& rep : replications)
+    {
+        if (rep.status != 0)
+        {
+            continue;
+        }
+        for (const auto& [name, value] : rep.metrics)
+        {
+            auto it = index.find(name);
+            if (it == index.end())
+            {
+                it = index.emplace(name, summaries.size()).first;
+                summaries.push_back({name, 0, 0.0, 0.0, 0.0});
+                m2.push_back(0.0);
+            }
+            Summary& s = summaries[it->second];
+            s.n++;
+            double delta = value - s.mean;
+            s.mean += delta / s.n;
+            m2[it->second] += delta * (value - s.mean);
+        }
+    }
+
+    for (std::size_t i = 0; i < summaries.size(); i++)
+    {
+        Summary& s = summaries[i];
+        if (s.n > 1)
+        {
+            s.stdDev = std::sqrt(m2[i] / (s.n - 1));
+            s.ciHalfWidth = StudentT95(s.n - 1) * s.stdDev / std::sqrt(s.n);
+        }
+    }
+    return summaries;
+}
+
+void
+LrWpanReplicationHelper::WriteReplications(std::ostream& os,
+                                           const std::vector<Replication>& replications)
+{
+    // Use the union of all metric names as columns.
+    std::vector<std::string> columns;
+    std::map<std::string, std::size_t> index;
+    for (const auto& rep : replications)
+    {
+        for (const auto& record : rep.metrics)
+        {
+            if (index.emplace(record.first, columns.size()).second)
+            {
+                columns.push_back(record.first);
+            }
+        }
+    }
+
+    os << "run,status";
+    for (const auto& c : columns)
+    {
+        os << "," << c;
+    }
+    os << "\n" << std::setprecision(10);
+
+    for (const auto& rep : replications)
+    {
+        std::vector<std::string> row(columns.size());
+        for (const auto& [name, value] : rep.metrics)
+        {
+            std::ostringstream v;
+            v << std::setprecision(10) << value;
+            row[index[name]] = v.str();
+        }
+        os << rep.run << "," << rep.status;
+        for (const auto& v : row)
+        {
+            os << "," << v;
+        }
+        os << "\n";
+    }
+}
+
+void
+LrWpanReplicationHelper::WriteSummary(std::ostream& os, const std::vector<Summary>& summaries)
+{
+    os << "metric,n,mean,stddev,ci95_low,ci95_high\n" << std::setprecision(10);
+    for (const auto& s : summaries)
+    {
+        os << s.name << "," << s.n << "," << s.mean << "," << s.stdDev << ","
+           << s.mean - s.ciHalfWidth << "," << s.mean + s.ciHalfWidth << "\n";
+    }
+}
+
+} // namespace ns3
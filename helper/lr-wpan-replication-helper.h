@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_REPLICATION_HELPER_H
+#define LR_WPAN_REPLICATION_HELPER_H
+
+#include "lr-wpan-process-pool.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Runs independent replications of a simulation program and summarizes them.
+ *
+ * Each replication executes the configured program with a distinct
+ * --RngRun=<n> value on a LrWpanProcessPool. The program is expected to report
+ * its metrics as "name value" records on LrWpanProcessPool::RESULT_FD; the
+ * option --resultFd=<fd> is appended to its command line for that purpose.
+ */
+class LrWpanReplicationHelper
+{
+  public:
+    /**
+     * The results of one replication.
+     */
+    struct Replication
+    {
+        uint32_t run;                       //!< The RngRun value
+        int status;                         //!< The exit status of the program
+        LrWpanProcessPool::Records metrics; //!< The reported metrics
+    };
+
+    /**
+     * The across-replications summary of one metric.
+     */
+    struct Summary
+    {
+        std::string name;   //!< The metric name
+        uint32_t n;         //!< Number of replications reporting the metric
+        double mean;        //!< Sample mean
+        double stdDev;      //!< Sample standard deviation
+        double ciHalfWidth; //!< Half width of the 95% confidence interval of the mean
+    };
+
+    LrWpanReplicationHelper();
+
+    /**
+     * \param program the path of the program to replicate
+     */
+    void SetProgram(std::string program);
+
+    /**
+     * \param args extra arguments passed to every replication
+     */
+    void SetArguments(std::vector<std::string> args);
+
+    /**
+     * \param workers the maximum number of concurrent replications, 0 for one per processor
+     */
+    void SetMaxWorkers(uint32_t workers);
+
+    /**
+     * \param quiet if true, the replications' standard output is discarded
+     */
+    void SetQuiet(bool quiet);
+
+    /**
+     * \brief Execute the replications and wait for all of them.
+     * \param firstRun the RngRun value of the first replication
+     * \param count the number of replications
+     * \return the replications, ordered by run
+     */
+    std::vector<Replication> Run(uint32_t firstRun, uint32_t count);
+
+    /**
+     * \brief Compute mean and 95% confidence interval of every metric.
+     *
+     * Failed replications (non zero status) are ignored. Metrics are reported in
+     * order of first appearance.
+     *
+     * \param replications the replications to summarize
+     * \return one summary per metric
+     */
+    static std::vector<Summary> Summarize(const std::vector<Replication>& replications);
+
+    /**
+     * \brief The two sided 95% quantile of the Student t distribution.
+     * \param df the degrees of freedom (>= 1)
+     * \return the quantile
+     */
+    static double StudentT95(uint32_t df);
+
+    /**
+     * \brief Write the per-replication results as CSV, one row per replication.
+     * \param os the output stream
+     * \param replications the replications
+     */
+    static void WriteReplications(std::ostream& os, const std::vector<Replication>& replications);
+
+    /**
+     * \brief Write a summary table as CSV.
+     * \param os the output stream
+     * \param summaries the summaries
+     */
+    static void WriteSummary(std::ostream& os, const std::vector<Summary>& summaries);
+
+  private:
+    std::string m_program;           //!< The program to replicate
+    std::vector<std::string> m_args; //!< Extra program arguments
+    uint32_t m_maxWorkers;           //!< Maximum number of concurrent replications
+    bool m_quiet;                    //!< Discard the replications' output
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_REPLICATION_HELPER_H */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-steady-state-controller.h"
+
+#include "lr-wpan-replication-helper.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanSteadyStateController");
+
+LrWpanSteadyStateController::LrWpanSteadyStateController()
+    : m_targetHalfWidth(0.01),
+      m_minSamples(200),
+      m_batches(20),
+      m_checkInterval(20),
+      m_superframes(0),
+      m_converged(false)
+{
+}
+
+void
+LrWpanSteadyStateController::AddMetric(std::string name, Metric metric)
+{
+    m_names.push_back(name);
+    m_metrics.push_back(metric);
+    m_samples.emplace_back();
+}
+
+void
+LrWpanSteadyStateController::SetTargetHalfWidth(double halfWidth)
+{
+    m_targetHalfWidth = halfWidth;
+}
+
+void
+LrWpanSteadyStateController::SetMinSamples(uint32_t samples)
+{
+    m_minSamples = samples;
+}
+
+void
+LrWpanSteadyStateController::SetBatchCount(uint32_t batches)
+{
+    NS_ABORT_MSG_IF(batches < 2, "At least 2 batches are needed");
+    m_batches = batches;
+}
+
+void
+LrWpanSteadyStateController::SetCheckInterval(uint32_t superframes)
+{
+    m_checkInterval = std::max<uint32_t>(superframes, 1);
+}
+
+void
+LrWpanSteadyStateController::SetConvergedCallback(Callback<void> callback)
+{
+    m_convergedCallback = callback;
+}
+
+Ptr<LrWpanSuperframeSink>
+LrWpanSteadyStateController::GetSink()
+{
+    return Create<LrWpanSuperframeCallbackSink>(LrWpanSuperframeCallbackSink::RecordCallback(
+        [this](const LrWpanSuperframeRecord& record) { Add(record); }));
+}
+
+void
+LrWpanSteadyStateController::Add(const LrWpanSuperframeRecord& record)
+{
+    for (uint32_t i = 0; i < m_metrics.size(); i++)
+    {
+        double sample = m_metrics[i](record);
+        if (!std::isnan(sample))
+        {
+            m_samples[i].push_back(sample);
+        }
+    }
+
+    m_superframes++;
+    if (m_converged || m_metrics.empty() || m_superframes % m_checkInterval != 0)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < m_metrics.size(); i++)
+    {
+        if (m_samples[i].size() < m_minSamples || !GetEstimate(i).converged)
+        {
+            return;
+        }
+    }
+
+    NS_LOG_INFO("Steady state reached after " << m_superframes << " superframes");
+    m_converged = true;
+    if (!m_convergedCallback.IsNull())
+    {
+        m_convergedCallback();
+    }
+}
+
+bool
+LrWpanSteadyStateController::IsConverged() const
+{
+    return m_converged;
+}
+
+LrWpanSteadyStateController::Estimate
+LrWpanSteadyStateController::GetEstimate(uint32_t i) const
+{
+    const std::vector<double>& samples = m_samples[i];
+    Estimate e;
+    e.name = m_names[i];
+    e.warmup = Mser5(samples);
+    e.n = samples.size() - e.warmup;
+    e.mean = 0;
+    e.halfWidth = std::numeric_limits<double>::infinity();
+    e.converged = BatchMeans(samples, e.warmup, m_batches, e.mean, e.halfWidth) &&
+                  e.halfWidth <= m_targetHalfWidth;
+    return e;
+}
+
+std::vector<LrWpanSteadyStateController::Estimate>
+LrWpanSteadyStateController::GetEstimates() const
+{
+    std::vector<Estimate> estimates;
+    for (uint32_t i = 0; i < m_metrics.size(); i++)
+    {
+        estimates.push_back(GetEstimate(i));
+    }
+    return estimates;
+}
+
+uint32_t
+LrWpanSteadyStateController::Mser5(const std::vector<double>& samples)
+{
+    const uint32_t batchSize = 5;
+    uint32_t m = samples.size() / batchSize;
+    if (m < 2)
+    {
+        return 0;
+    }
+
+    std::vector<double> z(m);
+    for (uint32_t j = 0; j < m; j++)
+    {
+        double sum = 0;
+        for (uint32_t k = 0; k < batchSize; k++)
+        {
+            sum += samples[j * batchSize + k];
+        }
+        z[j] = sum / batchSize;
+    }
+
+    // Suffix sums give every truncation point in a single backward pass.
+    double sum = 0;
+    double sumSq = 0;
+    double best = std::numeric_limits<double>::infinity();
+    uint32_t bestD = 0;
+    for (uint32_t d = m; d-- > 0;)
+    {
+        sum += z[d];
+        sumSq += z[d] * z[d];
+        if (d > m / 2)
+        {
+            continue;
+        }
+        double n = m - d;
+        double mser = (sumSq - sum * sum / n) / (n * n);
+        if (mser <= best)
+        {
+            best = mser;
+            bestD = d;
+        }
+    }
+    return bestD * batchSize;
+}
+
+bool
+LrWpanSteadyStateController::BatchMeans(const std::vector<double>& samples,
+                                        uint32_t first,
+                                        uint32_t batches,
+                                        double& mean,
+                                        double& halfWidth)
+{
+    uint32_t n = samples.size() > first ? samples.size() - first : 0;
+    uint32_t batchSize = n / batches;
+    if (batchSize < 2)
+    {
+        return false;
+    }
+    // Drop the leftover at the start, next to the warm-up.
+    first += n - batchSize * batches;
+
+    double sum = 0;
+    double sumSq = 0;
+    for (uint32_t b = 0; b < batches; b++)
+    {
+        double batchSum = 0;
+        for (uint32_t k = 0; k < batchSize; k++)
+        {
+            batchSum += samples[first + b * batchSize + k];
+        }
+        double batchMean = batchSum / batchSize;
+        sum += batchMean;
+        sumSq += batchMean * batchMean;
+    }
+    mean = sum / batches;
+    double variance = std::max(0.0, (sumSq - sum * sum / batches) / (batches - 1));
+    halfWidth =
+        LrWpanReplicationHelper::StudentT95(batches - 1) * std::sqrt(variance / batches);
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_STEADY_STATE_CONTROLLER_H
+#define LR_WPAN_STEADY_STATE_CONTROLLER_H
+
+#include "lr-wpan-superframe-monitor.h"
+
+#include <ns3/callback.h>
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Detects the steady state of per-superframe metrics and ends long runs early.
+ *
+ * The controller is fed the records of a LrWpanSuperframeMonitor (see
+ * GetSink()) and turns each into one sample per monitored metric. Every few
+ * superframes, it removes the warm-up of each metric with the MSER-5 rule and
+ * computes a batch means 95% confidence interval on the remaining samples.
+ * Once every metric's half width is within the target, the converged callback
+ * is invoked (typically to stop the simulation) and GetEstimates() reports
+ * the steady-state means, which exclude the warm-up.
+ */
+class LrWpanSteadyStateController
+{
+  public:
+    /**
+     * Metric extraction: returns the sample of a superframe, or NaN if the
+     * superframe has none (e.g. nothing was sent).
+     */
+    typedef Callback<double, const LrWpanSuperframeRecord&> Metric;
+
+    /**
+     * The steady-state estimate of a metric.
+     */
+    struct Estimate
+    {
+        std::string name;   //!< Metric name
+        uint32_t warmup;    //!< Samples removed as warm-up
+        uint32_t n;         //!< Samples kept
+        double mean;        //!< Steady-state mean
+        double halfWidth;   //!< Half width of the 95% confidence interval of the mean
+        bool converged;     //!< The half width is within the target
+    };
+
+    LrWpanSteadyStateController();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    LrWpanSteadyStateController(const LrWpanSteadyStateController&) = delete;
+    LrWpanSteadyStateController& operator=(const LrWpanSteadyStateController&) = delete;
+
+    /**
+     * \param name the metric name
+     * \param metric the metric extraction
+     */
+    void AddMetric(std::string name, Metric metric);
+
+    /**
+     * \param halfWidth the target half width of the confidence intervals, in metric units
+     */
+    void SetTargetHalfWidth(double halfWidth);
+
+    /**
+     * \param samples the number of samples of every metric before the first check
+     */
+    void SetMinSamples(uint32_t samples);
+
+    /**
+     * \param batches the number of batches of the batch means method (>= 2)
+     */
+    void SetBatchCount(uint32_t batches);
+
+    /**
+     * \param superframes the number of superframes between two checks
+     */
+    void SetCheckInterval(uint32_t superframes);
+
+    /**
+     * \param callback invoked once, when all metrics have converged
+     */
+    void SetConvergedCallback(Callback<void> callback);
+
+    /**
+     * \return a sink to add to the LrWpanSuperframeMonitor
+     */
+    Ptr<LrWpanSuperframeSink> GetSink();
+
+    /**
+     * \brief Add the samples of a superframe.
+     * \param record the superframe record
+     */
+    void Add(const LrWpanSuperframeRecord& record);
+
+    /**
+     * \return true if all metrics have converged
+     */
+    bool IsConverged() const;
+
+    /**
+     * \return the current estimate of every metric
+     */
+    std::vector<Estimate> GetEstimates() const;
+
+    /**
+     * \brief MSER-5 warm-up truncation.
+     *
+     * The samples are averaged in batches of 5; the truncation minimizes the
+     * squared standard error of the remaining batch means, searched over the
+     * first half of the batches.
+     *
+     * \param samples the samples
+     * \return the number of leading samples to discard
+     */
+    static uint32_t Mser5(const std::vector<double>& samples);
+
+    /**
+     * \brief Batch means confidence interval of the mean of correlated samples.
+     * \param samples the samples
+     * \param first the first sample to use
+     * \param batches the number of batches
+     * \param [out] mean the mean
+     * \param [out] halfWidth the half width of the 95% confidence interval
+     * \return false if there are less than 2 samples per batch
+     */
+    static bool BatchMeans(const std::vector<double>& samples,
+                           uint32_t first,
+                           uint32_t batches,
+                           double& mean,
+                           double& halfWidth);
+
+  private:
+    /**
+     * \param i the metric index
+     * \return the estimate of the metric
+     */
+    Estimate GetEstimate(uint32_t i) const;
+
+    std::vector<std::string> m_names;           //!< Metric names
+    std::vector<Metric> m_metrics;              //!< Metric extractions
+    std::vector<std::vector<double>> m_samples; //!< Samples of each metric
+    double m_targetHalfWidth;                   //!< Target half width
+    uint32_t m_minSamples;                      //!< Samples before the first check
+    uint32_t m_batches;                         //!< Batch count
+    uint32_t m_checkInterval;                   //!< Superframes between checks
+    uint32_t m_superframes;                     //!< Superframes seen
+    bool m_converged;                           //!< All metrics converged
+    Callback<void> m_convergedCallback;         //!< Convergence callback
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_STEADY_STATE_CONTROLLER_H */
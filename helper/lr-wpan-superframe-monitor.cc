@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-superframe-monitor.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-csmaca-common.h>
+#include <ns3/simulator.h>
+
+#include <cstring>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanSuperframeMonitor");
+
+LrWpanSuperframeSink::~LrWpanSuperframeSink()
+{
+}
+
+LrWpanSuperframeFileSink::LrWpanSuperframeFileSink(std::string filename)
+{
+    m_file.open(filename, std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!m_file, "Cannot open superframe log " << filename);
+    const uint32_t tpCount = TP_COUNT;
+    const uint32_t recordSize = sizeof(LrWpanSuperframeRecord);
+    m_file.write("LWSFREC1", 8);
+    m_file.write(reinterpret_cast<const char*>(&tpCount), sizeof(tpCount));
+    m_file.write(reinterpret_cast<const char*>(&recordSize), sizeof(recordSize));
+}
+
+void
+LrWpanSuperframeFileSink::Write(const LrWpanSuperframeRecord& record)
+{
+    m_file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+LrWpanSuperframeRingSink::LrWpanSuperframeRingSink(uint32_t capacity)
+    : m_total(0)
+{
+    NS_ABORT_MSG_IF(capacity == 0, "Empty superframe ring");
+    m_ring.reserve(capacity);
+}
+
+void
+LrWpanSuperframeRingSink::Write(const LrWpanSuperframeRecord& record)
+{
+    if (m_ring.size() < m_ring.capacity())
+    {
+        m_ring.push_back(record);
+    }
+    else
+    {
+        m_ring[m_total % m_ring.size()] = record;
+    }
+    m_total++;
+}
+
+std::vector<LrWpanSuperframeRecord>
+LrWpanSuperframeRingSink::GetRecords() const
+{
+    if (m_total <= m_ring.size())
+    {
+        return m_ring;
+    }
+    std::vector<LrWpanSuperframeRecord> records;
+    records.reserve(m_ring.size());
+    uint64_t oldest = m_total % m_ring.size();
+    records.insert(records.end(), m_ring.begin() + oldest, m_ring.end());
+    records.insert(records.end(), m_ring.begin(), m_ring.begin() + oldest);
+    return records;
+}
+
+uint64_t
+LrWpanSuperframeRingSink::GetTotal() const
+{
+    return m_total;
+}
+
+LrWpanSuperframeCallbackSink::LrWpanSuperframeCallbackSink(RecordCallback callback)
+    : m_callback(callback)
+{
+}
+
+void
+LrWpanSuperframeCallbackSink::Write(const LrWpanSuperframeRecord& record)
+{
+    m_callback(record);
+}
+
+LrWpanSuperframeMonitor::LrWpanSuperframeMonitor()
+    : m_started(false),
+      m_records(0)
+{
+    std::memset(&m_current, 0, sizeof(m_current));
+}
+
+void
+LrWpanSuperframeMonitor::AddSink(Ptr<LrWpanSuperframeSink> sink)
+{
+    m_sinks.push_back(sink);
+}
+
+void
+LrWpanSuperframeMonitor::Install(Ptr<lrwpan::LrWpanNetDevice> coordinator,
+                                 NetDeviceContainer devices)
+{
+    coordinator->GetMac()->TraceConnectWithoutContext(
+        "BeaconStart",
+        MakeCallback(&LrWpanSuperframeMonitor::BeaconStart, this));
+
+    // The variants name their CSMA/CA traces differently.
+    static const char* collisionTraces[] = {"csmaCaBebCollisionTrace",
+                                            "csmaCaNobaCollisionTrace",
+                                            "csmaCaSwNobaCollisionTrace",
+                                            "csmaCaStandardCollisionTrace",
+                                            "csmaCaGnuNobaCollisionTrace"};
+    static const char* mkViolationTraces[] = {"csmaCaSwNobaMKViolationTrace",
+                                              "csmaCaStandardMKViolationTrace",
+                                              "csmaCaGnuNobaMKViolationTrace"};
+
+    for (auto i = devices.Begin(); i != devices.End(); i++)
+    {
+        Ptr<lrwpan::LrWpanNetDevice> dev = DynamicCast<lrwpan::LrWpanNetDevice>(*i);
+        NS_ABORT_MSG_IF(!dev, "Not a LrWpanNetDevice");
+        if (dev == coordinator)
+        {
+            continue;
+        }
+        m_devices.push_back(dev);
+
+        Ptr<lrwpan::LrWpanMac> mac = dev->GetMac();
+        mac->TraceConnectWithoutContext(
+            "MacTxEnqueue",
+            Callback<void, Ptr<const Packet>, uint8_t>(
+                [this](Ptr<const Packet>, uint8_t tp) { m_current.enqueued[tp % TP_COUNT]++; }));
+        mac->TraceConnectWithoutContext(
+            "MacTxOk",
+            Callback<void, Ptr<const Packet>, uint8_t>(
+                [this](Ptr<const Packet>, uint8_t tp) { m_current.success[tp % TP_COUNT]++; }));
+
+        Ptr<lrwpan::LrWpanCsmaCaCommon> csma = dev->GetCsmaCa();
+        Callback<void, uint8_t, uint32_t> collision(
+            [this](uint8_t tp, uint32_t) { m_current.collisions[tp % TP_COUNT]++; });
+        for (const char* name : collisionTraces)
+        {
+            csma->TraceConnectWithoutContext(name, collision);
+        }
+        Callback<void, uint8_t> mkViolation(
+            [this](uint8_t tp) { m_current.mkViolations[tp % TP_COUNT]++; });
+        for (const char* name : mkViolationTraces)
+        {
+            csma->TraceConnectWithoutContext(name, mkViolation);
+        }
+        csma->TraceConnectWithoutContext(
+            "csmaCaDeferTrace",
+            Callback<void, uint8_t>([this](uint8_t tp) { m_current.deferrals[tp % TP_COUNT]++; }));
+    }
+}
+
+void
+LrWpanSuperframeMonitor::BeaconStart(SequenceNumber8 bsn)
+{
+    if (m_started)
+    {
+        m_current.bsn = bsn.GetValue();
+        WriteRecord();
+    }
+
+    std::memset(&m_current, 0, sizeof(m_current));
+    // the beacon about to be sent takes the next sequence number
+    m_current.bsn = static_cast<uint8_t>(bsn.GetValue() + 1);
+    m_start = Simulator::Now();
+    m_started = true;
+}
+
+void
+LrWpanSuperframeMonitor::Flush()
+{
+    if (!m_started)
+    {
+        return;
+    }
+    WriteRecord();
+
+    // the rest of the superframe, if the simulation goes on, is a new record
+    uint32_t bsn = m_current.bsn;
+    std::memset(&m_current, 0, sizeof(m_current));
+    m_current.bsn = bsn;
+    m_start = Simulator::Now();
+}
+
+void
+LrWpanSuperframeMonitor::WriteRecord()
+{
+    Time now = Simulator::Now();
+    m_current.start = m_start.GetNanoSeconds();
+    m_current.duration = (now - m_start).GetNanoSeconds();
+
+    // Sample the state in effect at the end of the superframe; the first
+    // device of a TP stands for its (shared) contention window.
+    bool sampled[TP_COUNT] = {};
+    for (const auto& dev : m_devices)
+    {
+        uint8_t tp = dev->GetMac()->GetPriority() % TP_COUNT;
+        m_current.queueDepth[tp] += dev->GetMac()->GetTxQSize();
+        if (!sampled[tp])
+        {
+            std::pair<uint32_t, uint32_t> cw = dev->GetCsmaCa()->GetCwRange();
+            m_current.cwMin[tp] = cw.first;
+            m_current.cwMax[tp] = cw.second;
+            sampled[tp] = true;
+        }
+    }
+
+    for (const auto& sink : m_sinks)
+    {
+        sink->Write(m_current);
+    }
+    m_records++;
+}
+
+uint32_t
+LrWpanSuperframeMonitor::GetRecordCount() const
+{
+    return m_records;
+}
+
+} // namespace ns3
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_SUPERFRAME_MONITOR_H
+#define LR_WPAN_SUPERFRAME_MONITOR_H
+
+#define TP_COUNT 8
+
+#include <ns3/callback.h>
+#include <ns3/lr-wpan-net-device.h>
+#include <ns3/net-device-container.h>
+#include <ns3/nstime.h>
+#include <ns3/sequence-number.h>
+#include <ns3/simple-ref-count.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Per-TP metrics of one superframe, measured over all the devices of a PAN.
+ * Plain data, written as is by LrWpanSuperframeFileSink.
+ */
+struct LrWpanSuperframeRecord
+{
+    uint32_t bsn;                   //!< Beacon sequence number of the superframe
+    uint32_t reserved;              //!< Padding
+    int64_t start;                  //!< Superframe start (ns)
+    int64_t duration;               //!< Beacon interval (ns)
+    uint32_t enqueued[TP_COUNT];    //!< Packets enqueued
+    uint32_t success[TP_COUNT];     //!< Packets acknowledged
+    uint32_t collisions[TP_COUNT];  //!< CSMA/CA collisions (busy CCAs)
+    uint32_t deferrals[TP_COUNT];   //!< Transmissions deferred to the next CAP
+    uint32_t mkViolations[TP_COUNT]; //!< (m,k)-firm violations
+    uint32_t cwMin[TP_COUNT];       //!< Contention window in effect, lower bound
+    uint32_t cwMax[TP_COUNT];       //!< Contention window in effect, upper bound
+    uint32_t queueDepth[TP_COUNT];  //!< Packets queued at the end of the superframe
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Destination of the superframe records of a LrWpanSuperframeMonitor.
+ */
+class LrWpanSuperframeSink : public SimpleRefCount<LrWpanSuperframeSink>
+{
+  public:
+    virtual ~LrWpanSuperframeSink();
+
+    /**
+     * \param record a finished superframe
+     */
+    virtual void Write(const LrWpanSuperframeRecord& record) = 0;
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Appends the records to a binary file: the header "LWSFREC1", uint32_t TP
+ * count, uint32_t record size, then the raw LrWpanSuperframeRecord structs in
+ * host byte order.
+ */
+class LrWpanSuperframeFileSink : public LrWpanSuperframeSink
+{
+  public:
+    /**
+     * \param filename the output file, truncated if it exists
+     */
+    LrWpanSuperframeFileSink(std::string filename);
+
+    void Write(const LrWpanSuperframeRecord& record) override;
+
+  private:
+    std::ofstream m_file; //!< The output file
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Keeps the most recent records in memory.
+ */
+class LrWpanSuperframeRingSink : public LrWpanSuperframeSink
+{
+  public:
+    /**
+     * \param capacity the number of records kept
+     */
+    LrWpanSuperframeRingSink(uint32_t capacity);
+
+    void Write(const LrWpanSuperframeRecord& record) override;
+
+    /**
+     * \return the records kept, oldest first
+     */
+    std::vector<LrWpanSuperframeRecord> GetRecords() const;
+
+    /**
+     * \return the number of records written, including the overwritten ones
+     */
+    uint64_t GetTotal() const;
+
+  private:
+    std::vector<LrWpanSuperframeRecord> m_ring; //!< The records
+    uint64_t m_total;                           //!< Records written
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Passes the records to a callback.
+ */
+class LrWpanSuperframeCallbackSink : public LrWpanSuperframeSink
+{
+  public:
+    /**
+     * Record callback signature.
+     */
+    typedef Callback<void, const LrWpanSuperframeRecord&> RecordCallback;
+
+    /**
+     * \param callback the callback
+     */
+    LrWpanSuperframeCallbackSink(RecordCallback callback);
+
+    void Write(const LrWpanSuperframeRecord& record) override;
+
+  private:
+    RecordCallback m_callback; //!< The callback
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Per-superframe time series of the CSMA/CA metrics of a PAN.
+ *
+ * The monitor aggregates the MAC and CSMA/CA traces of the devices per TP
+ * and, each time the coordinator starts a beacon (the BeaconStart trace of
+ * SendOneBeacon), writes the record of the superframe that just ended to its
+ * sinks. The contention windows are sampled at that point, before the
+ * variants update them for the next superframe, so a record shows the windows
+ * that produced its counters.
+ */
+class LrWpanSuperframeMonitor
+{
+  public:
+    LrWpanSuperframeMonitor();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    LrWpanSuperframeMonitor(const LrWpanSuperframeMonitor&) = delete;
+    LrWpanSuperframeMonitor& operator=(const LrWpanSuperframeMonitor&) = delete;
+
+    /**
+     * \param sink a destination of the records
+     */
+    void AddSink(Ptr<LrWpanSuperframeSink> sink);
+
+    /**
+     * \brief Monitor a PAN.
+     * \param coordinator the PAN coordinator, whose beacons delimit the superframes
+     * \param devices the devices of the PAN, the coordinator may be included
+     */
+    void Install(Ptr<lrwpan::LrWpanNetDevice> coordinator, NetDeviceContainer devices);
+
+    /**
+     * \brief Write the superframe in progress, cut short, to the sinks.
+     *
+     * Call it when the simulation stops, so that the traffic after the last
+     * beacon is recorded. Its duration is the part of the beacon interval
+     * elapsed so far.
+     */
+    void Flush();
+
+    /**
+     * \return the number of records written
+     */
+    uint32_t GetRecordCount() const;
+
+  private:
+    /**
+     * \param bsn the sequence number of the previous beacon
+     */
+    void BeaconStart(SequenceNumber8 bsn);
+
+    /**
+     * \brief Sample the end of the superframe in progress and write its
+     *        record to the sinks.
+     */
+    void WriteRecord();
+
+    std::vector<Ptr<lrwpan::LrWpanNetDevice>> m_devices; //!< Monitored devices
+    std::vector<Ptr<LrWpanSuperframeSink>> m_sinks;      //!< Record destinations
+    LrWpanSuperframeRecord m_current;                    //!< The superframe in progress
+    Time m_start;                                        //!< Start of the superframe in progress
+    bool m_started;                                      //!< A superframe is in progress
+    uint32_t m_records;                                  //!< Records written
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_SUPERFRAME_MONITOR_H */
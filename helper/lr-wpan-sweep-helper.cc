@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-sweep-helper.h"
+
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanSweepHelper");
+
+LrWpanSweepHelper::LrWpanSweepHelper()
+    : m_maxWorkers(0)
+{
+    m_store = "sweep-results";
+}
+
+void
+LrWpanSweepHelper::SetProgram(std::string program)
+{
+    m_program = program;
+}
+
+void
+LrWpanSweepHelper::SetArguments(std::vector<std::string> args)
+{
+    m_args = args;
+}
+
+void
+LrWpanSweepHelper::SetStore(std::string store)
+{
+    m_store = store;
+}
+
+void
+LrWpanSweepHelper::SetMaxWorkers(uint32_t workers)
+{
+    m_maxWorkers = workers;
+}
+
+void
+LrWpanSweepHelper::SetCostParameter(std::string name)
+{
+    m_costParameter = name;
+}
+
+void
+LrWpanSweepHelper::AddParameter(std::string name, std::vector<std::string> values)
+{
+    NS_ASSERT_MSG(!values.empty(), "No values for parameter " << name);
+    m_grid.emplace_back(name, values);
+}
+
+void
+LrWpanSweepHelper::LoadGrid(std::istream& is)
+{
+    std::string line;
+    while (std::getline(is, line))
+    {
+        auto comment = line.find('#');
+        if (comment != std::string::npos)
+        {
+            line.erase(comment);
+        }
+        auto eq = line.find('=');
+        if (eq == std::string::npos)
+        {
+            continue;
+        }
+
+        std::istringstream nameStream(line.substr(0, eq));
+        std::string name;
+        nameStream >> name;
+
+        std::istringstream valueStream(line.substr(eq + 1));
+        std::vector<std::string> values;
+        std::string value;
+        while (valueStream >> value)
+        {
+            auto range = value.find("..");
+            if (range == std::string::npos)
+            {
+                values.push_back(value);
+                continue;
+            }
+            long first = std::stol(value.substr(0, range));
+            long last = std::stol(value.substr(range + 2));
+            for (long v = first; v <= last; v++)
+            {
+                values.push_back(std::to_string(v));
+            }
+        }
+        NS_ABORT_MSG_IF(name.empty() || values.empty(), "Malformed grid line: " << line);
+        AddParameter(name, values);
+    }
+}
+
+std::vector<std::vector<std::string>>
+LrWpanSweepHelper::GetPoints() const
+{
+    std::vector<std::vector<std::string>> points(1);
+    for (const auto& [name, values] : m_grid)
+    {
+        std::vector<std::vector<std::string>> expanded;
+        expanded.reserve(points.size() * values.size());
+        for (const auto& point : points)
+        {
+            for (const auto& value : values)
+            {
+                expanded.push_back(point);
+                expanded.back().push_back("--" + name + "=" + value);
+            }
+        }
+        points.swap(expanded);
+    }
+    return points;
+}
+
+std::string
+LrWpanSweepHelper::Hash(const std::string& config)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : config)
+    {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    std::ostringstream oss;
+    oss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return oss.str();
+}
+
+std::string
+LrWpanSweepHelper::GetRecordPath(const std::string& hash) const
+{
+    return m_store + "/" + hash + ".rec";
+}
+
+bool
+LrWpanSweepHelper::WriteFile(const std::string& path, const std::string& content) const
+{
+    std::string tmp = path + ".tmp";
+    {
+        std::ofstream os(tmp, std::ios::trunc);
+        os << content;
+        os.flush();
+        if (!os)
+        {
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    return !ec;
+}
+
+LrWpanSweepHelper::Stats
+LrWpanSweepHelper::Run()
+{
+    NS_ASSERT_MSG(!m_program.empty(), "No program to sweep");
+
+    std::filesystem::create_directories(m_store);
+    // Left over by an interrupted sweep.
+    for (const auto& entry : std::filesystem::directory_iterator(m_store))
+    {
+        if (entry.path().extension() == ".tmp")
+        {
+            std::filesystem::remove(entry.path());
+        }
+    }
+
+    std::vector<std::vector<std::string>> points = GetPoints();
+    Stats stats{static_cast<uint32_t>(points.size()), 0, 0, 0};
+
+    auto commandLine = [this](const std::vector<std::string>& point) {
+        std::vector<std::string> argv;
+        argv.reserve(m_args.size() + point.size() + 3);
+        argv.push_back(m_program);
+        argv.insert(argv.end(), m_args.begin(), m_args.end());
+        argv.insert(argv.end(), point.begin(), point.end());
+        argv.push_back("--resultFd=" + std::to_string(LrWpanProcessPool::RESULT_FD));
+        return argv;
+    };
+
+    // 1. Fingerprint every point.
+    std::vector<std::string> configs(points.size());
+    {
+        LrWpanProcessPool pool(m_maxWorkers);
+        pool.SetQuiet(true);
+        pool.SetCompletionCallback(LrWpanProcessPool::CompletionCallback(
+            [&configs](uint32_t id, int status, const std::string& output) {
+                NS_ABORT_MSG_IF(status != 0 || output.empty(),
+                                "Cannot fingerprint sweep point " << id);
+                configs[id] = output;
+            }));
+        for (const auto& point : points)
+        {
+            std::vector<std::string> argv = commandLine(point);
+            argv.push_back("--printConfig=true");
+            pool.AddCommand(argv);
+        }
+        pool.Run();
+    }
+
+    // 2. Skip the points already in the store.
+    std::vector<uint32_t> pending;
+    std::vector<std::string> hashes(points.size());
+    for (uint32_t i = 0; i < points.size(); i++)
+    {
+        hashes[i] = Hash(configs[i]);
+        if (std::filesystem::exists(GetRecordPath(hashes[i])))
+        {
+            stats.cached++;
+        }
+        else
+        {
+            pending.push_back(i);
+        }
+    }
+    NS_LOG_INFO("Sweep: " << stats.points << " points, " << stats.cached << " cached");
+
+    // 3. Longest jobs first, so that the pool does not end on a long straggler.
+    if (!m_costParameter.empty())
+    {
+        std::string key = "--" + m_costParameter + "=";
+        auto cost = [&points, &key](uint32_t i) {
+            for (const auto& arg : points[i])
+            {
+                if (arg.compare(0, key.size(), key) == 0)
+                {
+                    return std::atof(arg.c_str() + key.size());
+                }
+            }
+            return 0.0;
+        };
+        std::stable_sort(pending.begin(), pending.end(), [&cost](uint32_t a, uint32_t b) {
+            return cost(a) > cost(b);
+        });
+    }
+
+    // 4. Simulate the rest; each point is committed to the store when it finishes.
+    LrWpanProcessPool pool(m_maxWorkers);
+    pool.SetQuiet(true);
+    std::vector<uint32_t> jobToPoint;
+    jobToPoint.reserve(pending.size());
+    pool.SetCompletionCallback(LrWpanProcessPool::CompletionCallback(
+        [this, &stats, &jobToPoint, &hashes, &configs](uint32_t id,
+                                                       int status,
+                                                       const std::string& output) {
+            uint32_t point = jobToPoint[id];
+            if (status != 0 || LrWpanProcessPool::ParseRecords(output).empty())
+            {
+                NS_LOG_WARN("Sweep point " << hashes[point] << " failed with status " << status);
+                stats.failed++;
+                return;
+            }
+            // The configuration goes first: a .rec file marks a complete entry.
+            if (WriteFile(m_store + "/" + hashes[point] + ".cfg", configs[point]) &&
+                WriteFile(GetRecordPath(hashes[point]), output))
+            {
+                stats.done++;
+            }
+            else
+            {
+                stats.failed++;
+            }
+            NS_LOG_INFO("Sweep point " << hashes[point] << " stored");
+        }));
+    for (uint32_t i : pending)
+    {
+        jobToPoint.push_back(i);
+        pool.AddCommand(commandLine(points[i]));
+    }
+    pool.Run();
+
+    return stats;
+}
+
+} // namespace ns3
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_SWEEP_HELPER_H
+#define LR_WPAN_SWEEP_HELPER_H
+
+#include "lr-wpan-process-pool.h"
+
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Resumable parameter sweep with a content addressed result store.
+ *
+ * The sweep is the cartesian product of a declarative grid of command line
+ * parameters. Before anything is simulated, each point is fingerprinted by
+ * running the program with --printConfig, which must print every input that
+ * determines the results (parameters, per-TP node counts, CSMA/CA tables, seed
+ * and run). The fingerprint is hashed, and a point whose hash already has an
+ * entry in the store directory is skipped.
+ *
+ * The remaining points run on a LrWpanProcessPool, the most expensive ones
+ * first (see SetCostParameter()). Each finished point is stored with a write to
+ * a temporary file followed by an atomic rename, so an interrupted sweep
+ * only loses the points that were running, and extending the grid only
+ * simulates the new points.
+ *
+ * Store layout: <store>/<hash>.rec holds the "name value" result records and
+ * <store>/<hash>.cfg the configuration that produced them.
+ */
+class LrWpanSweepHelper
+{
+  public:
+    /**
+     * Sweep statistics.
+     */
+    struct Stats
+    {
+        uint32_t points; //!< Points in the grid
+        uint32_t cached; //!< Points found in the store
+        uint32_t done;   //!< Points simulated successfully
+        uint32_t failed; //!< Points whose simulation failed
+    };
+
+    LrWpanSweepHelper();
+
+    /**
+     * \param program the path of the simulation program
+     */
+    void SetProgram(std::string program);
+
+    /**
+     * \param args arguments passed to every point, before the grid parameters
+     */
+    void SetArguments(std::vector<std::string> args);
+
+    /**
+     * \param store the result store directory (created if needed)
+     */
+    void SetStore(std::string store);
+
+    /**
+     * \param workers the maximum number of concurrent simulations, 0 for one per processor
+     */
+    void SetMaxWorkers(uint32_t workers);
+
+    /**
+     * \brief Select the parameter used to order the points, largest values first.
+     * \param name the parameter name, empty to keep the grid order
+     */
+    void SetCostParameter(std::string name);
+
+    /**
+     * \brief Add a grid dimension.
+     * \param name the command line option name, without leading dashes
+     * \param values the values to sweep
+     */
+    void AddParameter(std::string name, std::vector<std::string> values);
+
+    /**
+     * \brief Read grid dimensions from a stream.
+     *
+     * One dimension per line, as "name = v1 v2 ...". Integer ranges can be
+     * written as "a..b". Empty lines and lines starting with '#' are ignored.
+     *
+     * \param is the input stream
+     */
+    void LoadGrid(std::istream& is);
+
+    /**
+     * \return the command line arguments of every grid point
+     */
+    std::vector<std::vector<std::string>> GetPoints() const;
+
+    /**
+     * \brief Run the sweep.
+     * \return the sweep statistics
+     */
+    Stats Run();
+
+    /**
+     * \brief 64-bit FNV-1a hash of a configuration, as 16 hex digits.
+     * \param config the configuration text
+     * \return the hash
+     */
+    static std::string Hash(const std::string& config);
+
+  private:
+    /**
+     * \param hash a point hash
+     * \return the path of the result records of the point
+     */
+    std::string GetRecordPath(const std::string& hash) const;
+
+    /**
+     * \brief Atomically write a file into the store.
+     * \param path the destination path
+     * \param content the file content
+     * \return true on success
+     */
+    bool WriteFile(const std::string& path, const std::string& content) const;
+
+    std::string m_program;                                         //!< The program
+    std::vector<std::string> m_args;                               //!< Fixed arguments
+    std::string m_store;                                           //!< Result directory
+    uint32_t m_maxWorkers;                                         //!< Max concurrent workers
+    std::string m_costParameter;                                   //!< Ordering parameter
+    std::vector<std::pair<std::string, std::vector<std::string>>> m_grid; //!< Grid dimensions
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_SWEEP_HELPER_H */
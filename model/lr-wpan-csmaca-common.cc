@@ -37,7 +37,11 @@ LrWpanCsmaCaCommon::GetTypeId()
     static TypeId tid = TypeId("ns3::lrwpan::LrWpanCsmaCaCommon")
                             .AddDeprecatedName("ns3::LrWpanCsmaCaCommon")
                             .SetParent<Object>()
-                            .SetGroupName("LrWpan");
+                            .SetGroupName("LrWpan")
+                            .AddTraceSource("csmaCaDeferTrace",
+                                            "Transmission deferred to the next CAP",
+                                            MakeTraceSourceAccessor(&LrWpanCsmaCaCommon::m_csmaCaDeferTrace),
+                                            "ns3::TracedCallback");
                             // .AddConstructor<LrWpanCsmaCaCommon>();
     return tid;
 }
@@ -45,5 +49,49 @@ LrWpanCsmaCaCommon::GetTypeId()
 LrWpanCsmaCaCommon::~LrWpanCsmaCaCommon()
 {
 }
+
+std::pair<uint32_t, uint32_t>
+LrWpanCsmaCaCommon::GetCwRange()
+{
+    return {0, (1U << m_BE) - 1};
+}
+
+void
+LrWpanCsmaCaCommon::SetTP(uint8_t tp)
+{
+    NS_ASSERT(tp <= 7);
+    m_TP = tp;
+}
+
+uint8_t
+LrWpanCsmaCaCommon::GetTP() const
+{
+    return m_TP;
+}
+
+void
+PrintTpTable(std::ostream& os, const std::string& name, const uint32_t* table, uint32_t count)
+{
+    os << name;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        os << " " << table[i];
+    }
+    os << std::endl;
+}
+
+void
+PrintTpTable(std::ostream& os,
+             const std::string& name,
+             const std::pair<uint32_t, uint32_t>* table,
+             uint32_t count)
+{
+    os << name;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        os << " " << table[i].first << ":" << table[i].second;
+    }
+    os << std::endl;
+}
 }
 }
\ No newline at end of file
@@ -15,6 +15,11 @@
 #include "lr-wpan-mac.h"
 
 #include <ns3/object.h>
+#include <ns3/traced-callback.h>
+
+#include <ostream>
+#include <string>
+#include <utility>
 
 namespace ns3
 {
@@ -40,6 +45,34 @@ typedef Callback<void, MacState> LrWpanMacStateCallback;
  */
 typedef Callback<void, uint32_t> LrWpanMacTransCostCallback;
 
+/**
+ * \ingroup lr-wpan
+ *
+ * Print a per-TP table on one line as "name v0 v1 ...".
+ * Used by the CSMA/CA variants to report their static configuration.
+ *
+ * \param os the output stream
+ * \param name the table name
+ * \param table the per-TP values
+ * \param count the number of TPs
+ */
+void PrintTpTable(std::ostream& os, const std::string& name, const uint32_t* table, uint32_t count);
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Print a per-TP range table on one line as "name min0:max0 min1:max1 ...".
+ *
+ * \param os the output stream
+ * \param name the table name
+ * \param table the per-TP ranges
+ * \param count the number of TPs
+ */
+void PrintTpTable(std::ostream& os,
+                  const std::string& name,
+                  const std::pair<uint32_t, uint32_t>* table,
+                  uint32_t count);
+
 /**
  * \ingroup lr-wpan
  *
@@ -150,6 +183,33 @@ class LrWpanCsmaCaCommon : public Object
      * \param macState the mac state callback
      */
     virtual void SetLrWpanMacStateCallback(LrWpanMacStateCallback c) = 0;
+    /**
+     * Get the backoff window the next random backoff of this device is drawn from.
+     * The default is the BEB window [0, 2^BE - 1]; variants with per-TP contention
+     * windows report the window of their TP.
+     *
+     * \return the (min, max) backoff window, in backoff periods
+     */
+    virtual std::pair<uint32_t, uint32_t> GetCwRange();
+    /**
+     * Set the TP of this device. Variants keeping per-TP state reset it for the
+     * new TP, so this is meant to be called before the device transmits.
+     *
+     * \param tp the TP, 0 to 7
+     */
+    virtual void SetTP(uint8_t tp);
+    /**
+     * Get the TP of this device.
+     *
+     * \return the TP
+     */
+    uint8_t GetTP() const;
+    /**
+     * Get the MAC CSMA/CA option (LrWpanMac::SetCsmaCaOption) this variant runs with.
+     *
+     * \return the CSMA/CA option
+     */
+    virtual CsmaOption GetCsmaOption() const = 0;
   protected:
     virtual void DoDispose() = 0;
     /**
@@ -241,6 +301,11 @@ class LrWpanCsmaCaCommon : public Object
      * The trace source fired when collision occurs.
      */
     // TracedCallback<uint8_t, uint32_t> m_csmaCaCollisionTrace;
+    /**
+     * The trace source fired when a transmission is deferred to the next CAP,
+     * with the TP of the device.
+     */
+    TracedCallback<uint8_t> m_csmaCaDeferTrace;
     /**
      * Traffic Priority
      */
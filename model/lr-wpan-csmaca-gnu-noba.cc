@@ -7,8 +7,9 @@
  *  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
  */
 
-#include "lr-wpan-csmaca-gnu-noba.h"
 #include "lr-wpan-constants.h"
+#include "lr-wpan-csmaca-gnu-noba.h"
+#include "lr-wpan-profiler.h"
 
 #include <ns3/log.h>
 #include <ns3/random-variable-stream.h>
@@ -78,6 +79,15 @@ LrWpanCsmaCaGnuNoba::GetTypeId()
     return tid;
 }
 
+void
+LrWpanCsmaCaGnuNoba::PrintConfiguration(std::ostream& os)
+{
+    PrintTpTable(os, "WL", WL, TP_COUNT);
+    PrintTpTable(os, "TP_M", TP_M, TP_COUNT);
+    PrintTpTable(os, "TP_K", TP_K, TP_COUNT);
+    os << "SUCCESS_WINDOW " << WINDOW_COUNT << std::endl;
+}
+
 void
 LrWpanCsmaCaGnuNoba::InitializeAggregations()
 {
@@ -361,8 +371,8 @@ LrWpanCsmaCaGnuNoba::LrWpanCsmaCaGnuNoba(uint8_t priority)
 }
 
 LrWpanCsmaCaGnuNoba::LrWpanCsmaCaGnuNoba()
+    : LrWpanCsmaCaGnuNoba(0)
 {
-    NS_ASSERT_MSG(false, "nodeCount, priority missing.");
 }
 
 LrWpanCsmaCaGnuNoba::~LrWpanCsmaCaGnuNoba()
@@ -474,6 +484,7 @@ void
 LrWpanCsmaCaGnuNoba::Start()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaGnuNoba::Start");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA-CA supported.");
 
     m_collisions = 0; // collision counter C
@@ -507,6 +518,7 @@ void
 LrWpanCsmaCaGnuNoba::RandomBackoffDelay()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaGnuNoba::RandomBackoffDelay");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA/CA is supported.");
 
     Time randomBackoff;
@@ -591,6 +603,7 @@ void
 LrWpanCsmaCaGnuNoba::CanProceed()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaGnuNoba::CanProceed");
 
     Time timeLeftInCap;
     uint16_t ccaSymbols;
@@ -666,6 +679,7 @@ void
 LrWpanCsmaCaGnuNoba::RequestCCA()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaGnuNoba::RequestCCA");
     m_ccaRequestRunning = true;
     m_mac->GetPhy()->PlmeCcaRequest();
 }
@@ -674,6 +688,8 @@ void
 LrWpanCsmaCaGnuNoba::DeferCsmaTimeout()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaGnuNoba::DeferCsmaTimeout");
+    m_csmaCaDeferTrace(m_TP);
     m_lrWpanMacStateCallback(MAC_CSMA_DEFERRED);
 }
 
@@ -681,6 +697,7 @@ void
 LrWpanCsmaCaGnuNoba::PlmeCcaConfirm(PhyEnumeration status)
 {
     NS_LOG_FUNCTION(this << status);
+    LRWPAN_PROFILE("CsmaCaGnuNoba::PlmeCcaConfirm");
 
     // Only react on this event, if we are actually waiting for a CCA.
     // If the CSMA algorithm was canceled, we could still receive this event from
@@ -754,12 +771,33 @@ LrWpanCsmaCaGnuNoba::GetNB()
     return m_collisions;
 }
 
+std::pair<uint32_t, uint32_t>
+LrWpanCsmaCaGnuNoba::GetCwRange()
+{
+    return CW[m_TP];
+}
+
 bool
 LrWpanCsmaCaGnuNoba::GetBatteryLifeExtension()
 {
     return m_macBattLifeExt;
 }
 
+CsmaOption
+LrWpanCsmaCaGnuNoba::GetCsmaOption() const
+{
+    return CSMA_GNU_NOBA;
+}
+
+void
+LrWpanCsmaCaGnuNoba::SetTP(uint8_t tp)
+{
+    LrWpanCsmaCaCommon::SetTP(tp);
+    m_M = TP_M[m_TP];
+    m_K = TP_K[m_TP];
+    m_resultQueue.assign(m_K, true);
+}
+
 uint32_t
 LrWpanCsmaCaGnuNoba::BetaMappedRandom(const double alpha, const double beta, uint32_t x, uint32_t y)
 {
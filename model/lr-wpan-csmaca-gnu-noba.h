@@ -71,6 +71,13 @@ class LrWpanCsmaCaGnuNoba: public LrWpanCsmaCaCommon
      * we have to calculate and deploy new CW range.
      */
     static void CalculateCWRanges();
+    /**
+     * Print the static per-TP configuration tables of this variant, one
+     * "name v0 v1 ..." line per table, in a stable order.
+     *
+     * \param os the output stream
+     */
+    static void PrintConfiguration(std::ostream& os);
     /**
     * Get the type ID.
     *
@@ -78,7 +85,7 @@ class LrWpanCsmaCaGnuNoba: public LrWpanCsmaCaCommon
     */
     static TypeId GetTypeId();
     /**
-    * Default constructor.
+    * Default constructor, for a device of TP 0 (see SetTP).
     */
     LrWpanCsmaCaGnuNoba();
     ~LrWpanCsmaCaGnuNoba() override;
@@ -247,20 +254,25 @@ class LrWpanCsmaCaGnuNoba: public LrWpanCsmaCaCommon
     * \returns the number of CSMA retries
     */
     uint8_t GetNB() override;
+    /**
+     * Get the contention window of this device's TP.
+     *
+     * \return the (min, max) contention window
+     */
+    std::pair<uint32_t, uint32_t> GetCwRange() override;
     /**
     * Get the value of the Battery Life Extension
     *
     * \returns  true or false to Battery Life Extension support
     */
     bool GetBatteryLifeExtension() override;
-    void SetTP(uint8_t TP)
-    {
-      m_TP = TP;
-    }
-    uint8_t GetTP()
-    {
-      return m_TP;
-    }
+    /**
+    * Set the TP of this device, its (m,k) model and reset its (m,k) history.
+    *
+    * \param tp the TP, 0 to 7
+    */
+    void SetTP(uint8_t tp) override;
+    CsmaOption GetCsmaOption() const override;
   uint32_t GetK() const { return m_K; }
   void SetK(uint32_t k) { m_K = k; }
   uint32_t GetM() const { return m_M; }
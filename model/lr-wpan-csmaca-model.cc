@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-csmaca-model.h"
+
+#include "lr-wpan-constants.h"
+#include "lr-wpan-csmaca-gnu-noba.h"
+#include "lr-wpan-csmaca-noba.h"
+#include "lr-wpan-csmaca-standard.h"
+#include "lr-wpan-csmaca-sw-noba.h"
+#include "lr-wpan-csmaca.h"
+
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanCsmaCaModel");
+
+/// Symbols per second of the 2.4 GHz O-QPSK PHY
+static constexpr double SYMBOL_RATE = 62500;
+/// PHY synchronization header and PHR (bytes)
+static constexpr uint32_t PHY_OVERHEAD = 6;
+/// MHR and MFR of a data frame with short addresses and PAN ID compression (bytes)
+static constexpr uint32_t DATA_OVERHEAD = 11;
+/// MPDU of an ACK (bytes)
+static constexpr uint32_t ACK_SIZE = 5;
+/// MPDU of a beacon without GTS, pending addresses or payload (bytes)
+static constexpr uint32_t BEACON_SIZE = 13;
+/// macAckWaitDuration (symbols)
+static constexpr uint32_t ACK_WAIT = 54;
+/// Short and long IFS (symbols)
+static constexpr uint32_t SIFS = 12;
+static constexpr uint32_t LIFS = 40;
+/// Access time standing for "never" (slots)
+static constexpr double NEVER = 1e12;
+
+LrWpanCsmaCaModel::LrWpanCsmaCaModel()
+    : m_mode(BLIND_BACKOFF),
+      m_ccaCount(2),
+      m_maxBackoffs(4),
+      m_maxWindow(31),
+      m_retries(3),
+      m_beaconOrder(15),
+      m_superframeOrder(15),
+      m_payloadSize(50),
+      m_busy(0),
+      m_iterations(0)
+{
+    for (uint32_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        m_cw[tp] = {0, 7};
+        m_nodes[tp] = 0;
+        m_load[tp] = 0;
+    }
+}
+
+void
+LrWpanCsmaCaModel::Configure(CsmaOption option)
+{
+    NS_LOG_FUNCTION(this << option);
+    switch (option)
+    {
+    case CSMA_ORIGINAL: {
+        Ptr<LrWpanCsmaCa> csma = CreateObject<LrWpanCsmaCa>();
+        SetBackoffMode(BLIND_BACKOFF);
+        SetCcaCount(2);
+        SetMaxBackoffs(csma->GetMacMaxCSMABackoffs(), (1U << csma->GetMacMaxBE()) - 1);
+        for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            SetContentionWindow(tp, 0, (1U << csma->GetMacMinBE()) - 1);
+        }
+        return;
+    }
+    case CSMA_NOBA:
+        LrWpanCsmaCaNoba::InitializeGlobals(true);
+        SetBackoffMode(RESTART_COUNTDOWN);
+        for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            auto cw = CreateObject<LrWpanCsmaCaNoba>(tp)->GetCwRange();
+            SetContentionWindow(tp, cw.first, cw.second);
+        }
+        return;
+    case CSMA_SW_NOBA:
+        LrWpanCsmaCaSwNoba::InitializeGlobals(true);
+        SetBackoffMode(RESTART_COUNTDOWN);
+        for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            auto cw = CreateObject<LrWpanCsmaCaSwNoba>(tp)->GetCwRange();
+            SetContentionWindow(tp, cw.first, cw.second);
+        }
+        return;
+    case CSMA_STANDARD:
+        SetBackoffMode(FREEZE_COUNTDOWN);
+        for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            auto cw = CreateObject<LrWpanCsmaCaStandard>(tp)->GetCwRange();
+            SetContentionWindow(tp, cw.first, cw.second);
+        }
+        return;
+    case CSMA_GNU_NOBA:
+        LrWpanCsmaCaGnuNoba::UpdateCW();
+        SetBackoffMode(RESTART_COUNTDOWN);
+        for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            auto cw = CreateObject<LrWpanCsmaCaGnuNoba>(tp)->GetCwRange();
+            SetContentionWindow(tp, cw.first, cw.second);
+        }
+        return;
+    }
+    NS_FATAL_ERROR("Unknown CSMA/CA option " << option);
+}
+
+void
+LrWpanCsmaCaModel::SetBackoffMode(BackoffMode mode)
+{
+    m_mode = mode;
+}
+
+void
+LrWpanCsmaCaModel::SetCcaCount(uint32_t ccaCount)
+{
+    NS_ASSERT_MSG(ccaCount > 0, "At least one CCA is needed");
+    m_ccaCount = ccaCount;
+}
+
+void
+LrWpanCsmaCaModel::SetMaxBackoffs(uint32_t maxBackoffs, uint32_t maxWindow)
+{
+    m_maxBackoffs = maxBackoffs;
+    m_maxWindow = maxWindow;
+}
+
+void
+LrWpanCsmaCaModel::SetMaxFrameRetries(uint32_t retries)
+{
+    m_retries = retries;
+}
+
+void
+LrWpanCsmaCaModel::SetSuperframe(uint8_t beaconOrder, uint8_t superframeOrder)
+{
+    NS_ASSERT_MSG(beaconOrder == 15 || superframeOrder <= beaconOrder,
+                  "The superframe order cannot exceed the beacon order");
+    m_beaconOrder = beaconOrder;
+    m_superframeOrder = superframeOrder;
+}
+
+void
+LrWpanCsmaCaModel::SetPayloadSize(uint32_t size)
+{
+    NS_ASSERT_MSG(size + DATA_OVERHEAD <= aMaxPhyPacketSize, "Payload too large");
+    m_payloadSize = size;
+}
+
+void
+LrWpanCsmaCaModel::SetContentionWindow(uint8_t tp, uint32_t min, uint32_t max)
+{
+    NS_ASSERT_MSG(tp < TP_COUNT, "TP out of range");
+    NS_ASSERT_MSG(min <= max, "Empty contention window");
+    m_cw[tp] = {min, max};
+}
+
+std::pair<uint32_t, uint32_t>
+LrWpanCsmaCaModel::GetContentionWindow(uint8_t tp) const
+{
+    NS_ASSERT_MSG(tp < TP_COUNT, "TP out of range");
+    return m_cw[tp];
+}
+
+void
+LrWpanCsmaCaModel::SetTraffic(uint8_t tp, uint32_t nodes, double load)
+{
+    NS_ASSERT_MSG(tp < TP_COUNT, "TP out of range");
+    NS_ASSERT_MSG(load >= 0, "Negative load");
+    m_nodes[tp] = nodes;
+    m_load[tp] = load;
+}
+
+double
+LrWpanCsmaCaModel::GetBusyProbability() const
+{
+    return m_busy;
+}
+
+uint32_t
+LrWpanCsmaCaModel::GetIterations() const
+{
+    return m_iterations;
+}
+
+LrWpanCsmaCaModel::Access
+LrWpanCsmaCaModel::GetAccess(uint8_t tp, double busy) const
+{
+    double idle = 1 - busy;
+    uint32_t lo = m_cw[tp].first;
+    uint32_t hi = m_cw[tp].second;
+    Access access{0, 0};
+
+    if (m_mode == BLIND_BACKOFF)
+    {
+        double pass = std::pow(idle, m_ccaCount);
+        double ccaSlots = busy > 0 ? (1 - pass) / busy : m_ccaCount;
+        double stay = 1;
+        for (uint32_t stage = 0; stage <= m_maxBackoffs; stage++)
+        {
+            double window = std::min((hi + 1.0) * std::pow(2.0, stage), m_maxWindow + 1.0) - 1;
+            window = std::max<double>(window, hi);
+            access.slots += stay * ((lo + window) / 2 + ccaSlots);
+            stay *= 1 - pass;
+        }
+        access.failure = stay;
+    }
+    else if (m_mode == RESTART_COUNTDOWN)
+    {
+        // renewal over the draws of B: each try lasts until its first busy
+        // CCA or its B-th idle one
+        double trySlots = 0;
+        double trySuccess = 0;
+        for (uint32_t b = lo; b <= hi; b++)
+        {
+            double allIdle = std::pow(idle, b);
+            trySlots += busy > 0 ? (1 - allIdle) / busy : b;
+            trySuccess += allIdle;
+        }
+        access.slots = trySuccess > 0 ? std::min(trySlots / trySuccess, NEVER) : NEVER;
+    }
+    else
+    {
+        access.slots = idle > 0 ? std::min((lo + hi) / 2.0 / idle, NEVER) : NEVER;
+    }
+    return access;
+}
+
+std::vector<LrWpanCsmaCaModel::TpEstimate>
+LrWpanCsmaCaModel::Estimate()
+{
+    NS_LOG_FUNCTION(this);
+
+    // frame timings, in slots
+    const double slotSeconds = aUnitBackoffPeriod / SYMBOL_RATE;
+    double frame = 2.0 * (PHY_OVERHEAD + DATA_OVERHEAD + m_payloadSize) / aUnitBackoffPeriod;
+    double ack = (aTurnaroundTime + 2.0 * (PHY_OVERHEAD + ACK_SIZE)) / aUnitBackoffPeriod;
+    double ackWait = static_cast<double>(ACK_WAIT) / aUnitBackoffPeriod;
+    double ifs = (DATA_OVERHEAD + m_payloadSize > aMaxSIFSFrameSize ? LIFS : SIFS) /
+                 static_cast<double>(aUnitBackoffPeriod);
+    double busySlots = std::ceil(frame + ack);
+
+    // the CAP, where the load is served
+    double capSlots = 1;
+    double intervalSeconds = slotSeconds;
+    double inactiveSeconds = 0;
+    if (m_beaconOrder < 15)
+    {
+        double superframe = static_cast<double>(aBaseSuperframeDuration) * (1U << m_superframeOrder);
+        double interval = static_cast<double>(aBaseSuperframeDuration) * (1U << m_beaconOrder);
+        double beacon = 2.0 * (PHY_OVERHEAD + BEACON_SIZE) + LIFS;
+        capSlots = (superframe - beacon) / aUnitBackoffPeriod;
+        intervalSeconds = interval / SYMBOL_RATE;
+        inactiveSeconds = (interval - superframe) / SYMBOL_RATE;
+    }
+
+    // offered load per CAP slot of a device
+    double lambda[TP_COUNT];
+    for (uint32_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        lambda[tp] = m_load[tp] * intervalSeconds / capSlots;
+    }
+
+    Access access[TP_COUNT];
+    double collision[TP_COUNT];
+    double attempts[TP_COUNT];
+    double service[TP_COUNT];
+    double served[TP_COUNT];
+    double tx[TP_COUNT];
+
+    // Given the busy probability, solve the transmission probabilities (damped,
+    // the collisions depend on them) and return the busy probability they cause.
+    auto iterate = [&](double busy) -> double {
+        for (uint32_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            access[tp] = GetAccess(tp, busy);
+            tx[tp] = 0;
+        }
+        for (uint32_t k = 0; k < 1000; k++)
+        {
+            double change = 0;
+            for (uint32_t j = 0; j < TP_COUNT; j++)
+            {
+                double clear = 1;
+                for (uint32_t i = 0; i < TP_COUNT; i++)
+                {
+                    uint32_t others = m_nodes[i] - (i == j && m_nodes[i] > 0 ? 1 : 0);
+                    clear *= std::pow(1 - tx[i], others);
+                }
+                collision[j] = 1 - clear;
+
+                double retry = (1 - access[j].failure) * collision[j];
+                attempts[j] = retry < 1 ? (1 - std::pow(retry, m_retries + 1)) / (1 - retry)
+                                        : m_retries + 1;
+                double attempt =
+                    access[j].slots +
+                    (1 - access[j].failure) *
+                        (frame + (1 - collision[j]) * ack + collision[j] * ackWait + ifs);
+                service[j] = attempts[j] * attempt;
+                served[j] = std::min(lambda[j], 1 / service[j]);
+            }
+            for (uint32_t i = 0; i < TP_COUNT; i++)
+            {
+                double next = std::min(served[i] * attempts[i] * (1 - access[i].failure), 1.0);
+                change = std::max(change, std::abs(next - tx[i]));
+                tx[i] = (tx[i] + next) / 2;
+            }
+            if (change < 1e-12)
+            {
+                break;
+            }
+        }
+        double idle = 1;
+        for (uint32_t i = 0; i < TP_COUNT; i++)
+        {
+            idle *= std::pow(1 - tx[i], m_nodes[i] * busySlots);
+        }
+        return 1 - idle;
+    };
+
+    // The busy probability caused decreases with the busy probability assumed:
+    // bisect on their difference.
+    double lo = 0;
+    double hi = 1;
+    for (m_iterations = 1; m_iterations <= 100 && hi - lo > 1e-12; m_iterations++)
+    {
+        double mid = (lo + hi) / 2;
+        if (iterate(mid) > mid)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    m_busy = (lo + hi) / 2;
+    iterate(m_busy);
+    NS_LOG_DEBUG("busy probability " << m_busy << " after " << m_iterations << " iterations");
+
+    std::vector<TpEstimate> estimates(TP_COUNT);
+    for (uint32_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        TpEstimate& e = estimates[tp];
+        e.nodes = m_nodes[tp];
+        e.offered = m_nodes[tp] * m_load[tp];
+        e.accessFailure = access[tp].failure;
+        e.collision = collision[tp];
+        e.success = (1 - access[tp].failure) * (1 - collision[tp]) * attempts[tp];
+        e.throughput = m_nodes[tp] * served[tp] * capSlots / intervalSeconds * e.success;
+
+        double load = lambda[tp] * service[tp];
+        e.saturated = load >= 1;
+        if (e.saturated)
+        {
+            e.delay = std::numeric_limits<double>::infinity();
+        }
+        else
+        {
+            double waiting = lambda[tp] * service[tp] * service[tp] / (2 * (1 - load));
+            e.delay = ((waiting + service[tp]) * slotSeconds +
+                       inactiveSeconds * inactiveSeconds / (2 * intervalSeconds)) *
+                      1000;
+        }
+    }
+    return estimates;
+}
+
+} // namespace lrwpan
+} // namespace ns3
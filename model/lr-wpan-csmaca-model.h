@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_CSMACA_MODEL_H
+#define LR_WPAN_CSMACA_MODEL_H
+
+#define TP_COUNT 8
+
+#include "lr-wpan-mac.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Analytical estimate of the per-TP performance of the slotted CSMA/CA
+ *        variants, in the spirit of the Bianchi and Pollin models.
+ *
+ * The model is a fixed point on the probability b that a CCA finds the
+ * channel busy, solved in backoff periods (slots) of the CAP:
+ *
+ * - given b, the expected number of slots D_i from the start of an access to
+ *   the transmission and the channel access failure probability f_i of a
+ *   device of TP i follow from the backoff rule of the variant and the
+ *   contention window of the TP;
+ * - a frame collides when another device starts a transmission in the same
+ *   slot, with probability pc_i; a collided frame is retried up to
+ *   macMaxFrameRetries times, a channel access failure drops it;
+ * - the service time S_i of a packet is the expected number of attempts times
+ *   the attempt duration, and a device transmits in a slot with probability
+ *   t_i = min(lambda_i, 1 / S_i) * attempts * (1 - f_i), lambda_i being its
+ *   offered load per CAP slot;
+ * - a slot is busy when a transmission (frame and ACK, L slots) started in
+ *   one of the L slots before: b = 1 - prod_i (1 - t_i)^(L n_i).
+ *
+ * The busy probability so obtained decreases with the one assumed, and the
+ * fixed point is found by bisection, which also converges in saturation.
+ *
+ * Three backoff rules cover the engines of this module:
+ * - BLIND_BACKOFF (IEEE 802.15.4 BEB): wait a random backoff, then require
+ *   ccaCount idle CCAs; a busy CCA starts a new stage with a doubled window,
+ *   up to maxBackoffs stages;
+ * - RESTART_COUNTDOWN (NOBA, SW-NOBA, GNU-NOBA): the backoff counter B is
+ *   decremented by each idle CCA and a busy CCA draws a new B, so B
+ *   consecutive idle slots are needed;
+ * - FREEZE_COUNTDOWN (IEEE 802.15.6): B is decremented by each idle CCA and
+ *   frozen by a busy one.
+ *
+ * Arrivals are assumed Poisson and independent across devices, the backoff
+ * uniform over the contention window and the slots independent; the mean
+ * delay is the M/G/1 waiting time plus the service time, plus the mean wait
+ * of the packets arriving in the inactive period. The estimates are meant to
+ * rank configurations before simulating them, not to replace the simulation:
+ * the adaptive windows of SW-NOBA and GNU-NOBA are frozen at their initial
+ * value, and GNU-NOBA's beta-distributed backoff is taken as uniform.
+ */
+class LrWpanCsmaCaModel
+{
+  public:
+    /**
+     * The backoff rule of a CSMA/CA variant.
+     */
+    enum BackoffMode
+    {
+        BLIND_BACKOFF,     //!< Backoff, then ccaCount CCAs (IEEE 802.15.4)
+        RESTART_COUNTDOWN, //!< CCA per backoff slot, new backoff on busy (NOBA)
+        FREEZE_COUNTDOWN   //!< CCA per backoff slot, frozen on busy (IEEE 802.15.6)
+    };
+
+    /**
+     * Estimate for one TP.
+     */
+    struct TpEstimate
+    {
+        uint32_t nodes;       //!< Devices of the TP
+        double offered;       //!< Offered load of the TP (packets/s)
+        double accessFailure; //!< Channel access failure probability per attempt
+        double collision;     //!< Collision probability per transmission
+        double success;       //!< Probability that a packet is acknowledged
+        double throughput;    //!< Acknowledged packets of the TP (packets/s)
+        double delay;         //!< Mean delay from arrival to the end of service (ms)
+        bool saturated;       //!< The devices cannot serve their load
+    };
+
+    LrWpanCsmaCaModel();
+
+    /**
+     * \brief Take the backoff rule and the contention windows of a variant.
+     *
+     * The windows are those of freshly initialized engines; this resets the
+     * process-wide windows of the NOBA variants, so it must not be called while
+     * they are simulated.
+     *
+     * \param option the CSMA/CA variant
+     */
+    void Configure(CsmaOption option);
+
+    /**
+     * \param mode the backoff rule
+     */
+    void SetBackoffMode(BackoffMode mode);
+
+    /**
+     * \param ccaCount the consecutive idle CCAs required after a blind backoff
+     */
+    void SetCcaCount(uint32_t ccaCount);
+
+    /**
+     * \param maxBackoffs the backoff stages after the first one before a
+     *        channel access failure (blind backoff only)
+     * \param maxWindow the largest backoff window, in slots (blind backoff only)
+     */
+    void SetMaxBackoffs(uint32_t maxBackoffs, uint32_t maxWindow);
+
+    /**
+     * \param retries the retransmissions of a collided frame
+     */
+    void SetMaxFrameRetries(uint32_t retries);
+
+    /**
+     * \param beaconOrder the beacon order, 15 for a non beacon-enabled PAN
+     * \param superframeOrder the superframe order
+     */
+    void SetSuperframe(uint8_t beaconOrder, uint8_t superframeOrder);
+
+    /**
+     * \param size the MAC payload size (bytes)
+     */
+    void SetPayloadSize(uint32_t size);
+
+    /**
+     * \param tp the TP
+     * \param min the smallest backoff, in slots
+     * \param max the largest backoff, in slots
+     */
+    void SetContentionWindow(uint8_t tp, uint32_t min, uint32_t max);
+
+    /**
+     * \param tp the TP
+     * \return the contention window of the TP, in slots
+     */
+    std::pair<uint32_t, uint32_t> GetContentionWindow(uint8_t tp) const;
+
+    /**
+     * \param tp the TP
+     * \param nodes the devices of the TP
+     * \param load the offered load of each device (packets/s)
+     */
+    void SetTraffic(uint8_t tp, uint32_t nodes, double load);
+
+    /**
+     * \brief Solve the model.
+     * \return the estimate of each TP
+     */
+    std::vector<TpEstimate> Estimate();
+
+    /**
+     * \return the probability that a CCA finds the channel busy, at the last
+     *         Estimate()
+     */
+    double GetBusyProbability() const;
+
+    /**
+     * \return the bisection steps of the last Estimate()
+     */
+    uint32_t GetIterations() const;
+
+  private:
+    /**
+     * Access of a device of a TP, for a busy probability.
+     */
+    struct Access
+    {
+        double slots;   //!< Expected slots from the access start to the transmission
+        double failure; //!< Channel access failure probability
+    };
+
+    /**
+     * \param tp the TP
+     * \param busy the probability that a CCA finds the channel busy
+     * \return the access of a device of the TP
+     */
+    Access GetAccess(uint8_t tp, double busy) const;
+
+    BackoffMode m_mode;                                //!< Backoff rule
+    uint32_t m_ccaCount;                               //!< CCAs after a blind backoff
+    uint32_t m_maxBackoffs;                            //!< Extra blind backoff stages
+    uint32_t m_maxWindow;                              //!< Largest blind backoff window
+    uint32_t m_retries;                                //!< Frame retries
+    uint8_t m_beaconOrder;                             //!< Beacon order
+    uint8_t m_superframeOrder;                         //!< Superframe order
+    uint32_t m_payloadSize;                            //!< MAC payload (bytes)
+    std::pair<uint32_t, uint32_t> m_cw[TP_COUNT];      //!< Contention windows
+    uint32_t m_nodes[TP_COUNT];                        //!< Devices per TP
+    double m_load[TP_COUNT];                           //!< Load per device (packets/s)
+    double m_busy;                                     //!< Solved busy probability
+    uint32_t m_iterations;                             //!< Iterations of the last solve
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_CSMACA_MODEL_H */
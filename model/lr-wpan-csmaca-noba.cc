@@ -7,8 +7,9 @@
  *  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
  */
 
-#include "lr-wpan-csmaca-noba.h"
 #include "lr-wpan-constants.h"
+#include "lr-wpan-csmaca-noba.h"
+#include "lr-wpan-profiler.h"
 
 #include <ns3/log.h>
 #include <ns3/random-variable-stream.h>
@@ -50,6 +51,15 @@ LrWpanCsmaCaNoba::GetTypeId()
     return tid;
 }
 
+void
+LrWpanCsmaCaNoba::PrintConfiguration(std::ostream& os)
+{
+    // The windows are derived from SW and WL, report their initial values.
+    InitializeGlobals(true);
+    PrintTpTable(os, "WL", WL, TP_COUNT);
+    PrintTpTable(os, "CW", CW, TP_COUNT);
+}
+
 void
 LrWpanCsmaCaNoba::InitializeGlobals(bool init)
 {
@@ -128,8 +138,8 @@ LrWpanCsmaCaNoba::LrWpanCsmaCaNoba(uint8_t priority)
 }
 
 LrWpanCsmaCaNoba::LrWpanCsmaCaNoba()
+    : LrWpanCsmaCaNoba(0)
 {
-    NS_ASSERT_MSG(false, "nodeCount, priority missing.");
 }
 
 LrWpanCsmaCaNoba::~LrWpanCsmaCaNoba()
@@ -241,6 +251,7 @@ void
 LrWpanCsmaCaNoba::Start()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaNoba::Start");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA-CA supported.");
 
     m_collisions = 0; // collision counter C
@@ -273,6 +284,7 @@ void
 LrWpanCsmaCaNoba::RandomBackoffDelay()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaNoba::RandomBackoffDelay");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA/CA is supported.");
 
     Time randomBackoff;
@@ -361,6 +373,7 @@ void
 LrWpanCsmaCaNoba::CanProceed()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaNoba::CanProceed");
 
     Time timeLeftInCap;
     uint16_t ccaSymbols;
@@ -436,6 +449,7 @@ void
 LrWpanCsmaCaNoba::RequestCCA()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaNoba::RequestCCA");
     m_ccaRequestRunning = true;
     m_mac->GetPhy()->PlmeCcaRequest();
 }
@@ -444,6 +458,8 @@ void
 LrWpanCsmaCaNoba::DeferCsmaTimeout()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaNoba::DeferCsmaTimeout");
+    m_csmaCaDeferTrace(m_TP);
     m_lrWpanMacStateCallback(MAC_CSMA_DEFERRED);
 }
 
@@ -451,6 +467,7 @@ void
 LrWpanCsmaCaNoba::PlmeCcaConfirm(PhyEnumeration status)
 {
     NS_LOG_FUNCTION(this << status);
+    LRWPAN_PROFILE("CsmaCaNoba::PlmeCcaConfirm");
 
     // Only react on this event, if we are actually waiting for a CCA.
     // If the CSMA algorithm was canceled, we could still receive this event from
@@ -524,12 +541,24 @@ LrWpanCsmaCaNoba::GetNB()
     return m_collisions;
 }
 
+std::pair<uint32_t, uint32_t>
+LrWpanCsmaCaNoba::GetCwRange()
+{
+    return CW[m_TP];
+}
+
 bool
 LrWpanCsmaCaNoba::GetBatteryLifeExtension()
 {
     return m_macBattLifeExt;
 }
 
+CsmaOption
+LrWpanCsmaCaNoba::GetCsmaOption() const
+{
+    return CSMA_NOBA;
+}
+
 void
 LrWpanCsmaCaNoba::SetBackoffCounter()
 {
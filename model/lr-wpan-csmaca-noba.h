@@ -56,6 +56,13 @@ class LrWpanCsmaCaNoba : public LrWpanCsmaCaCommon
 
   public:
      static void InitializeGlobals(bool init);
+    /**
+     * Print the static per-TP configuration tables of this variant, one
+     * "name v0 v1 ..." line per table, in a stable order.
+     *
+     * \param os the output stream
+     */
+    static void PrintConfiguration(std::ostream& os);
   
      /**
       * Get the type ID.
@@ -64,7 +71,7 @@ class LrWpanCsmaCaNoba : public LrWpanCsmaCaCommon
       */
      static TypeId GetTypeId();
      /**
-      * Default constructor.
+      * Default constructor, for a device of TP 0 (see SetTP).
       */     
     LrWpanCsmaCaNoba();
     ~LrWpanCsmaCaNoba() override;
@@ -236,21 +243,19 @@ class LrWpanCsmaCaNoba : public LrWpanCsmaCaCommon
       * \returns the number of CSMA retries
       */
      uint8_t GetNB() override;
+     /**
+      * Get the contention window of this device's TP.
+      *
+      * \return the (min, max) contention window
+      */
+     std::pair<uint32_t, uint32_t> GetCwRange() override;
      /**
       * Get the value of the Battery Life Extension
       *
       * \returns  true or false to Battery Life Extension support
       */
-     bool GetBatteryLifeExtension() override;     
-    void SetTP(uint8_t TP)
-    {
-      m_TP = TP;
-    }
-
-    uint8_t GetTP()
-    {
-      return m_TP;
-    }
+     bool GetBatteryLifeExtension() override;
+     CsmaOption GetCsmaOption() const override;
 
     /**
      * when ACK timeout occured, modify CW, SW and get backoff counter value
@@ -7,8 +7,9 @@
  *  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
  */
 
-#include "lr-wpan-csmaca-standard.h"
 #include "lr-wpan-constants.h"
+#include "lr-wpan-csmaca-standard.h"
+#include "lr-wpan-profiler.h"
 
 #include <ns3/log.h>
 #include <ns3/random-variable-stream.h>
@@ -32,7 +33,8 @@ NS_LOG_COMPONENT_DEFINE("LrWpanCsmaCaStandard");
 NS_OBJECT_ENSURE_REGISTERED(LrWpanCsmaCaStandard);
 
 
-std::pair<uint32_t, uint32_t> LrWpanCsmaCaStandard::CW[TP_COUNT]; // each TP
+std::pair<uint32_t, uint32_t> LrWpanCsmaCaStandard::CW[TP_COUNT] = {
+    {16, 64}, {16, 32}, {8, 32}, {8, 16}, {4, 16}, {4, 8}, {2, 8}, {1, 4}}; // each TP
 
 
 uint32_t LrWpanCsmaCaStandard::TP_M[TP_COUNT] = {6, 6, 7, 7, 8, 8, 9, 10}; // each TP
@@ -60,21 +62,19 @@ LrWpanCsmaCaStandard::GetTypeId()
     return tid;
 }
 
+void
+LrWpanCsmaCaStandard::PrintConfiguration(std::ostream& os)
+{
+    PrintTpTable(os, "CW", CW, TP_COUNT);
+    PrintTpTable(os, "TP_M", TP_M, TP_COUNT);
+    PrintTpTable(os, "TP_K", TP_K, TP_COUNT);
+}
+
 
 LrWpanCsmaCaStandard::LrWpanCsmaCaStandard(uint8_t priority)
 {
     NS_ASSERT(priority >= 0 && priority <= 7);
 
-    CW[0].first = 16; CW[1].first = 16;
-    CW[2].first = 8;  CW[3].first = 8;
-    CW[4].first = 4;  CW[5].first = 4;
-    CW[6].first = 2;  CW[7].first = 1;
-
-    CW[0].second = 64; CW[1].second = 32;
-    CW[2].second = 32; CW[3].second = 16;
-    CW[4].second = 16; CW[5].second = 8;
-    CW[6].second = 8;  CW[7].second = 4;
-
     m_isSlotted = true;
     m_macBattLifeExt = false;
     m_random = CreateObject<UniformRandomVariable>();
@@ -94,8 +94,8 @@ LrWpanCsmaCaStandard::LrWpanCsmaCaStandard(uint8_t priority)
 }
 
 LrWpanCsmaCaStandard::LrWpanCsmaCaStandard()
+    : LrWpanCsmaCaStandard(0)
 {
-    NS_ASSERT_MSG(false, "nodeCount, priority missing.");
 }
 
 LrWpanCsmaCaStandard::~LrWpanCsmaCaStandard()
@@ -207,6 +207,7 @@ void
 LrWpanCsmaCaStandard::Start()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaStandard::Start");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA-CA supported.");
 
     m_collisions = 0; // collision counter C
@@ -239,6 +240,7 @@ void
 LrWpanCsmaCaStandard::RandomBackoffDelay()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaStandard::RandomBackoffDelay");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA/CA is supported.");
 
     Time randomBackoff;
@@ -374,6 +376,7 @@ void
 LrWpanCsmaCaStandard::CanProceed()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaStandard::CanProceed");
 
     Time timeLeftInCap;
     uint16_t ccaSymbols;
@@ -449,6 +452,7 @@ void
 LrWpanCsmaCaStandard::RequestCCA()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaStandard::RequestCCA");
     m_ccaRequestRunning = true;
     m_mac->GetPhy()->PlmeCcaRequest();
 }
@@ -457,6 +461,8 @@ void
 LrWpanCsmaCaStandard::DeferCsmaTimeout()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaStandard::DeferCsmaTimeout");
+    m_csmaCaDeferTrace(m_TP);
     m_lrWpanMacStateCallback(MAC_CSMA_DEFERRED);
 }
 
@@ -464,6 +470,7 @@ void
 LrWpanCsmaCaStandard::PlmeCcaConfirm(PhyEnumeration status)
 {
     NS_LOG_FUNCTION(this << status);
+    LRWPAN_PROFILE("CsmaCaStandard::PlmeCcaConfirm");
 
     // Only react on this event, if we are actually waiting for a CCA.
     // If the CSMA algorithm was canceled, we could still receive this event from
@@ -537,12 +544,31 @@ LrWpanCsmaCaStandard::GetNB()
     return m_collisions;
 }
 
+std::pair<uint32_t, uint32_t>
+LrWpanCsmaCaStandard::GetCwRange()
+{
+    return CW[m_TP];
+}
+
 bool
 LrWpanCsmaCaStandard::GetBatteryLifeExtension()
 {
     return m_macBattLifeExt;
 }
 
+CsmaOption
+LrWpanCsmaCaStandard::GetCsmaOption() const
+{
+    return CSMA_STANDARD;
+}
+
+void
+LrWpanCsmaCaStandard::SetTP(uint8_t tp)
+{
+    LrWpanCsmaCaCommon::SetTP(tp);
+    m_resultQueue.assign(TP_K[m_TP], true);
+}
+
 void
 LrWpanCsmaCaStandard::SetBackoffCounter()
 {
@@ -38,6 +38,13 @@ class LrWpanCsmaCaStandard : public LrWpanCsmaCaCommon
   static uint32_t TP_M[TP_COUNT];
 
   public:
+    /**
+     * Print the static per-TP configuration tables of this variant, one
+     * "name v0 v1 ..." line per table, in a stable order.
+     *
+     * \param os the output stream
+     */
+    static void PrintConfiguration(std::ostream& os);
     /**
      * Get the type ID.
      *
@@ -45,7 +52,7 @@ class LrWpanCsmaCaStandard : public LrWpanCsmaCaCommon
      */
     static TypeId GetTypeId();
     /**
-     * Default constructor.
+     * Default constructor, for a device of TP 0 (see SetTP).
      */
     LrWpanCsmaCaStandard();
     LrWpanCsmaCaStandard(uint8_t priority);
@@ -216,12 +223,25 @@ class LrWpanCsmaCaStandard : public LrWpanCsmaCaCommon
      * \returns the number of CSMA retries
      */
     uint8_t GetNB() override;
+    /**
+     * Get the contention window of this device's TP.
+     *
+     * \return the (min, max) contention window
+     */
+    std::pair<uint32_t, uint32_t> GetCwRange() override;
     /**
      * Get the value of the Battery Life Extension
      *
      * \returns  true or false to Battery Life Extension support
      */
     bool GetBatteryLifeExtension() override;
+    /**
+     * Set the TP of this device and reset its (m,k) history.
+     *
+     * \param tp the TP, 0 to 7
+     */
+    void SetTP(uint8_t tp) override;
+    CsmaOption GetCsmaOption() const override;
 
     void SetBackoffCounter();
 
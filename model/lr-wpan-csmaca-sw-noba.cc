@@ -7,8 +7,9 @@
  *  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
  */
 
-#include "lr-wpan-csmaca-sw-noba.h"
 #include "lr-wpan-constants.h"
+#include "lr-wpan-csmaca-sw-noba.h"
+#include "lr-wpan-profiler.h"
 
 #include <ns3/log.h>
 #include <ns3/random-variable-stream.h>
@@ -60,6 +61,17 @@ LrWpanCsmaCaSwNoba::GetTypeId()
     return tid;
 }
 
+void
+LrWpanCsmaCaSwNoba::PrintConfiguration(std::ostream& os)
+{
+    // The windows are derived from SW and WL, report their initial values.
+    InitializeGlobals(true);
+    PrintTpTable(os, "WL", WL, TP_COUNT);
+    PrintTpTable(os, "CW", CW, TP_COUNT);
+    PrintTpTable(os, "TP_M", TP_M, TP_COUNT);
+    PrintTpTable(os, "TP_K", TP_K, TP_COUNT);
+}
+
 void
 LrWpanCsmaCaSwNoba::InitializeGlobals(bool init)
 {
@@ -158,8 +170,8 @@ LrWpanCsmaCaSwNoba::LrWpanCsmaCaSwNoba(uint8_t priority)
 }
 
 LrWpanCsmaCaSwNoba::LrWpanCsmaCaSwNoba()
+    : LrWpanCsmaCaSwNoba(0)
 {
-    NS_ASSERT_MSG(false, "nodeCount, priority missing.");
 }
 
 LrWpanCsmaCaSwNoba::~LrWpanCsmaCaSwNoba()
@@ -181,6 +193,7 @@ void
 LrWpanCsmaCaSwNoba::Start()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaSwNoba::Start");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA-CA supported.");
 
     m_collisions = 0; // collision counter C
@@ -377,6 +390,7 @@ void
 LrWpanCsmaCaSwNoba::RandomBackoffDelay()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaSwNoba::RandomBackoffDelay");
     NS_ASSERT_MSG(m_isSlotted, "only slotted CSMA/CA is supported.");
 
     Time randomBackoff;
@@ -567,6 +581,7 @@ void
 LrWpanCsmaCaSwNoba::CanProceed()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaSwNoba::CanProceed");
 
     Time timeLeftInCap;
     uint16_t ccaSymbols;
@@ -642,6 +657,7 @@ void
 LrWpanCsmaCaSwNoba::RequestCCA()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaSwNoba::RequestCCA");
     m_ccaRequestRunning = true;
     m_mac->GetPhy()->PlmeCcaRequest();
 }
@@ -650,6 +666,8 @@ void
 LrWpanCsmaCaSwNoba::DeferCsmaTimeout()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCaSwNoba::DeferCsmaTimeout");
+    m_csmaCaDeferTrace(m_TP);
     m_lrWpanMacStateCallback(MAC_CSMA_DEFERRED);
 }
 
@@ -657,6 +675,7 @@ void
 LrWpanCsmaCaSwNoba::PlmeCcaConfirm(PhyEnumeration status)
 {
     NS_LOG_FUNCTION(this << status);
+    LRWPAN_PROFILE("CsmaCaSwNoba::PlmeCcaConfirm");
 
     // Only react on this event, if we are actually waiting for a CCA.
     // If the CSMA algorithm was canceled, we could still receive this event from
@@ -730,11 +749,30 @@ LrWpanCsmaCaSwNoba::GetNB()
     return m_collisions;
 }
 
+std::pair<uint32_t, uint32_t>
+LrWpanCsmaCaSwNoba::GetCwRange()
+{
+    return CW[m_TP];
+}
+
 bool
 LrWpanCsmaCaSwNoba::GetBatteryLifeExtension()
 {
     return m_macBattLifeExt;
 }
 
+CsmaOption
+LrWpanCsmaCaSwNoba::GetCsmaOption() const
+{
+    return CSMA_SW_NOBA;
+}
+
+void
+LrWpanCsmaCaSwNoba::SetTP(uint8_t tp)
+{
+    LrWpanCsmaCaCommon::SetTP(tp);
+    m_resultQueue.assign(TP_K[m_TP], true);
+}
+
 } // namespace lrwpan
 } // namespace ns3
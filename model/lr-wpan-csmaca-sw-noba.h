@@ -50,6 +50,13 @@ class LrWpanCsmaCaSwNoba : public LrWpanCsmaCaCommon
      * @param init bool, true when init situration
      */
     static void InitializeGlobals(bool init);
+    /**
+     * Print the static per-TP configuration tables of this variant, one
+     * "name v0 v1 ..." line per table, in a stable order.
+     *
+     * \param os the output stream
+     */
+    static void PrintConfiguration(std::ostream& os);
     /**
     * Get the type ID.
     *
@@ -57,7 +64,7 @@ class LrWpanCsmaCaSwNoba : public LrWpanCsmaCaCommon
     */
     static TypeId GetTypeId();
     /**
-    * Default constructor.
+    * Default constructor, for a device of TP 0 (see SetTP).
     */
     LrWpanCsmaCaSwNoba();
     ~LrWpanCsmaCaSwNoba() override;
@@ -226,21 +233,25 @@ class LrWpanCsmaCaSwNoba : public LrWpanCsmaCaCommon
     * \returns the number of CSMA retries
     */
     uint8_t GetNB() override;
+    /**
+     * Get the contention window of this device's TP.
+     *
+     * \return the (min, max) contention window
+     */
+    std::pair<uint32_t, uint32_t> GetCwRange() override;
     /**
     * Get the value of the Battery Life Extension
     *
     * \returns  true or false to Battery Life Extension support
     */
     bool GetBatteryLifeExtension() override;
-    void SetTP(uint8_t TP)
-    {
-      m_TP = TP;
-    }
-
-    uint8_t GetTP()
-    {
-      return m_TP;
-    }
+    /**
+    * Set the TP of this device and reset its (m,k) history.
+    *
+    * \param tp the TP, 0 to 7
+    */
+    void SetTP(uint8_t tp) override;
+    CsmaOption GetCsmaOption() const override;
 
   /**
    * when ACK timeout occured, modify CW, SW and get backoff counter value
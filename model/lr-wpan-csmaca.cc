@@ -12,10 +12,12 @@
 #include "lr-wpan-csmaca.h"
 
 #include "lr-wpan-constants.h"
+#include "lr-wpan-profiler.h"
 
 #include <ns3/log.h>
 #include <ns3/random-variable-stream.h>
 #include <ns3/simulator.h>
+#include <ns3/uinteger.h>
 
 #include <algorithm>
 
@@ -39,6 +41,21 @@ LrWpanCsmaCa::GetTypeId()
                             .SetParent<LrWpanCsmaCaCommon>()
                             .SetGroupName("LrWpan")
                             .AddConstructor<LrWpanCsmaCa>()
+                            .AddAttribute("MacMinBE",
+                                          "The minimum backoff exponent (macMinBE)",
+                                          UintegerValue(3),
+                                          MakeUintegerAccessor(&LrWpanCsmaCa::m_macMinBE),
+                                          MakeUintegerChecker<uint8_t>(0, 8))
+                            .AddAttribute("MacMaxBE",
+                                          "The maximum backoff exponent (macMaxBE)",
+                                          UintegerValue(5),
+                                          MakeUintegerAccessor(&LrWpanCsmaCa::m_macMaxBE),
+                                          MakeUintegerChecker<uint8_t>(3, 8))
+                            .AddAttribute("MacMaxCSMABackoffs",
+                                          "The maximum number of backoffs (macMaxCSMABackoffs)",
+                                          UintegerValue(4),
+                                          MakeUintegerAccessor(&LrWpanCsmaCa::m_macMaxCSMABackoffs),
+                                          MakeUintegerChecker<uint8_t>(0, 5))
                             .AddTraceSource("csmaCaBebCollisionTrace",
                                 "CSMA/CA-NOBA collision count trace",
                                 MakeTraceSourceAccessor(&LrWpanCsmaCa::m_csmaCaBebCollisionTrace),
@@ -50,8 +67,6 @@ return tid;
 
 LrWpanCsmaCa::LrWpanCsmaCa()
 {
-    // TODO-- make these into ns-3 attributes
-
     m_isSlotted = true;
     m_NB = 0;
     m_CW = 2;
@@ -244,6 +259,7 @@ void
 LrWpanCsmaCa::Start()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCa::Start");
     m_NB = 0;
     if (IsSlottedCsmaCa())
     {
@@ -300,6 +316,7 @@ void
 LrWpanCsmaCa::RandomBackoffDelay()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCa::RandomBackoffDelay");
 
     uint64_t upperBound = (uint64_t)pow(2, m_BE) - 1;
     Time randomBackoff;
@@ -392,6 +409,7 @@ void
 LrWpanCsmaCa::CanProceed()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCa::CanProceed");
 
     Time timeLeftInCap;
     uint16_t ccaSymbols;
@@ -467,6 +485,7 @@ void
 LrWpanCsmaCa::RequestCCA()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCa::RequestCCA");
     m_ccaRequestRunning = true;
     m_mac->GetPhy()->PlmeCcaRequest();
 }
@@ -475,6 +494,8 @@ void
 LrWpanCsmaCa::DeferCsmaTimeout()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("CsmaCa::DeferCsmaTimeout");
+    m_csmaCaDeferTrace(m_TP);
     m_lrWpanMacStateCallback(MAC_CSMA_DEFERRED);
 }
 
@@ -482,6 +503,7 @@ void
 LrWpanCsmaCa::PlmeCcaConfirm(PhyEnumeration status)
 {
     NS_LOG_FUNCTION(this << status);
+    LRWPAN_PROFILE("CsmaCa::PlmeCcaConfirm");
 
     // Only react on this event, if we are actually waiting for a CCA.
     // If the CSMA algorithm was canceled, we could still receive this event from
@@ -591,5 +613,11 @@ LrWpanCsmaCa::GetBatteryLifeExtension()
     return m_macBattLifeExt;
 }
 
+CsmaOption
+LrWpanCsmaCa::GetCsmaOption() const
+{
+    return CSMA_ORIGINAL;
+}
+
 } // namespace lrwpan
 } // namespace ns3
@@ -235,6 +235,7 @@ class LrWpanCsmaCa : public LrWpanCsmaCaCommon
      * \returns  true or false to Battery Life Extension support
      */
     bool GetBatteryLifeExtension() override;
+    CsmaOption GetCsmaOption() const override;
 
   private:
     void DoDispose() override;
@@ -0,0 +1,89 @@
+/*
+* Copyright (c) 2025 jshyeon, Gyeonsang National University
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:
+ *  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-deadline-tag.h"
+#include <ns3/double.h>
+#include <ns3/integer.h>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_OBJECT_ENSURE_REGISTERED(LrWpanDeadlineTag);
+
+TypeId
+LrWpanDeadlineTag::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::lrwpan::LrWpanDeadlineTag")
+                            .SetParent<Tag>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<LrWpanDeadlineTag>()
+                            .AddAttribute("deadline",
+                                          "packet deadline (ms)",
+                                          DoubleValue(0.0),
+                                          MakeDoubleAccessor(&LrWpanDeadlineTag::Get),
+                                          MakeDoubleChecker<double>());
+    return tid;
+}
+
+TypeId
+LrWpanDeadlineTag::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+LrWpanDeadlineTag::LrWpanDeadlineTag()
+    : m_deadline(0.0)
+{
+}
+
+LrWpanDeadlineTag::LrWpanDeadlineTag(double deadline)
+    : m_deadline(deadline)
+{
+}
+
+uint32_t
+LrWpanDeadlineTag::GetSerializedSize() const
+{
+    return sizeof(double);
+}
+
+void
+LrWpanDeadlineTag::Serialize(TagBuffer i) const
+{
+    i.WriteDouble(m_deadline);
+}
+
+void
+LrWpanDeadlineTag::Deserialize(TagBuffer i)
+{
+    m_deadline = i.ReadDouble();
+}
+
+void
+LrWpanDeadlineTag::Print(std::ostream& os) const
+{
+    os << "deadline = " << m_deadline;
+}
+
+void
+LrWpanDeadlineTag::Set(double deadline)
+{
+    m_deadline = deadline;
+}
+
+double
+LrWpanDeadlineTag::Get() const
+{
+    return m_deadline;
+}
+
+
+} // namespace lrwpan
+} // namespace ns3
@@ -0,0 +1,68 @@
+/*
+* Copyright (c) 2025 jshyeon, Gyeonsang National University
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:
+ *  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_DEADLINE_TAG_H
+#define LR_WPAN_DEADLINE_TAG_H
+
+#include <ns3/tag.h>
+
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ * Represent the deadline of a packet (absolute, in ms), for deadline miss accounting.
+ *
+ * The deadline Tag is added by LrWpanTrafficGenerator to the packets
+ * of the TPs with a deadline.
+ *
+ */
+class LrWpanDeadlineTag : public Tag
+{
+public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TypeId GetInstanceTypeId() const override;
+
+    /**
+     * Create a LrWpanDeadlineTag with the default deadline 0.
+     */
+    LrWpanDeadlineTag();
+
+    /**
+     * Create a LrWpanDeadlineTag with the given deadline value.
+     * \param deadline The deadline.
+     */
+    LrWpanDeadlineTag(double deadline);
+
+    uint32_t GetSerializedSize() const override;
+    void Serialize(TagBuffer i) const override;
+    void Deserialize(TagBuffer i) override;
+    void Print(std::ostream& os) const override;
+
+    void Set(double deadline);
+    double Get() const;
+
+private:
+    /**
+     * The deadline of the tag.
+     */
+    double m_deadline;
+};
+
+} // namespace lrwpan
+} // namespace ns3
+#endif /* LR_WPAN_DEADLINE_TAG_H */
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-latency-histogram.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanLatencyHistogram");
+
+namespace lrwpan
+{
+
+/// Number of bits of the largest tracked sample, in units of the resolution
+static constexpr uint32_t HISTOGRAM_VALUE_BITS = 48;
+
+LrWpanLatencyHistogram::LrWpanLatencyHistogram(double resolution, uint8_t precisionBits)
+    : m_resolution(resolution),
+      m_precisionBits(precisionBits)
+{
+    NS_ABORT_MSG_IF(resolution <= 0, "Histogram resolution must be positive");
+    NS_ABORT_MSG_IF(precisionBits < 1 || precisionBits > 16,
+                    "Histogram precision must be between 1 and 16 bits");
+    m_counts.resize((HISTOGRAM_VALUE_BITS - precisionBits + 1) << precisionBits, 0);
+    Reset();
+}
+
+void
+LrWpanLatencyHistogram::Reset()
+{
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+    m_count = 0;
+    m_sum = 0;
+    m_min = std::numeric_limits<double>::max();
+    m_max = std::numeric_limits<double>::lowest();
+}
+
+uint32_t
+LrWpanLatencyHistogram::GetIndex(uint64_t units) const
+{
+    if (units < (2ULL << m_precisionBits))
+    {
+        return units;
+    }
+    uint32_t msb = 63 - __builtin_clzll(units);
+    uint32_t shift = msb - m_precisionBits;
+    // (shift + 1) magnitudes of 2^p buckets precede this one, after the linear range.
+    return ((shift + 1) << m_precisionBits) + (units >> shift) - (1ULL << m_precisionBits);
+}
+
+uint64_t
+LrWpanLatencyHistogram::GetLowerBound(uint32_t index) const
+{
+    if (index < (2U << m_precisionBits))
+    {
+        return index;
+    }
+    uint32_t shift = (index >> m_precisionBits) - 1;
+    uint64_t top = (index & ((1U << m_precisionBits) - 1)) + (1ULL << m_precisionBits);
+    return top << shift;
+}
+
+uint64_t
+LrWpanLatencyHistogram::GetWidth(uint32_t index) const
+{
+    if (index < (2U << m_precisionBits))
+    {
+        return 1;
+    }
+    return 1ULL << ((index >> m_precisionBits) - 1);
+}
+
+void
+LrWpanLatencyHistogram::Record(double value)
+{
+    value = std::max(value, 0.0);
+    double units = std::round(value / m_resolution);
+    const double maxUnits = std::ldexp(1.0, HISTOGRAM_VALUE_BITS) - 1;
+    uint32_t index = GetIndex(static_cast<uint64_t>(std::min(units, maxUnits)));
+
+    m_counts[index]++;
+    m_count++;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+void
+LrWpanLatencyHistogram::Merge(const LrWpanLatencyHistogram& other)
+{
+    NS_ABORT_MSG_IF(m_resolution != other.m_resolution ||
+                        m_precisionBits != other.m_precisionBits,
+                    "Cannot merge histograms with different layouts");
+    for (std::size_t i = 0; i < m_counts.size(); i++)
+    {
+        m_counts[i] += other.m_counts[i];
+    }
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+uint64_t
+LrWpanLatencyHistogram::GetCount() const
+{
+    return m_count;
+}
+
+double
+LrWpanLatencyHistogram::GetMin() const
+{
+    return m_count ? m_min : 0;
+}
+
+double
+LrWpanLatencyHistogram::GetMax() const
+{
+    return m_count ? m_max : 0;
+}
+
+double
+LrWpanLatencyHistogram::GetMean() const
+{
+    return m_count ? m_sum / m_count : 0;
+}
+
+double
+LrWpanLatencyHistogram::GetQuantile(double q) const
+{
+    NS_ABORT_MSG_IF(q < 0 || q > 1, "Quantile " << q << " out of [0, 1]");
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = std::max<uint64_t>(1, std::ceil(q * m_count));
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < m_counts.size(); i++)
+    {
+        seen += m_counts[i];
+        if (seen >= rank)
+        {
+            // Middle of the bucket, clamped to the exact extremes.
+            double units = GetLowerBound(i) + (GetWidth(i) - 1) / 2.0;
+            return std::clamp(units * m_resolution, m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+double
+LrWpanLatencyHistogram::GetRelativeError() const
+{
+    return std::ldexp(1.0, -(m_precisionBits + 1));
+}
+
+void
+LrWpanLatencyHistogram::Write(std::ostream& os) const
+{
+    os << std::setprecision(17) << m_resolution << " " << +m_precisionBits << " " << m_count << " "
+       << m_sum << " " << m_min << " " << m_max;
+    for (uint32_t i = 0; i < m_counts.size(); i++)
+    {
+        if (m_counts[i])
+        {
+            os << " " << i << ":" << m_counts[i];
+        }
+    }
+    os << "\n";
+}
+
+bool
+LrWpanLatencyHistogram::Read(std::istream& is)
+{
+    std::string line;
+    if (!std::getline(is, line))
+    {
+        return false;
+    }
+    std::istringstream iss(line);
+    double resolution;
+    uint32_t precisionBits;
+    if (!(iss >> resolution >> precisionBits) || resolution != m_resolution ||
+        precisionBits != m_precisionBits)
+    {
+        return false;
+    }
+
+    Reset();
+    if (!(iss >> m_count >> m_sum >> m_min >> m_max))
+    {
+        Reset();
+        return false;
+    }
+    uint32_t index;
+    char colon;
+    uint64_t count;
+    while (iss >> index >> colon >> count)
+    {
+        if (colon != ':' || index >= m_counts.size())
+        {
+            Reset();
+            return false;
+        }
+        m_counts[index] = count;
+    }
+    return true;
+}
+
+} // namespace lrwpan
+} // namespace ns3
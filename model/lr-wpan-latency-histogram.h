@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_LATENCY_HISTOGRAM_H
+#define LR_WPAN_LATENCY_HISTOGRAM_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Constant memory latency histogram with bounded relative error.
+ *
+ * HDR histogram layout: samples are counted in units of the resolution; the
+ * first 2^(p+1) units have one bucket each, and every following power of two
+ * is split into 2^p buckets, where p is the precision in bits. Any quantile is
+ * therefore reported within a relative error of 2^-(p+1) (0.4% for the
+ * default p = 7), whatever the number of samples, and the memory does not
+ * grow with them. Samples are tracked up to 2^48 units (about 9 years of
+ * milliseconds at the default resolution); larger ones fall in the last
+ * bucket. Minimum, maximum and mean are exact.
+ *
+ * Histograms with the same resolution and precision can be merged, e.g. to
+ * pool the per-TP latencies of several replications.
+ */
+class LrWpanLatencyHistogram
+{
+  public:
+    /**
+     * \param resolution the smallest distinguishable value, in the unit of the samples
+     * \param precisionBits the number of sub-bucket bits (1 to 16)
+     */
+    LrWpanLatencyHistogram(double resolution = 0.001, uint8_t precisionBits = 7);
+
+    /**
+     * \brief Add a sample. Negative samples are counted as 0.
+     * \param value the sample
+     */
+    void Record(double value);
+
+    /**
+     * \brief Add the samples of another histogram.
+     * \param other a histogram with the same resolution and precision
+     */
+    void Merge(const LrWpanLatencyHistogram& other);
+
+    /**
+     * \brief Remove all samples.
+     */
+    void Reset();
+
+    /**
+     * \return the number of samples
+     */
+    uint64_t GetCount() const;
+
+    /**
+     * \return the smallest sample, 0 if empty
+     */
+    double GetMin() const;
+
+    /**
+     * \return the largest sample, 0 if empty
+     */
+    double GetMax() const;
+
+    /**
+     * \return the mean of the samples, 0 if empty
+     */
+    double GetMean() const;
+
+    /**
+     * \brief Estimate a quantile.
+     * \param q the quantile, in [0, 1]
+     * \return the estimate, 0 if empty
+     */
+    double GetQuantile(double q) const;
+
+    /**
+     * \return the bound on the relative error of GetQuantile()
+     */
+    double GetRelativeError() const;
+
+    /**
+     * \brief Write the histogram as text, storing only the non empty buckets.
+     * \param os the output stream
+     */
+    void Write(std::ostream& os) const;
+
+    /**
+     * \brief Read a histogram written by Write(), replacing the current samples.
+     * \param is the input stream
+     * \return false if the input is malformed or has a different layout
+     */
+    bool Read(std::istream& is);
+
+  private:
+    /**
+     * \param units a sample, in units of the resolution
+     * \return the bucket counting the sample
+     */
+    uint32_t GetIndex(uint64_t units) const;
+
+    /**
+     * \param index a bucket index
+     * \return the smallest sample, in units of the resolution, counted by the bucket
+     */
+    uint64_t GetLowerBound(uint32_t index) const;
+
+    /**
+     * \param index a bucket index
+     * \return the number of distinct samples, in units of the resolution, counted by the bucket
+     */
+    uint64_t GetWidth(uint32_t index) const;
+
+    double m_resolution;           //!< The value of one unit
+    uint8_t m_precisionBits;       //!< Sub-bucket bits
+    std::vector<uint64_t> m_counts; //!< Bucket counters
+    uint64_t m_count;              //!< Number of samples
+    double m_sum;                  //!< Sum of the samples
+    double m_min;                  //!< Smallest sample
+    double m_max;                  //!< Largest sample
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_LATENCY_HISTOGRAM_H */
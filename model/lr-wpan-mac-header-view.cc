@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-mac-header-view.h"
+
+#include <ns3/address-utils.h>
+#include <ns3/log.h>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanMacHeaderView");
+NS_OBJECT_ENSURE_REGISTERED(LrWpanMacHeaderView);
+
+/**
+ * \param mode an addressing mode
+ * \return the size of an address of the mode
+ */
+static uint8_t
+GetAddrSize(uint8_t mode)
+{
+    switch (mode)
+    {
+    case LrWpanMacHeader::SHORTADDR:
+        return 2;
+    case LrWpanMacHeader::EXTADDR:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+LrWpanMacHeaderView::LrWpanMacHeaderView()
+    : m_frameControl(0),
+      m_srcOffset(0),
+      m_srcAddrOffset(0),
+      m_size(0)
+{
+}
+
+TypeId
+LrWpanMacHeaderView::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::lrwpan::LrWpanMacHeaderView")
+                            .SetParent<Header>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<LrWpanMacHeaderView>();
+    return tid;
+}
+
+TypeId
+LrWpanMacHeaderView::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+void
+LrWpanMacHeaderView::Print(std::ostream& os) const
+{
+    os << "  Frame Control = " << m_frameControl << ", Size = " << (uint32_t)m_size;
+}
+
+uint32_t
+LrWpanMacHeaderView::GetSerializedSize() const
+{
+    return m_size;
+}
+
+void
+LrWpanMacHeaderView::Serialize(Buffer::Iterator start) const
+{
+    NS_FATAL_ERROR("LrWpanMacHeaderView is read-only, use LrWpanMacHeader");
+}
+
+uint32_t
+LrWpanMacHeaderView::Deserialize(Buffer::Iterator start)
+{
+    m_start = start;
+    Buffer::Iterator i = start;
+    m_frameControl = i.ReadLsbtohU16();
+
+    // frame control and sequence number
+    uint8_t offset = 3;
+    uint8_t dstSize = GetAddrSize(GetDstAddrMode());
+    if (dstSize > 0)
+    {
+        offset += 2 + dstSize;
+    }
+    m_srcOffset = offset;
+    uint8_t srcSize = GetAddrSize(GetSrcAddrMode());
+    if (srcSize > 0 && !IsPanIdComp())
+    {
+        offset += 2;
+    }
+    m_srcAddrOffset = offset;
+    offset += srcSize;
+
+    if (IsSecEnable())
+    {
+        // security control and frame counter, then the key identifier
+        i = At(offset);
+        uint8_t keyIdMode = (i.ReadU8() >> 3) & 0x03;
+        offset += 5;
+        switch (keyIdMode)
+        {
+        case LrWpanMacHeader::NOKEYSOURCE:
+            offset += 1;
+            break;
+        case LrWpanMacHeader::SHORTKEYSOURCE:
+            offset += 5;
+            break;
+        case LrWpanMacHeader::LONGKEYSOURCE:
+            offset += 9;
+            break;
+        default:
+            break;
+        }
+    }
+    m_size = offset;
+    return m_size;
+}
+
+Buffer::Iterator
+LrWpanMacHeaderView::At(uint8_t offset) const
+{
+    Buffer::Iterator i = m_start;
+    i.Next(offset);
+    return i;
+}
+
+LrWpanMacHeader::LrWpanMacType
+LrWpanMacHeaderView::GetType() const
+{
+    uint8_t type = m_frameControl & 0x07; // Bit 0-2
+    return type <= LrWpanMacHeader::LRWPAN_MAC_COMMAND
+               ? static_cast<LrWpanMacHeader::LrWpanMacType>(type)
+               : LrWpanMacHeader::LRWPAN_MAC_RESERVED;
+}
+
+bool
+LrWpanMacHeaderView::IsBeacon() const
+{
+    return GetType() == LrWpanMacHeader::LRWPAN_MAC_BEACON;
+}
+
+bool
+LrWpanMacHeaderView::IsData() const
+{
+    return GetType() == LrWpanMacHeader::LRWPAN_MAC_DATA;
+}
+
+bool
+LrWpanMacHeaderView::IsAcknowledgment() const
+{
+    return GetType() == LrWpanMacHeader::LRWPAN_MAC_ACKNOWLEDGMENT;
+}
+
+bool
+LrWpanMacHeaderView::IsCommand() const
+{
+    return GetType() == LrWpanMacHeader::LRWPAN_MAC_COMMAND;
+}
+
+bool
+LrWpanMacHeaderView::IsSecEnable() const
+{
+    return (m_frameControl >> 3) & 0x01; // Bit 3
+}
+
+bool
+LrWpanMacHeaderView::IsAckReq() const
+{
+    return (m_frameControl >> 5) & 0x01; // Bit 5
+}
+
+bool
+LrWpanMacHeaderView::IsPanIdComp() const
+{
+    return (m_frameControl >> 6) & 0x01; // Bit 6
+}
+
+uint8_t
+LrWpanMacHeaderView::GetDstAddrMode() const
+{
+    return (m_frameControl >> 10) & 0x03; // Bit 10-11
+}
+
+uint8_t
+LrWpanMacHeaderView::GetFrameVer() const
+{
+    return (m_frameControl >> 12) & 0x03; // Bit 12-13
+}
+
+uint8_t
+LrWpanMacHeaderView::GetSrcAddrMode() const
+{
+    return (m_frameControl >> 14) & 0x03; // Bit 14-15
+}
+
+uint8_t
+LrWpanMacHeaderView::GetSeqNum() const
+{
+    return At(2).ReadU8();
+}
+
+uint16_t
+LrWpanMacHeaderView::GetDstPanId() const
+{
+    return At(3).ReadLsbtohU16();
+}
+
+Mac16Address
+LrWpanMacHeaderView::GetShortDstAddr() const
+{
+    Buffer::Iterator i = At(5);
+    Mac16Address addr;
+    ReadFrom(i, addr);
+    return addr;
+}
+
+Mac64Address
+LrWpanMacHeaderView::GetExtDstAddr() const
+{
+    Buffer::Iterator i = At(5);
+    Mac64Address addr;
+    ReadFrom(i, addr);
+    return addr;
+}
+
+uint16_t
+LrWpanMacHeaderView::GetSrcPanId() const
+{
+    return IsPanIdComp() ? GetDstPanId() : At(m_srcOffset).ReadLsbtohU16();
+}
+
+Mac16Address
+LrWpanMacHeaderView::GetShortSrcAddr() const
+{
+    Buffer::Iterator i = At(m_srcAddrOffset);
+    Mac16Address addr;
+    ReadFrom(i, addr);
+    return addr;
+}
+
+Mac64Address
+LrWpanMacHeaderView::GetExtSrcAddr() const
+{
+    Buffer::Iterator i = At(m_srcAddrOffset);
+    Mac64Address addr;
+    ReadFrom(i, addr);
+    return addr;
+}
+
+} // namespace lrwpan
+} // namespace ns3
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_MAC_HEADER_VIEW_H
+#define LR_WPAN_MAC_HEADER_VIEW_H
+
+#include "lr-wpan-mac-header.h"
+
+#include <ns3/buffer.h>
+#include <ns3/header.h>
+#include <ns3/mac16-address.h>
+#include <ns3/mac64-address.h>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Read-only view of the MAC header at the front of a packet.
+ *
+ * Peeking the view (Packet::PeekHeader) decodes the frame control field and
+ * the offsets of the addressing fields only; the other fields are read from
+ * the packet buffer when asked for. It lets the receive path filter frames on
+ * their type, PAN ID and destination address without deserializing, and
+ * removing, a full LrWpanMacHeader for frames that are dropped anyway.
+ *
+ * The view points into the buffer of the peeked packet: it is valid while
+ * that packet is alive and its header has not been removed or changed. It
+ * cannot be serialized.
+ */
+class LrWpanMacHeaderView : public Header
+{
+  public:
+    LrWpanMacHeaderView();
+
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+
+    void Print(std::ostream& os) const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+
+    /**
+     * \return the frame type
+     */
+    LrWpanMacHeader::LrWpanMacType GetType() const;
+    /**
+     * \return true if the frame is a beacon
+     */
+    bool IsBeacon() const;
+    /**
+     * \return true if the frame is a data frame
+     */
+    bool IsData() const;
+    /**
+     * \return true if the frame is an acknowledgment
+     */
+    bool IsAcknowledgment() const;
+    /**
+     * \return true if the frame is a command
+     */
+    bool IsCommand() const;
+    /**
+     * \return true if the Security Enabled bit is set
+     */
+    bool IsSecEnable() const;
+    /**
+     * \return true if the Ack. Request bit is set
+     */
+    bool IsAckReq() const;
+    /**
+     * \return true if the PAN ID Compression bit is set
+     */
+    bool IsPanIdComp() const;
+    /**
+     * \return the frame version
+     */
+    uint8_t GetFrameVer() const;
+    /**
+     * \return the destination addressing mode
+     */
+    uint8_t GetDstAddrMode() const;
+    /**
+     * \return the source addressing mode
+     */
+    uint8_t GetSrcAddrMode() const;
+
+    /**
+     * \return the sequence number
+     */
+    uint8_t GetSeqNum() const;
+    /**
+     * \return the destination PAN ID, if there is a destination address
+     */
+    uint16_t GetDstPanId() const;
+    /**
+     * \return the short destination address, if the addressing mode is short
+     */
+    Mac16Address GetShortDstAddr() const;
+    /**
+     * \return the extended destination address, if the addressing mode is extended
+     */
+    Mac64Address GetExtDstAddr() const;
+    /**
+     * \return the source PAN ID, or the destination PAN ID if it is compressed
+     */
+    uint16_t GetSrcPanId() const;
+    /**
+     * \return the short source address, if the addressing mode is short
+     */
+    Mac16Address GetShortSrcAddr() const;
+    /**
+     * \return the extended source address, if the addressing mode is extended
+     */
+    Mac64Address GetExtSrcAddr() const;
+
+  private:
+    /**
+     * \param offset the offset of a field from the start of the header
+     * \return an iterator on the field
+     */
+    Buffer::Iterator At(uint8_t offset) const;
+
+    Buffer::Iterator m_start; //!< Start of the header in the packet buffer
+    uint16_t m_frameControl;  //!< Frame control field
+    uint8_t m_srcOffset;      //!< Offset of the source PAN ID or address
+    uint8_t m_srcAddrOffset;  //!< Offset of the source address
+    uint8_t m_size;           //!< Header size, auxiliary security header included
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_MAC_HEADER_VIEW_H */
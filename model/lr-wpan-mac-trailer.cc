@@ -10,8 +10,12 @@
  */
 #include "lr-wpan-mac-trailer.h"
 
+#include "lr-wpan-constants.h"
+
 #include <ns3/packet.h>
 
+#include <vector>
+
 namespace ns3
 {
 namespace lrwpan
@@ -22,6 +26,68 @@ NS_OBJECT_ENSURE_REGISTERED(LrWpanMacTrailer);
 /// The length in octets of the IEEE 802.15.4 MAC FCS field
 constexpr uint16_t LR_WPAN_MAC_FCS_LENGTH = 2;
 
+/**
+ * Lookup tables of the FCS for slice-by-8: entry [k][v] is the CRC of the
+ * octet v followed by k zero octets.
+ */
+struct Crc16Tables
+{
+    uint16_t table[8][256]; //!< The tables
+};
+
+/**
+ * \return the FCS lookup tables, built on first use
+ */
+static const Crc16Tables&
+GetCrc16Tables()
+{
+    static const Crc16Tables tables = []() {
+        Crc16Tables t;
+        for (uint32_t v = 0; v < 256; v++)
+        {
+            // CRC-16/KERMIT: polynomial x^16 + x^12 + x^5 + 1 reflected (0x8408)
+            uint16_t crc = v;
+            for (uint32_t bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+            }
+            t.table[0][v] = crc;
+        }
+        for (uint32_t k = 1; k < 8; k++)
+        {
+            for (uint32_t v = 0; v < 256; v++)
+            {
+                uint16_t crc = t.table[k - 1][v];
+                t.table[k][v] = (crc >> 8) ^ t.table[0][crc & 0xff];
+            }
+        }
+        return t;
+    }();
+    return tables;
+}
+
+/**
+ * Compute the FCS of a frame. Frames up to aMaxPhyPacketSize octets, all
+ * valid PSDUs, are copied to the stack rather than to the heap.
+ *
+ * \param p the frame, without trailer
+ * \return the FCS
+ */
+static uint16_t
+CalculateFcs(Ptr<const Packet> p)
+{
+    uint32_t size = p->GetSize();
+    if (size > aMaxPhyPacketSize)
+    {
+        std::vector<uint8_t> frame(size);
+        p->CopyData(frame.data(), size);
+        return LrWpanMacTrailer::GenerateCrc16(frame.data(), size);
+    }
+    uint8_t frame[aMaxPhyPacketSize];
+    p->CopyData(frame, size);
+    return LrWpanMacTrailer::GenerateCrc16(frame, size);
+}
+
 LrWpanMacTrailer::LrWpanMacTrailer()
     : m_fcs(0),
       m_calcFcs(false)
@@ -84,13 +150,26 @@ LrWpanMacTrailer::SetFcs(Ptr<const Packet> p)
 {
     if (m_calcFcs)
     {
-        uint16_t size = p->GetSize();
-        auto serial_packet = new uint8_t[size];
-
-        p->CopyData(serial_packet, size);
+        m_fcs = CalculateFcs(p);
+    }
+}
 
-        m_fcs = GenerateCrc16(serial_packet, size);
-        delete[] serial_packet;
+void
+LrWpanMacTrailer::PatchFcs(uint16_t fcs, uint8_t delta, uint32_t following)
+{
+    if (m_calcFcs)
+    {
+        const Crc16Tables& tables = GetCrc16Tables();
+        uint16_t crc = tables.table[0][delta];
+        for (; following >= 8; following -= 8)
+        {
+            crc = tables.table[7][crc & 0xff] ^ tables.table[6][crc >> 8];
+        }
+        for (; following > 0; following--)
+        {
+            crc = (crc >> 8) ^ tables.table[0][crc & 0xff];
+        }
+        m_fcs = fcs ^ crc;
     }
 }
 
@@ -105,16 +184,35 @@ LrWpanMacTrailer::CheckFcs(Ptr<const Packet> p)
     }
     else
     {
-        uint16_t checkFcs;
-        uint16_t size = p->GetSize();
-        auto serial_packet = new uint8_t[size];
-
-        p->CopyData(serial_packet, size);
+        return CalculateFcs(p) == GetFcs();
+    }
+}
 
-        checkFcs = GenerateCrc16(serial_packet, size);
-        delete[] serial_packet;
-        return (checkFcs == GetFcs());
+std::vector<bool>
+LrWpanMacTrailer::CheckFcsBatch(const std::vector<Ptr<const Packet>>& frames)
+{
+    std::vector<bool> valid;
+    valid.reserve(frames.size());
+    std::vector<uint8_t> frame; // reused by all the frames
+    for (const auto& p : frames)
+    {
+        uint32_t size = p->GetSize();
+        if (size < LR_WPAN_MAC_FCS_LENGTH)
+        {
+            valid.push_back(false);
+            continue;
+        }
+        if (frame.size() < size)
+        {
+            frame.resize(size);
+        }
+        p->CopyData(frame.data(), size);
+        uint32_t length = size - LR_WPAN_MAC_FCS_LENGTH;
+        // the FCS is written least significant octet first, see Serialize
+        uint16_t fcs = frame[length] | (frame[length + 1] << 8);
+        valid.push_back(GenerateCrc16(frame.data(), length) == fcs);
     }
+    return valid;
 }
 
 void
@@ -134,21 +232,24 @@ LrWpanMacTrailer::IsFcsEnabled() const
 }
 
 uint16_t
-LrWpanMacTrailer::GenerateCrc16(uint8_t* data, int length)
+LrWpanMacTrailer::GenerateCrc16(const uint8_t* data, uint32_t length)
 {
-    int i;
-    uint16_t accumulator = 0;
+    const Crc16Tables& tables = GetCrc16Tables();
+    uint16_t crc = 0;
 
-    for (i = 0; i < length; ++i)
+    // slice-by-8: the CRC is folded into the first two octets of each block
+    for (; length >= 8; length -= 8, data += 8)
+    {
+        crc ^= data[0] | (data[1] << 8);
+        crc = tables.table[7][crc & 0xff] ^ tables.table[6][crc >> 8] ^
+              tables.table[5][data[2]] ^ tables.table[4][data[3]] ^ tables.table[3][data[4]] ^
+              tables.table[2][data[5]] ^ tables.table[1][data[6]] ^ tables.table[0][data[7]];
+    }
+    for (; length > 0; length--, data++)
     {
-        accumulator ^= *data;
-        accumulator = (accumulator >> 8) | (accumulator << 8);
-        accumulator ^= (accumulator & 0xff00) << 4;
-        accumulator ^= (accumulator >> 8) >> 4;
-        accumulator ^= (accumulator & 0xff00) >> 5;
-        ++data;
+        crc = (crc >> 8) ^ tables.table[0][(crc ^ *data) & 0xff];
     }
-    return accumulator;
+    return crc;
 }
 
 } // namespace lrwpan
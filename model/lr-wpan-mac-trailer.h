@@ -12,8 +12,11 @@
 #ifndef LR_WPAN_MAC_TRAILER_H
 #define LR_WPAN_MAC_TRAILER_H
 
+#include <ns3/ptr.h>
 #include <ns3/trailer.h>
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -64,6 +67,18 @@ class LrWpanMacTrailer : public Trailer
      */
     void SetFcs(Ptr<const Packet> p);
 
+    /**
+     * Set the FCS value of a frame that differs from an earlier frame of the
+     * same length in one octet only, without reading the frame. The CRC with
+     * initial value 0 is linear: the FCS changes by the CRC of the octet
+     * difference followed by zeros.
+     *
+     * \param fcs the FCS value of the earlier frame
+     * \param delta the earlier octet XOR the new octet
+     * \param following the number of octets after the changed octet
+     */
+    void PatchFcs(uint16_t fcs, uint8_t delta, uint32_t following);
+
     /**
      * Check the FCS of a given packet against the FCS value stored in the
      * trailer. The packet itself should contain no trailer. If FCS calculation is
@@ -88,18 +103,27 @@ class LrWpanMacTrailer : public Trailer
      */
     bool IsFcsEnabled() const;
 
-  private:
+    /**
+     * Check the FCS of a batch of frames, e.g. replayed from a trace. Unlike
+     * CheckFcs(), the frames still carry their trailer.
+     *
+     * \param frames the frames, FCS included
+     * \return for each frame, true if its FCS matches its content
+     */
+    static std::vector<bool> CheckFcsBatch(const std::vector<Ptr<const Packet>>& frames);
+
     /**
      * Calculate the 16-bit FCS value.
      * CRC16-CCITT with a generator polynomial = ^16 + ^12 + ^5 + 1, LSB first and
-     * initial value = 0x0000.
+     * initial value = 0x0000 (CRC-16/KERMIT), eight octets at a time.
      *
      * \param data the checksum will be calculated over this data
      * \param length the length of the data
      * \return the checksum
      */
-    uint16_t GenerateCrc16(uint8_t* data, int length);
+    static uint16_t GenerateCrc16(const uint8_t* data, uint32_t length);
 
+  private:
     /**
      * The FCS value stored in this trailer.
      */
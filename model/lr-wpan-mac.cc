@@ -20,11 +20,15 @@
 #include "lr-wpan-csmaca-sw-noba.h"
 #include "lr-wpan-csmaca-gnu-noba.h"
 #include "lr-wpan-csmaca.h"
+#include "lr-wpan-mac-header-view.h"
 #include "lr-wpan-mac-header.h"
 #include "lr-wpan-mac-pl-headers.h"
 #include "lr-wpan-mac-trailer.h"
+#include "lr-wpan-profiler.h"
 #include "lr-wpan-retransmission-tag.h"
+#include "lr-wpan-sleeping-phy-filter.h"
 
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/node.h>
@@ -98,6 +102,25 @@ LrWpanMac::GetTypeId()
                           UintegerValue(),
                           MakeUintegerAccessor(&LrWpanMac::m_macPanId),
                           MakeUintegerChecker<uint16_t>())
+            .AddAttribute("InactiveSleep",
+                          "Whether the transceiver is turned off in the inactive period "
+                          "of the incoming superframe",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LrWpanMac::m_inactiveSleep),
+                          MakeBooleanChecker())
+            .AddAttribute("BeaconGuardTime",
+                          "The time the transceiver is turned on before an expected beacon, "
+                          "widened by one guard time per beacon missed in a row",
+                          TimeValue(MicroSeconds(320)),
+                          MakeTimeAccessor(&LrWpanMac::m_beaconGuardTime),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("AutoAck",
+                          "Whether the received data frames are acknowledged by the PHY, "
+                          "aTurnaroundTime after their end, in one scheduled transmission "
+                          "instead of the MAC transceiver state requests",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LrWpanMac::m_autoAck),
+                          MakeBooleanChecker())
             .AddTraceSource("MacTxEnqueue",
                             "Trace source indicating a packet has been "
                             "enqueued in the transaction queue",
@@ -242,6 +265,9 @@ LrWpanMac::LrWpanMac()
     m_incomingSuperframeOrder = 15;
     m_beaconTrackingOn = false;
     m_numLostBeacons = 0;
+    m_radioAsleep = false;
+    m_missedBeacons = 0;
+    m_rxBeaconSymbols = 0;
 
     m_pendPrimitive = MLME_NONE;
     m_channelScanIndex = 0;
@@ -258,6 +284,9 @@ LrWpanMac::LrWpanMac()
     m_macBsn = SequenceNumber8(m_uniformVar->GetInteger(0, 255));
     m_macBeaconPayload = {};
     m_macBeaconPayloadLength = 0;
+    m_beaconTemplateFcs = 0;
+    m_beaconTemplateSuperframe = 0;
+    m_beaconTemplatePanId = 0xffff;
     m_shortAddress = Mac16Address("FF:FF"); // FF:FF = The address is not assigned.
 }
 
@@ -302,6 +331,7 @@ LrWpanMac::DoDispose()
         m_indTxQueue[i]->txQPkt = nullptr;
     }
     m_indTxQueue.clear();
+    m_beaconTemplate = nullptr;
 
     m_phy = nullptr;
     m_mcpsDataConfirmCallback = MakeNullCallback<void, McpsDataConfirmParams>();
@@ -325,6 +355,8 @@ LrWpanMac::DoDispose()
     m_scanEnergyEvent.Cancel();
     m_scanOrphanEvent.Cancel();
     m_beaconEvent.Cancel();
+    m_wakeupEvent.Cancel();
+    m_beaconWindowEvent.Cancel();
 
     Object::DoDispose();
 }
@@ -343,17 +375,16 @@ LrWpanMac::SetRxOnWhenIdle(bool rxOnWhenIdle)
 
     if (m_macState == MAC_IDLE)
     {
-        if (m_macRxOnWhenIdle)
-        {
-            m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_RX_ON);
-        }
-        else
-        {
-            m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_TRX_OFF);
-        }
+        m_phy->PlmeSetTRXStateRequest(GetIdleTrxState());
     }
 }
 
+Time
+LrWpanMac::GetSleepEnd() const
+{
+    return m_radioAsleep ? m_sleepEnd : Time(0);
+}
+
 void
 LrWpanMac::SetShortAddress(Mac16Address address)
 {
@@ -382,6 +413,7 @@ void
 LrWpanMac::McpsDataRequest(McpsDataRequestParams params, Ptr<Packet> p)
 {
     NS_LOG_FUNCTION(this << p);
+    LRWPAN_PROFILE("Mac::McpsDataRequest");
 
     McpsDataConfirmParams confirmParams;
     confirmParams.m_msduHandle = params.m_msduHandle;
@@ -664,6 +696,7 @@ LrWpanMac::MlmeScanRequest(MlmeScanRequestParams params)
     m_incCapEvent.Cancel();
     m_incCfpEvent.Cancel();
     m_trackingEvent.Cancel();
+    StopInactiveSleep();
     m_csmaCa->SetUnSlottedCsmaCa();
 
     m_channelScanIndex = 0;
@@ -863,18 +896,15 @@ LrWpanMac::MlmeSyncRequest(MlmeSyncRequestParams params)
     NS_LOG_FUNCTION(this);
     NS_ASSERT(params.m_logCh <= 26 && m_macPanId != 0xffff);
 
-    auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false); // symbols per second
     // change phy current logical channel
     Ptr<PhyPibAttributes> pibAttr = Create<PhyPibAttributes>();
     pibAttr->phyCurrentChannel = params.m_logCh;
     m_phy->PlmeSetAttributeRequest(PhyPibAttributeIdentifier::phyCurrentChannel, pibAttr);
 
     // Enable Phy receiver
+    StopInactiveSleep();
     m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_RX_ON);
 
-    uint64_t searchSymbols;
-    Time searchBeaconTime;
-
     if (m_trackingEvent.IsPending())
     {
         m_trackingEvent.Cancel();
@@ -883,13 +913,9 @@ LrWpanMac::MlmeSyncRequest(MlmeSyncRequestParams params)
     if (params.m_trackBcn)
     {
         m_numLostBeacons = 0;
-        // search for a beacon for a time = incomingSuperframe symbols + 960 symbols
-        searchSymbols =
-            ((uint64_t)1 << m_incomingBeaconOrder) + 1 * lrwpan::aBaseSuperframeDuration;
-        searchBeaconTime = Seconds((double)searchSymbols / symbolRate);
         m_beaconTrackingOn = true;
         m_trackingEvent =
-            Simulator::Schedule(searchBeaconTime, &LrWpanMac::BeaconSearchTimeout, this);
+            Simulator::Schedule(GetBeaconSearchTime(), &LrWpanMac::BeaconSearchTimeout, this);
     }
     else
     {
@@ -897,6 +923,40 @@ LrWpanMac::MlmeSyncRequest(MlmeSyncRequestParams params)
     }
 }
 
+void
+LrWpanMac::PresetSync(SuperframeField superframe)
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(m_macPanId != 0xffff, "The device must be associated");
+    NS_ASSERT_MSG(superframe.GetBeaconOrder() < 15, "The PAN must be beacon-enabled");
+
+    // What ReceiveBeacon takes from the superframe specification of a beacon
+    m_incomingBeaconOrder = superframe.GetBeaconOrder();
+    m_incomingSuperframeOrder = superframe.GetFrameOrder();
+    m_incomingFnlCapSlot = superframe.GetFinalCapSlot();
+    m_incomingBeaconInterval =
+        (static_cast<uint32_t>(1 << m_incomingBeaconOrder)) * lrwpan::aBaseSuperframeDuration;
+    m_incomingSuperframeDuration =
+        lrwpan::aBaseSuperframeDuration * (static_cast<uint32_t>(1 << m_incomingSuperframeOrder));
+    m_csmaCa->SetSlottedCsmaCa();
+    m_csmaCa->SetBatteryLifeExtension(superframe.IsBattLifeExt());
+
+    // The first beacon is due now: until it is received, the device is in the
+    // inactive period of a superframe that started one beacon interval ago.
+    auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false); // symbols per second
+    m_macBeaconRxTime =
+        Simulator::Now() - Seconds(static_cast<double>(m_incomingBeaconInterval) / symbolRate);
+
+    StopInactiveSleep();
+    m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_RX_ON);
+
+    m_trackingEvent.Cancel();
+    m_numLostBeacons = 0;
+    m_beaconTrackingOn = true;
+    m_trackingEvent =
+        Simulator::Schedule(GetBeaconSearchTime(), &LrWpanMac::BeaconSearchTimeout, this);
+}
+
 void
 LrWpanMac::MlmePollRequest(MlmePollRequestParams params)
 {
@@ -931,6 +991,7 @@ LrWpanMac::MlmeSetRequest(MacPibAttributeIdentifier id, Ptr<MacPibAttributes> at
         else
         {
             m_macBeaconPayload = attribute->macBeaconPayload;
+            m_beaconTemplate = nullptr;
         }
         break;
     case macBeaconPayloadLength:
@@ -1035,6 +1096,7 @@ LrWpanMac::MlmeGetRequest(MacPibAttributeIdentifier id)
 void
 LrWpanMac::SendOneBeacon()
 {
+    LRWPAN_PROFILE("Mac::SendOneBeacon");
     if (m_coor)
     {
         // std::cout << "\n---BEACON START---" << std::endl;
@@ -1062,51 +1124,30 @@ LrWpanMac::SendOneBeacon()
 
     m_macBsn++;
 
-    Ptr<Packet> beaconPacket;
-    if (m_macBeaconPayload.empty())
-    {
-        beaconPacket = Create<Packet>();
-    }
-    else
-    {
-        // Extract the octets from m_macBeaconPayload and place them in a packet
-        uint8_t* octets = &m_macBeaconPayload[0];
-        beaconPacket = Create<Packet>(octets, m_macBeaconPayload.size());
-    }
-
-    LrWpanMacHeader macHdr(LrWpanMacHeader::LRWPAN_MAC_BEACON, m_macBsn.GetValue());
-    macHdr.SetDstAddrMode(LrWpanMacHeader::SHORTADDR);
-    macHdr.SetDstAddrFields(GetPanId(), Mac16Address("ff:ff"));
-
-    // see IEEE 802.15.4-2011 Section 5.1.2.4
-    if (GetShortAddress() == Mac16Address("ff:fe"))
-    {
-        macHdr.SetSrcAddrMode(LrWpanMacHeader::EXTADDR);
-        macHdr.SetSrcAddrFields(GetPanId(), GetExtendedAddress());
-    }
-    else
+    // The beacon is only rebuilt when its content changes: a new payload or
+    // pending address list drops the template, and the superframe specification
+    // and addressing fields are compared to those it was built with.
+    uint16_t superframeField = GetSuperframeField();
+    if (!m_beaconTemplate || superframeField != m_beaconTemplateSuperframe ||
+        GetPanId() != m_beaconTemplatePanId || GetShortAddress() != m_beaconTemplateShortAddr ||
+        GetExtendedAddress() != m_beaconTemplateExtAddr)
     {
-        macHdr.SetSrcAddrMode(LrWpanMacHeader::SHORTADDR);
-        macHdr.SetSrcAddrFields(GetPanId(), GetShortAddress());
+        BuildBeaconTemplate(superframeField);
     }
 
-    macHdr.SetSecDisable();
-    macHdr.SetNoAckReq();
-
-    BeaconPayloadHeader macPayload;
-    macPayload.SetSuperframeSpecField(GetSuperframeField());
-    macPayload.SetGtsFields(GetGtsFields());
-    macPayload.SetPndAddrFields(GetPendingAddrFields());
-
-    beaconPacket->AddHeader(macPayload);
-    beaconPacket->AddHeader(macHdr);
+    // Only the BSN differs from the template, patch it and the FCS
+    Ptr<Packet> beaconPacket = m_beaconTemplate->Copy();
+    m_beaconHeader.SetSeqNum(m_macBsn.GetValue());
+    beaconPacket->AddHeader(m_beaconHeader);
 
-    // Calculate FCS if the global attribute ChecksumEnabled is set.
     LrWpanMacTrailer macTrailer;
     if (Node::ChecksumEnabled())
     {
         macTrailer.EnableFcs(true);
-        macTrailer.SetFcs(beaconPacket);
+        // the template FCS is computed with BSN 0, the BSN is the third octet
+        macTrailer.PatchFcs(m_beaconTemplateFcs,
+                            m_macBsn.GetValue(),
+                            beaconPacket->GetSize() - 3);
     }
 
     beaconPacket->AddTrailer(macTrailer);
@@ -1135,6 +1176,61 @@ LrWpanMac::SendOneBeacon()
     }
 }
 
+void
+LrWpanMac::BuildBeaconTemplate(uint16_t superframeField)
+{
+    NS_LOG_FUNCTION(this << superframeField);
+
+    if (m_macBeaconPayload.empty())
+    {
+        m_beaconTemplate = Create<Packet>();
+    }
+    else
+    {
+        // Extract the octets from m_macBeaconPayload and place them in a packet
+        uint8_t* octets = &m_macBeaconPayload[0];
+        m_beaconTemplate = Create<Packet>(octets, m_macBeaconPayload.size());
+    }
+
+    BeaconPayloadHeader macPayload;
+    macPayload.SetSuperframeSpecField(superframeField);
+    macPayload.SetGtsFields(GetGtsFields());
+    macPayload.SetPndAddrFields(GetPendingAddrFields());
+    m_beaconTemplate->AddHeader(macPayload);
+
+    m_beaconHeader = LrWpanMacHeader(LrWpanMacHeader::LRWPAN_MAC_BEACON, 0);
+    m_beaconHeader.SetDstAddrMode(LrWpanMacHeader::SHORTADDR);
+    m_beaconHeader.SetDstAddrFields(GetPanId(), Mac16Address("ff:ff"));
+
+    // see IEEE 802.15.4-2011 Section 5.1.2.4
+    if (GetShortAddress() == Mac16Address("ff:fe"))
+    {
+        m_beaconHeader.SetSrcAddrMode(LrWpanMacHeader::EXTADDR);
+        m_beaconHeader.SetSrcAddrFields(GetPanId(), GetExtendedAddress());
+    }
+    else
+    {
+        m_beaconHeader.SetSrcAddrMode(LrWpanMacHeader::SHORTADDR);
+        m_beaconHeader.SetSrcAddrFields(GetPanId(), GetShortAddress());
+    }
+
+    m_beaconHeader.SetSecDisable();
+    m_beaconHeader.SetNoAckReq();
+
+    m_beaconTemplateSuperframe = superframeField;
+    m_beaconTemplatePanId = GetPanId();
+    m_beaconTemplateShortAddr = GetShortAddress();
+    m_beaconTemplateExtAddr = GetExtendedAddress();
+
+    // FCS of the beacon with BSN 0, patched for each beacon
+    Ptr<Packet> frame = m_beaconTemplate->Copy();
+    frame->AddHeader(m_beaconHeader);
+    LrWpanMacTrailer macTrailer;
+    macTrailer.EnableFcs(true);
+    macTrailer.SetFcs(frame);
+    m_beaconTemplateFcs = macTrailer.GetFcs();
+}
+
 void
 LrWpanMac::SendBeaconRequestCommand()
 {
@@ -1602,6 +1698,7 @@ LrWpanMac::EndChannelEnergyScan()
 void
 LrWpanMac::StartCAP(SuperframeType superframeType)
 {
+    LRWPAN_PROFILE("Mac::StartCAP");
     uint32_t activeSlot;
     uint64_t capDuration;
     Time endCapTime;
@@ -1650,6 +1747,7 @@ LrWpanMac::StartCAP(SuperframeType superframeType)
 void
 LrWpanMac::StartCFP(SuperframeType superframeType)
 {
+    LRWPAN_PROFILE("Mac::StartCFP");
     uint32_t activeSlot;
     uint64_t cfpDuration;
     Time endCfpTime;
@@ -1700,6 +1798,7 @@ LrWpanMac::StartCFP(SuperframeType superframeType)
 void
 LrWpanMac::StartInactivePeriod(SuperframeType superframeType)
 {
+    LRWPAN_PROFILE("Mac::StartInactivePeriod");
     uint64_t inactiveDuration;
     Time endInactiveTime;
     uint64_t symbolRate;
@@ -1719,6 +1818,12 @@ LrWpanMac::StartInactivePeriod(SuperframeType superframeType)
         NS_LOG_DEBUG("Incoming superframe Inactive Portion duration "
                      << inactiveDuration << " symbols (" << endInactiveTime.As(Time::S) << ")");
         m_beaconEvent = Simulator::Schedule(endInactiveTime, &LrWpanMac::AwaitBeacon, this);
+
+        if (m_inactiveSleep && inactiveDuration > 0)
+        {
+            SleepUntilBeacon(m_macBeaconRxTime +
+                             Seconds(static_cast<double>(m_incomingBeaconInterval) / symbolRate));
+        }
     }
     else
     {
@@ -1739,6 +1844,7 @@ LrWpanMac::StartInactivePeriod(SuperframeType superframeType)
 void
 LrWpanMac::AwaitBeacon()
 {
+    LRWPAN_PROFILE("Mac::AwaitBeacon");
     m_incSuperframeStatus = BEACON;
 
     // TODO: If the device waits more than the expected time to receive the beacon (wait = 46
@@ -1751,15 +1857,18 @@ LrWpanMac::AwaitBeacon()
 void
 LrWpanMac::BeaconSearchTimeout()
 {
-    auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false); // symbols per second
+    LRWPAN_PROFILE("Mac::BeaconSearchTimeout");
 
     if (m_numLostBeacons > lrwpan::aMaxLostBeacons)
     {
-        MlmeSyncLossIndicationParams syncLossParams;
-        // syncLossParams.m_logCh =
-        syncLossParams.m_lossReason = MacStatus::BEACON_LOSS;
-        syncLossParams.m_panId = m_macPanId;
-        m_mlmeSyncLossIndicationCallback(syncLossParams);
+        if (!m_mlmeSyncLossIndicationCallback.IsNull())
+        {
+            MlmeSyncLossIndicationParams syncLossParams;
+            // syncLossParams.m_logCh =
+            syncLossParams.m_lossReason = MacStatus::BEACON_LOSS;
+            syncLossParams.m_panId = m_macPanId;
+            m_mlmeSyncLossIndicationCallback(syncLossParams);
+        }
 
         m_beaconTrackingOn = false;
         m_numLostBeacons = 0;
@@ -1769,16 +1878,129 @@ LrWpanMac::BeaconSearchTimeout()
         m_numLostBeacons++;
 
         // Search for one more beacon
-        uint64_t searchSymbols;
-        Time searchBeaconTime;
-        searchSymbols =
-            ((uint64_t)1 << m_incomingBeaconOrder) + 1 * lrwpan::aBaseSuperframeDuration;
-        searchBeaconTime = Seconds((double)searchSymbols / symbolRate);
         m_trackingEvent =
-            Simulator::Schedule(searchBeaconTime, &LrWpanMac::BeaconSearchTimeout, this);
+            Simulator::Schedule(GetBeaconSearchTime(), &LrWpanMac::BeaconSearchTimeout, this);
+    }
+}
+
+Time
+LrWpanMac::GetBeaconSearchTime() const
+{
+    auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false); // symbols per second
+    uint64_t searchSymbols =
+        lrwpan::aBaseSuperframeDuration * ((static_cast<uint64_t>(1) << m_incomingBeaconOrder) + 1);
+    return Seconds(static_cast<double>(searchSymbols) / symbolRate);
+}
+
+void
+LrWpanMac::SleepUntilBeacon(Time expected)
+{
+    NS_LOG_FUNCTION(this << expected);
+    auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false); // symbols per second
+    Time turnaround = Seconds(static_cast<double>(lrwpan::aTurnaroundTime) / symbolRate);
+    Time wakeup = expected - m_beaconGuardTime * (m_missedBeacons + 1) - turnaround;
+    if (wakeup <= Simulator::Now())
+    {
+        // No time to sleep before the listening window
+        WakeForBeacon(expected);
+        return;
+    }
+
+    NS_LOG_DEBUG("Transceiver off until " << wakeup.As(Time::S));
+    m_radioAsleep = true;
+    m_sleepEnd = wakeup;
+    if (m_macState == MAC_IDLE)
+    {
+        m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_TRX_OFF);
+    }
+    // otherwise the transceiver is turned off when the MAC is back to idle
+    m_wakeupEvent = Simulator::Schedule(wakeup - Simulator::Now(),
+                                        &LrWpanMac::WakeForBeacon,
+                                        this,
+                                        expected);
+}
+
+void
+LrWpanMac::WakeForBeacon(Time expected)
+{
+    NS_LOG_FUNCTION(this << expected);
+    auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false); // symbols per second
+    Time beaconDuration = Seconds(static_cast<double>(m_rxBeaconSymbols) / symbolRate);
+    Time windowEnd = expected + m_beaconGuardTime * (m_missedBeacons + 1) + beaconDuration;
+
+    m_radioAsleep = false;
+    m_beaconWindowEvent = Simulator::Schedule(windowEnd - Simulator::Now(),
+                                              &LrWpanMac::BeaconWindowTimeout,
+                                              this,
+                                              expected);
+    if (m_macState == MAC_IDLE)
+    {
+        m_phy->PlmeSetTRXStateRequest(GetIdleTrxState());
     }
 }
 
+void
+LrWpanMac::BeaconWindowTimeout(Time expected)
+{
+    NS_LOG_FUNCTION(this << expected);
+    auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false); // symbols per second
+
+    if (m_phy->GetTrxState() == IEEE_802_15_4_PHY_BUSY_RX)
+    {
+        // The beacon may be late: wait for the end of the frame
+        Time backoffPeriod = Seconds(static_cast<double>(lrwpan::aUnitBackoffPeriod) / symbolRate);
+        m_beaconWindowEvent = Simulator::Schedule(backoffPeriod,
+                                                  &LrWpanMac::BeaconWindowTimeout,
+                                                  this,
+                                                  expected);
+        return;
+    }
+
+    m_missedBeacons++;
+    if (m_missedBeacons > lrwpan::aMaxLostBeacons)
+    {
+        NS_LOG_DEBUG("Beacon missed " << +m_missedBeacons << " times, stop sleeping");
+        m_missedBeacons = 0;
+        if (m_macState == MAC_IDLE)
+        {
+            m_phy->PlmeSetTRXStateRequest(GetIdleTrxState());
+        }
+        return;
+    }
+
+    NS_LOG_DEBUG("Beacon missed " << +m_missedBeacons << " times, widen the window");
+    SleepUntilBeacon(expected +
+                     Seconds(static_cast<double>(m_incomingBeaconInterval) / symbolRate));
+}
+
+void
+LrWpanMac::StopInactiveSleep()
+{
+    if (m_radioAsleep)
+    {
+        // woken before the sleep end: the signals on the air were not delivered
+        LrWpanSleepingPhyFilter::WakeUp(m_phy);
+    }
+    m_wakeupEvent.Cancel();
+    m_beaconWindowEvent.Cancel();
+    m_radioAsleep = false;
+    m_missedBeacons = 0;
+}
+
+PhyEnumeration
+LrWpanMac::GetIdleTrxState() const
+{
+    if (m_radioAsleep)
+    {
+        return IEEE_802_15_4_PHY_TRX_OFF;
+    }
+    if (m_macRxOnWhenIdle || m_beaconWindowEvent.IsPending())
+    {
+        return IEEE_802_15_4_PHY_RX_ON;
+    }
+    return IEEE_802_15_4_PHY_TRX_OFF;
+}
+
 void
 LrWpanMac::ReceiveBeacon(uint8_t lqi, Ptr<Packet> p)
 {
@@ -1836,6 +2058,7 @@ LrWpanMac::ReceiveBeacon(uint8_t lqi, Ptr<Packet> p)
         // operations when receiving a beacon (e.g. Those taking place at the
         // beginning of an Association).
         m_csmaCa->Cancel();
+        StopInactiveSleep();
 
         SuperframeField incomingSuperframe(receivedMacPayload.GetSuperframeSpecField());
 
@@ -1946,14 +2169,9 @@ LrWpanMac::ReceiveBeacon(uint8_t lqi, Ptr<Packet> p)
             if (m_beaconTrackingOn)
             {
                 // if tracking option is on keep tracking the next beacon
-                uint64_t searchSymbols;
-                Time searchBeaconTime;
-
-                searchSymbols = (static_cast<uint64_t>(1 << m_incomingBeaconOrder)) +
-                                1 * lrwpan::aBaseSuperframeDuration;
-                searchBeaconTime = Seconds(static_cast<double>(searchSymbols / symbolRate));
-                m_trackingEvent =
-                    Simulator::Schedule(searchBeaconTime, &LrWpanMac::BeaconSearchTimeout, this);
+                m_trackingEvent = Simulator::Schedule(GetBeaconSearchTime(),
+                                                      &LrWpanMac::BeaconSearchTimeout,
+                                                      this);
             }
 
             PendingAddrFields pndAddrFields;
@@ -1987,6 +2205,7 @@ void
 LrWpanMac::CheckQueue()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Mac::CheckQueue");
     // Pull a packet from the queue and start sending if we are not already sending.
     if (m_macState == MAC_IDLE && !m_txQueue.empty() && !m_setMacState.IsPending())
     {
@@ -2092,6 +2311,7 @@ LrWpanMac::GetPhy()
 void
 LrWpanMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
 {
+    LRWPAN_PROFILE("Mac::PdDataIndication");
     NS_ASSERT(m_macState == MAC_IDLE || m_macState == MAC_ACK_PENDING || m_macState == MAC_CSMA);
     NS_LOG_FUNCTION(this << psduLength << p << (uint16_t)lqi);
 
@@ -2127,6 +2347,16 @@ LrWpanMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
     }
     else
     {
+        // Peek at the addressing fields only: unless we are promiscuous, frames for
+        // another PAN or device are dropped without deserializing their header.
+        LrWpanMacHeaderView receivedMacHdrView;
+        p->PeekHeader(receivedMacHdrView);
+        if (!m_macPromiscuousMode && !AcceptFrameAddress(receivedMacHdrView))
+        {
+            m_macRxDropTrace(originalPkt, m_priority);
+            return;
+        }
+
         LrWpanMacHeader receivedMacHdr;
         p->RemoveHeader(receivedMacHdr);
 
@@ -2202,51 +2432,8 @@ LrWpanMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
         }
         else
         {
-            // level 3 frame filtering
-            acceptFrame = (receivedMacHdr.GetType() != LrWpanMacHeader::LRWPAN_MAC_RESERVED);
-
-            if (acceptFrame)
-            {
-                acceptFrame = (receivedMacHdr.GetFrameVer() <= 1);
-            }
-
-            if (acceptFrame && (receivedMacHdr.GetDstAddrMode() > 1))
-            {
-                // Accept frame if one of the following is true:
-
-                // 1) Have the same macPanId
-                // 2) Is Message to all PANs
-                // 3) Is a beacon or command frame and the macPanId is not present (bootstrap)
-                acceptFrame = ((receivedMacHdr.GetDstPanId() == m_macPanId ||
-                                receivedMacHdr.GetDstPanId() == 0xffff) ||
-                               (m_macPanId == 0xffff && receivedMacHdr.IsBeacon())) ||
-                              (m_macPanId == 0xffff && receivedMacHdr.IsCommand());
-            }
-
-            if (acceptFrame && (receivedMacHdr.GetDstAddrMode() == SHORT_ADDR))
-            {
-                if (receivedMacHdr.GetShortDstAddr() == m_shortAddress)
-                {
-                    // unicast, for me
-                    acceptFrame = true;
-                }
-                else if (receivedMacHdr.GetShortDstAddr().IsBroadcast() ||
-                         receivedMacHdr.GetShortDstAddr().IsMulticast())
-                {
-                    // Broadcast or multicast.
-                    // Discard broadcast/multicast with the ACK bit set.
-                    acceptFrame = !receivedMacHdr.IsAckReq();
-                }
-                else
-                {
-                    acceptFrame = false;
-                }
-            }
-
-            if (acceptFrame && (receivedMacHdr.GetDstAddrMode() == EXT_ADDR))
-            {
-                acceptFrame = (receivedMacHdr.GetExtDstAddr() == m_macExtendedAddress);
-            }
+            // level 3 frame filtering, the addressing fields were checked on the view
+            acceptFrame = true;
 
             if (acceptFrame && m_scanEvent.IsPending())
             {
@@ -2369,9 +2556,14 @@ LrWpanMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                         break;
                     }
 
-                    m_setMacState = Simulator::ScheduleNow(&LrWpanMac::SendAck,
-                                                           this,
-                                                           receivedMacHdr.GetSeqNum());
+                    // Data frames need nothing after their ACK: the PHY may send it alone.
+                    if (!m_autoAck || !receivedMacHdr.IsData() ||
+                        !SendAutoAck(receivedMacHdr.GetSeqNum()))
+                    {
+                        m_setMacState = Simulator::ScheduleNow(&LrWpanMac::SendAck,
+                                                               this,
+                                                               receivedMacHdr.GetSeqNum());
+                    }
                 }
 
                 if (receivedMacHdr.GetSrcAddrMode() == SHORT_ADDR &&
@@ -2487,7 +2679,7 @@ LrWpanMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                 else if (receivedMacHdr.IsAcknowledgment() && m_txPkt &&
                          m_macState == MAC_ACK_PENDING)
                 {
-                    LrWpanMacHeader peekedMacHdr;
+                    LrWpanMacHeaderView peekedMacHdr;
                     m_txPkt->PeekHeader(peekedMacHdr);
                     // If it is an ACK with the expected sequence number, finish the transmission
                     if (receivedMacHdr.GetSeqNum() == peekedMacHdr.GetSeqNum())
@@ -2676,13 +2868,94 @@ LrWpanMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
     }
 }
 
+bool
+LrWpanMac::AcceptFrameAddress(const LrWpanMacHeaderView& hdr) const
+{
+    // level 3 filtering on the frame type and version, the destination PAN ID and address
+    if (hdr.GetType() == LrWpanMacHeader::LRWPAN_MAC_RESERVED || hdr.GetFrameVer() > 1)
+    {
+        return false;
+    }
+
+    if (hdr.GetDstAddrMode() > 1)
+    {
+        // Accept frame if one of the following is true:
+
+        // 1) Have the same macPanId
+        // 2) Is Message to all PANs
+        // 3) Is a beacon or command frame and the macPanId is not present (bootstrap)
+        uint16_t dstPanId = hdr.GetDstPanId();
+        if (!(dstPanId == m_macPanId || dstPanId == 0xffff ||
+              (m_macPanId == 0xffff && (hdr.IsBeacon() || hdr.IsCommand()))))
+        {
+            return false;
+        }
+    }
+
+    if (hdr.GetDstAddrMode() == SHORT_ADDR)
+    {
+        Mac16Address dstAddr = hdr.GetShortDstAddr();
+        if (dstAddr == m_shortAddress)
+        {
+            // unicast, for me
+            return true;
+        }
+        // Broadcast or multicast.
+        // Discard broadcast/multicast with the ACK bit set.
+        return (dstAddr.IsBroadcast() || dstAddr.IsMulticast()) && !hdr.IsAckReq();
+    }
+
+    if (hdr.GetDstAddrMode() == EXT_ADDR)
+    {
+        return hdr.GetExtDstAddr() == m_macExtendedAddress;
+    }
+    return true;
+}
+
 void
 LrWpanMac::SendAck(uint8_t seqno)
 {
     NS_LOG_FUNCTION(this << static_cast<uint32_t>(seqno));
+    LRWPAN_PROFILE("Mac::SendAck");
+
+    NS_ASSERT(m_macState == MAC_IDLE);
+
+    // Enqueue the ACK packet for further processing
+    // when the transmitter is activated.
+    m_txPkt = CreateAck(seqno);
+
+    // Switch transceiver to TX mode. Proceed sending the Ack on confirm.
+    ChangeMacState(MAC_SENDING);
+    m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_TX_ON);
+}
+
+bool
+LrWpanMac::SendAutoAck(uint8_t seqno)
+{
+    NS_LOG_FUNCTION(this << static_cast<uint32_t>(seqno));
+    LRWPAN_PROFILE("Mac::SendAutoAck");
 
     NS_ASSERT(m_macState == MAC_IDLE);
 
+    Ptr<Packet> ackPacket = CreateAck(seqno);
+    if (!m_phy->PdAutoAckRequest(ackPacket))
+    {
+        return false;
+    }
+
+    // The MAC stays in SENDING until the PHY is back in RX_ON, as with SendAck.
+    // The ACK is traced now: no MAC event marks the start of its transmission.
+    m_txPkt = ackPacket;
+    ChangeMacState(MAC_SENDING);
+    m_promiscSnifferTrace(m_txPkt);
+    m_snifferTrace(m_txPkt);
+    m_macTxTrace(m_txPkt, m_priority);
+    return true;
+}
+
+Ptr<Packet>
+LrWpanMac::CreateAck(uint8_t seqno) const
+{
     // Generate a corresponding ACK Frame.
     LrWpanMacHeader macHdr(LrWpanMacHeader::LRWPAN_MAC_ACKNOWLEDGMENT, seqno);
     LrWpanMacTrailer macTrailer;
@@ -2695,14 +2968,7 @@ LrWpanMac::SendAck(uint8_t seqno)
         macTrailer.SetFcs(ackPacket);
     }
     ackPacket->AddTrailer(macTrailer);
-
-    // Enqueue the ACK packet for further processing
-    // when the transmitter is activated.
-    m_txPkt = ackPacket;
-
-    // Switch transceiver to TX mode. Proceed sending the Ack on confirm.
-    ChangeMacState(MAC_SENDING);
-    m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_TX_ON);
+    return ackPacket;
 }
 
 void
@@ -2755,6 +3021,7 @@ void
 LrWpanMac::AckWaitTimeout()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Mac::AckWaitTimeout");
 
     // TODO: If we are a PAN coordinator and this was an indirect transmission,
     //       we will not initiate a retransmission. Instead we wait for the data
@@ -2805,6 +3072,7 @@ LrWpanMac::AckWaitTimeout()
 void
 LrWpanMac::IfsWaitTimeout(Time ifsTime)
 {
+    LRWPAN_PROFILE("Mac::IfsWaitTimeout");
     auto symbolRate = (uint64_t)m_phy->GetDataOrSymbolRate(false);
     Time lifsTime = Seconds((double)m_macLIFSPeriod / symbolRate);
     Time sifsTime = Seconds((double)m_macSIFSPeriod / symbolRate);
@@ -2986,6 +3254,7 @@ LrWpanMac::EnqueueInd(Ptr<Packet> p)
         indTxQElement->expireTime = expireTime;
         indTxQElement->txQPkt = p;
         m_indTxQueue.emplace_back(indTxQElement);
+        m_beaconTemplate = nullptr; // pending address list changed
         m_macIndTxEnqueueTrace(p);
     }
     else
@@ -3019,6 +3288,7 @@ LrWpanMac::DequeueInd(Mac64Address dst, Ptr<IndTxQueueElement> entry)
             *entry = **iter;
             m_macIndTxDequeueTrace((*iter)->txQPkt->Copy());
             m_indTxQueue.erase(iter);
+            m_beaconTemplate = nullptr;
             return true;
         }
     }
@@ -3063,6 +3333,7 @@ LrWpanMac::PurgeInd()
             }
             m_macIndTxDropTrace(m_indTxQueue[i]->txQPkt->Copy());
             m_indTxQueue.erase(m_indTxQueue.begin() + i);
+            m_beaconTemplate = nullptr;
         }
         else
         {
@@ -3169,6 +3440,7 @@ LrWpanMac::RemovePendTxQElement(Ptr<Packet> p)
             {
                 m_macIndTxDequeueTrace(p);
                 m_indTxQueue.erase(it);
+                m_beaconTemplate = nullptr;
                 break;
             }
         }
@@ -3179,6 +3451,7 @@ LrWpanMac::RemovePendTxQElement(Ptr<Packet> p)
             {
                 m_macIndTxDequeueTrace(p);
                 m_indTxQueue.erase(it);
+                m_beaconTemplate = nullptr;
                 break;
             }
         }
@@ -3190,6 +3463,7 @@ LrWpanMac::RemovePendTxQElement(Ptr<Packet> p)
 void
 LrWpanMac::PdDataConfirm(PhyEnumeration status)
 {
+    LRWPAN_PROFILE("Mac::PdDataConfirm");
     NS_ASSERT(m_macState == MAC_SENDING);
     NS_LOG_FUNCTION(this << status << m_txQueue.size());
 
@@ -3445,10 +3719,31 @@ LrWpanMac::PdDataConfirm(PhyEnumeration status)
     m_setMacState = Simulator::ScheduleNow(&LrWpanMac::SetLrWpanMacState, this, MAC_IDLE);
 }
 
+void
+LrWpanMac::PdAutoAckConfirm(PhyEnumeration status)
+{
+    NS_LOG_FUNCTION(this << status);
+    LRWPAN_PROFILE("Mac::PdAutoAckConfirm");
+    NS_ASSERT(m_macState == MAC_SENDING);
+
+    if (status != IEEE_802_15_4_PHY_SUCCESS)
+    {
+        NS_LOG_ERROR("Unable to send ACK");
+    }
+
+    // Clear the packet buffer for the ACK packet sent.
+    m_txPkt = nullptr;
+
+    // The PHY already turned back to receive: go idle without another event.
+    m_setMacState.Cancel();
+    SetLrWpanMacState(MAC_IDLE);
+}
+
 void
 LrWpanMac::PlmeCcaConfirm(PhyEnumeration status)
 {
     NS_LOG_FUNCTION(this << status);
+    LRWPAN_PROFILE("Mac::PlmeCcaConfirm");
     // Direct this call through the csmaCa object
     m_csmaCa->PlmeCcaConfirm(status);
 }
@@ -3766,18 +4061,12 @@ void
 LrWpanMac::SetLrWpanMacState(MacState macState)
 {
     NS_LOG_FUNCTION(this << "mac state = " << macState);
+    LRWPAN_PROFILE("Mac::SetLrWpanMacState");
 
     if (macState == MAC_IDLE)
     {
         ChangeMacState(MAC_IDLE);
-        if (m_macRxOnWhenIdle)
-        {
-            m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_RX_ON);
-        }
-        else
-        {
-            m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_TRX_OFF);
-        }
+        m_phy->PlmeSetTRXStateRequest(GetIdleTrxState());
     }
     else if (macState == MAC_ACK_PENDING)
     {
@@ -3929,14 +4218,7 @@ LrWpanMac::SetLrWpanMacState(MacState macState)
         }
 
         ChangeMacState(MAC_IDLE);
-        if (m_macRxOnWhenIdle)
-        {
-            m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_RX_ON);
-        }
-        else
-        {
-            m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_TRX_OFF);
-        }
+        m_phy->PlmeSetTRXStateRequest(GetIdleTrxState());
     }
     else if (m_macState == MAC_CSMA && macState == MAC_CSMA_DEFERRED)
     {
@@ -3957,6 +4239,12 @@ LrWpanMac::SetTxQMaxSize(uint32_t queueSize)
     m_maxTxQueueSize = queueSize;
 }
 
+uint32_t
+LrWpanMac::GetTxQSize() const
+{
+    return m_txQueue.size();
+}
+
 void
 LrWpanMac::SetIndTxQMaxSize(uint32_t queueSize)
 {
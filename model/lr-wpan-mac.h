@@ -15,6 +15,7 @@
 #define LR_WPAN_MAC_H
 
 #include "lr-wpan-fields.h"
+#include "lr-wpan-mac-header.h"
 #include "lr-wpan-mac-base.h"
 #include "lr-wpan-phy.h"
 
@@ -34,6 +35,7 @@ namespace lrwpan
 {
 
 class LrWpanCsmaCaCommon;
+class LrWpanMacHeaderView;
 
 /**
  * \defgroup lr-wpan LR-WPAN models
@@ -193,6 +195,22 @@ class LrWpanMac : public LrWpanMacBase
      */
     void SetRxOnWhenIdle(bool rxOnWhenIdle);
 
+    /**
+     * Get the end of the inactive period sleep of the transceiver.
+     *
+     * With the InactiveSleep attribute set, a device turns its transceiver off
+     * in the inactive period of the incoming superframe and turns it back on
+     * BeaconGuardTime before the next beacon is expected, the turnaround time
+     * included. Each beacon missed in a row widens the listening window by one
+     * more guard time on both sides, as the clock drift grows with the time
+     * since the last beacon; after aMaxLostBeacons misses, the transceiver
+     * follows macRxOnWhenIdle again until a beacon is received.
+     *
+     * \return the time the transceiver is turned back on, or zero if it is not
+     *         asleep
+     */
+    Time GetSleepEnd() const;
+
     // XXX these setters will become obsolete if we use the attribute system
     /**
      * Set the short address of this MAC.
@@ -270,6 +288,19 @@ class LrWpanMac : public LrWpanMacBase
 
     void MlmeGetRequest(MacPibAttributeIdentifier id) override;
 
+    /**
+     * Put an associated device in the state of a completed MLME-SYNC.request
+     * with TrackBeacon set, without searching for the beacon: the incoming
+     * superframe is preloaded from the superframe specification its coordinator
+     * is about to send and the first beacon is expected now, when the
+     * coordinator starts its superframe. The device runs the slotted CSMA/CA
+     * and its first CAP starts with the first beacon received; a beacon not
+     * received in time counts as lost, as with MLME-SYNC.request.
+     *
+     * \param superframe the superframe specification of the coordinator
+     */
+    void PresetSync(SuperframeField superframe);
+
     /**
      * Set the CSMA/CA implementation to be used by the MAC.
      *
@@ -313,6 +344,14 @@ class LrWpanMac : public LrWpanMacBase
      */
     void PdDataConfirm(PhyEnumeration status);
 
+    /**
+     * Confirm the end of an automatic acknowledgment sent by the PHY (see
+     * LrWpanPhy::PdAutoAckRequest), the transceiver being back in its receive
+     * state.
+     * \param status the status of the ACK transmission
+     */
+    void PdAutoAckConfirm(PhyEnumeration status);
+
     /**
      * IEEE 802.15.4-2006 section 6.2.2.2
      * PLME-CCA.confirm status
@@ -371,6 +410,14 @@ class LrWpanMac : public LrWpanMacBase
      */
     void SetTxQMaxSize(uint32_t queueSize);
 
+    /**
+     * Get the number of packets in the transmit queue, including the one
+     * being transmitted.
+     *
+     * \return the transmit queue size
+     */
+    uint32_t GetTxQSize() const;
+
     /**
      * Set the max size of the indirect transmit queue (Pending Transaction list)
      *
@@ -535,6 +582,42 @@ class LrWpanMac : public LrWpanMacBase
      */
     uint32_t m_macBeaconPayloadLength;
 
+    /**
+     * The beacon payload header and payload of the last beacon, reused while
+     * its content does not change (see SendOneBeacon).
+     */
+    Ptr<Packet> m_beaconTemplate;
+
+    /**
+     * The MAC header of the beacon template, with the BSN of the last beacon.
+     */
+    LrWpanMacHeader m_beaconHeader;
+
+    /**
+     * The FCS of the beacon template with BSN 0.
+     */
+    uint16_t m_beaconTemplateFcs;
+
+    /**
+     * The superframe specification the beacon template was built with.
+     */
+    uint16_t m_beaconTemplateSuperframe;
+
+    /**
+     * The PAN ID the beacon template was built with.
+     */
+    uint16_t m_beaconTemplatePanId;
+
+    /**
+     * The short address the beacon template was built with.
+     */
+    Mac16Address m_beaconTemplateShortAddr;
+
+    /**
+     * The extended address the beacon template was built with.
+     */
+    Mac64Address m_beaconTemplateExtAddr;
+
     /**
      * The maximum number of retries allowed after a transmission failure.
      * See IEEE 802.15.4-2006, section 7.4.2, Table 86.
@@ -635,6 +718,39 @@ class LrWpanMac : public LrWpanMacBase
      */
     uint8_t m_numLostBeacons;
 
+    /**
+     * Indication of whether the transceiver is turned off in the inactive
+     * period of the incoming superframe (see GetSleepEnd).
+     */
+    bool m_inactiveSleep;
+
+    /**
+     * The time the transceiver is turned on before an expected beacon.
+     */
+    Time m_beaconGuardTime;
+
+    /**
+     * Indication of whether the data frames are acknowledged by the PHY
+     * itself, without a transceiver state request from the MAC.
+     */
+    bool m_autoAck;
+
+    /**
+     * Indication of whether the transceiver sleeps in the inactive period.
+     */
+    bool m_radioAsleep;
+
+    /**
+     * The time the sleeping transceiver is turned back on.
+     */
+    Time m_sleepEnd;
+
+    /**
+     * The number of beacons missed in a row while sleeping in the inactive
+     * periods.
+     */
+    uint8_t m_missedBeacons;
+
     /**
      * Get the macAckWaitDuration attribute value.
      *
@@ -787,11 +903,28 @@ class LrWpanMac : public LrWpanMacBase
         Time expireTime; //!< The expiration time of the packet in the indirect transmission queue.
     };
 
+    /**
+     * Level 3 filtering of a received frame on its type, version, destination
+     * PAN ID and destination address (IEEE 802.15.4-2006, section 7.5.6.2).
+     *
+     * \param hdr the view of the received MAC header
+     * \return true if the frame is for this device
+     */
+    bool AcceptFrameAddress(const LrWpanMacHeaderView& hdr) const;
+
     /**
      * Called to send a single beacon frame.
      */
     void SendOneBeacon();
 
+    /**
+     * Build the beacon template of SendOneBeacon from the current beacon
+     * payload, GTS and pending address fields and addressing fields.
+     *
+     * \param superframeField the superframe specification of the beacon
+     */
+    void BuildBeaconTemplate(uint16_t superframeField);
+
     /**
      * Called to send an associate request command.
      */
@@ -884,6 +1017,55 @@ class LrWpanMac : public LrWpanMacBase
      */
     void BeaconSearchTimeout();
 
+    /**
+     * Get the time a tracking device waits for the next beacon:
+     * aBaseSuperframeDuration * (2^macBeaconOrder + 1) symbols of the incoming
+     * superframe (IEEE 802.15.4-2011, Section 6.2.4).
+     *
+     * \return the beacon search time
+     */
+    Time GetBeaconSearchTime() const;
+
+    /**
+     * Turn the transceiver off until the listening window of an expected
+     * beacon, or listen at once if the window is already open.
+     *
+     * \param expected the expected start of the beacon
+     */
+    void SleepUntilBeacon(Time expected);
+
+    /**
+     * Turn the transceiver on for an expected beacon and close the listening
+     * window after the beacon.
+     *
+     * \param expected the expected start of the beacon
+     */
+    void WakeForBeacon(Time expected);
+
+    /**
+     * Called at the end of the listening window of a beacon not received:
+     * sleep until the next one, with a wider window.
+     *
+     * \param expected the expected start of the missed beacon
+     */
+    void BeaconWindowTimeout(Time expected);
+
+    /**
+     * Stop the inactive period sleep, e.g. on a beacon received. A transceiver
+     * woken before its sleep end gets the signals still on the air that the
+     * channel did not deliver (LrWpanSleepingPhyFilter::WakeUp).
+     */
+    void StopInactiveSleep();
+
+    /**
+     * Get the transceiver state of the MAC when idle: off while sleeping in
+     * the inactive period, on in the listening window of a beacon, and as set
+     * by macRxOnWhenIdle otherwise.
+     *
+     * \return IEEE_802_15_4_PHY_RX_ON or IEEE_802_15_4_PHY_TRX_OFF
+     */
+    PhyEnumeration GetIdleTrxState() const;
+
     /**
      * Used to process the reception of a beacon packet.
      *
@@ -899,6 +1081,23 @@ class LrWpanMac : public LrWpanMacBase
      */
     void SendAck(uint8_t seqno);
 
+    /**
+     * Have the PHY send the acknowledgment of a received data frame by itself
+     * (see the AutoAck attribute).
+     *
+     * \param seqno the sequence number for the ACK
+     * \return false if the PHY cannot, the ACK is then to be sent by SendAck
+     */
+    bool SendAutoAck(uint8_t seqno);
+
+    /**
+     * Build an acknowledgment frame.
+     *
+     * \param seqno the sequence number for the ACK
+     * \return the ACK frame, with its FCS if checksums are enabled
+     */
+    Ptr<Packet> CreateAck(uint8_t seqno) const;
+
     /**
      * Add an element to the transmission queue.
      *
@@ -1348,6 +1547,16 @@ class LrWpanMac : public LrWpanMacBase
      */
     EventId m_trackingEvent;
 
+    /**
+     * Scheduler event to turn the transceiver on before an expected beacon.
+     */
+    EventId m_wakeupEvent;
+
+    /**
+     * Scheduler event for the end of the listening window of a beacon.
+     */
+    EventId m_beaconWindowEvent;
+
     /**
      * Scheduler event for the end of an ACTIVE or PASSIVE channel scan.
      */
@@ -131,6 +131,7 @@ LrWpanNetDevice::CompleteConfig()
 
     m_phy->SetPdDataIndicationCallback(MakeCallback(&LrWpanMac::PdDataIndication, m_mac));
     m_phy->SetPdDataConfirmCallback(MakeCallback(&LrWpanMac::PdDataConfirm, m_mac));
+    m_phy->SetPdAutoAckConfirmCallback(MakeCallback(&LrWpanMac::PdAutoAckConfirm, m_mac));
     m_phy->SetPlmeEdConfirmCallback(MakeCallback(&LrWpanMac::PlmeEdConfirm, m_mac));
     m_phy->SetPlmeGetAttributeConfirmCallback(
         MakeCallback(&LrWpanMac::PlmeGetAttributeConfirm, m_mac));
@@ -13,11 +13,13 @@
 #include "lr-wpan-error-model.h"
 #include "lr-wpan-lqi-tag.h"
 #include "lr-wpan-net-device.h"
+#include "lr-wpan-profiler.h"
 #include "lr-wpan-spectrum-signal-parameters.h"
 #include "lr-wpan-spectrum-value-helper.h"
 
 #include <ns3/abort.h>
 #include <ns3/antenna-model.h>
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/error-model.h>
 #include <ns3/log.h>
@@ -149,6 +151,27 @@ LrWpanPhy::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&LrWpanPhy::m_postReceptionErrorModel),
                           MakePointerChecker<ErrorModel>())
+            .AddAttribute("CaptureEnabled",
+                          "Resolve a frame arriving during the reception of another one "
+                          "with the capture model, instead of always dropping the late "
+                          "frame and letting the interference decide the fate of the "
+                          "current one.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LrWpanPhy::m_captureEnabled),
+                          MakeBooleanChecker())
+            .AddAttribute("FirstCaptureThreshold",
+                          "With the capture model, the SINR (dB) the frame being received "
+                          "needs when a late frame arrives to be kept; below, both frames "
+                          "are lost.",
+                          DoubleValue(3),
+                          MakeDoubleAccessor(&LrWpanPhy::m_firstCaptureThreshold),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("ResyncThreshold",
+                          "With the capture model, the SINR (dB) a late frame needs for the "
+                          "receiver to abandon the current frame and re-synchronize on it.",
+                          DoubleValue(6),
+                          MakeDoubleAccessor(&LrWpanPhy::m_resyncThreshold),
+                          MakeDoubleChecker<double>())
             .AddTraceSource("TrxStateValue",
                             "The state of the transceiver",
                             MakeTraceSourceAccessor(&LrWpanPhy::m_trxState),
@@ -187,7 +210,22 @@ LrWpanPhy::GetTypeId()
                             "Trace source indicating a packet has been "
                             "dropped by the device during reception",
                             MakeTraceSourceAccessor(&LrWpanPhy::m_phyRxDropTrace),
-                            "ns3::Packet::TracedCallback");
+                            "ns3::Packet::TracedCallback")
+            .AddTraceSource("PhyCcaBegin",
+                            "Trace source indicating a CCA has begun, "
+                            "with the duration of its measurement",
+                            MakeTraceSourceAccessor(&LrWpanPhy::m_phyCcaBeginTrace),
+                            "ns3::Time::TracedCallback")
+            .AddTraceSource("PhyEdBegin",
+                            "Trace source indicating an energy detection has begun, "
+                            "with the duration of its measurement",
+                            MakeTraceSourceAccessor(&LrWpanPhy::m_phyEdBeginTrace),
+                            "ns3::Time::TracedCallback")
+            .AddTraceSource("PhyRxCapture",
+                            "Trace source indicating the capture model resolved a frame "
+                            "arriving during the reception of another one",
+                            MakeTraceSourceAccessor(&LrWpanPhy::m_phyRxCaptureTrace),
+                            "ns3::lrwpan::LrWpanPhy::CaptureTracedCallback");
     return tid;
 }
 
@@ -209,6 +247,9 @@ LrWpanPhy::LrWpanPhy()
     m_random->SetAttribute("Max", DoubleValue(1.0));
 
     m_isRxCanceled = false;
+    m_captureEnabled = false;
+    m_firstCaptureThreshold = 3;
+    m_resyncThreshold = 6;
     ChangeTrxState(IEEE_802_15_4_PHY_TRX_OFF);
 }
 
@@ -271,6 +312,7 @@ LrWpanPhy::DoDispose()
     m_random = nullptr;
     m_pdDataIndicationCallback = MakeNullCallback<void, uint32_t, Ptr<Packet>, uint8_t>();
     m_pdDataConfirmCallback = MakeNullCallback<void, PhyEnumeration>();
+    m_pdAutoAckConfirmCallback = MakeNullCallback<void, PhyEnumeration>();
     m_plmeCcaConfirmCallback = MakeNullCallback<void, PhyEnumeration>();
     m_plmeEdConfirmCallback = MakeNullCallback<void, PhyEnumeration, uint8_t>();
     m_plmeGetAttributeConfirmCallback =
@@ -353,6 +395,7 @@ void
 LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
 {
     NS_LOG_FUNCTION(this << spectrumRxParams);
+    LRWPAN_PROFILE("Phy::StartRx");
 
     if (!m_edRequest.IsExpired())
     {
@@ -446,9 +489,7 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
     }
     else if (m_trxState == IEEE_802_15_4_PHY_BUSY_RX)
     {
-        // Drop the new packet.
         NS_LOG_DEBUG(this << " packet collision");
-        m_phyRxDropTrace(p, m_priority);
 
         // Check if we correctly received the old packet up to now.
         CheckInterference();
@@ -457,6 +498,16 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
         // checked for successful reception of the current packet for the time
         // before the additional interference.
         m_signal->AddSignal(lrWpanRxParams->psd);
+
+        if (m_captureEnabled)
+        {
+            Capture(lrWpanRxParams);
+        }
+        else
+        {
+            // Drop the new packet.
+            m_phyRxDropTrace(p, m_priority);
+        }
     }
     else
     {
@@ -536,10 +587,62 @@ LrWpanPhy::CheckInterference()
     m_rxLastUpdate = Simulator::Now();
 }
 
+void
+LrWpanPhy::Capture(Ptr<LrWpanSpectrumSignalParameters> lateRxParams)
+{
+    NS_LOG_FUNCTION(this << lateRxParams);
+
+    Ptr<LrWpanSpectrumSignalParameters> currentRxParams = m_currentRxPacket.first;
+    NS_ASSERT(currentRxParams);
+    Ptr<Packet> currentPacket = currentRxParams->packetBurst->GetPackets().front();
+    Ptr<Packet> latePacket = lateRxParams->packetBurst->GetPackets().front();
+
+    // Each frame is weighed against the other one, the other signals and the noise.
+    double lateSinr = 10 * log10(GetSinr(lateRxParams->psd));
+    double currentSinr = 10 * log10(GetSinr(currentRxParams->psd));
+
+    if (lateSinr >= m_resyncThreshold)
+    {
+        // The current frame becomes interference; its EndRx() only removes its signal.
+        NS_LOG_DEBUG(this << " re-synchronizing on a late frame, SINR " << lateSinr << " dB");
+        m_phyRxCaptureTrace(currentPacket, latePacket, PHY_CAPTURE_RESYNC);
+        m_phyRxDropTrace(currentPacket, m_priority);
+        m_currentRxPacket = std::make_pair(lateRxParams, false);
+        m_phyRxBeginTrace(latePacket);
+        m_rxLastUpdate = Simulator::Now();
+    }
+    else if (currentSinr >= m_firstCaptureThreshold)
+    {
+        NS_LOG_DEBUG(this << " current frame captured, SINR " << currentSinr << " dB");
+        m_phyRxCaptureTrace(currentPacket, latePacket, PHY_CAPTURE_FIRST);
+        m_phyRxDropTrace(latePacket, m_priority);
+    }
+    else
+    {
+        NS_LOG_DEBUG(this << " both frames lost, SINR " << currentSinr << " and " << lateSinr
+                          << " dB");
+        m_phyRxCaptureTrace(currentPacket, latePacket, PHY_CAPTURE_NONE);
+        m_phyRxDropTrace(latePacket, m_priority);
+        m_currentRxPacket.second = true;
+    }
+}
+
+double
+LrWpanPhy::GetSinr(Ptr<const SpectrumValue> psd) const
+{
+    Ptr<SpectrumValue> interferenceAndNoise = m_signal->GetSignalPsd();
+    *interferenceAndNoise -= *psd;
+    *interferenceAndNoise += *m_noise;
+    return LrWpanSpectrumValueHelper::TotalAvgPower(psd, m_phyPIBAttributes.phyCurrentChannel) /
+           LrWpanSpectrumValueHelper::TotalAvgPower(interferenceAndNoise,
+                                                    m_phyPIBAttributes.phyCurrentChannel);
+}
+
 void
 LrWpanPhy::EndRx(Ptr<SpectrumSignalParameters> par)
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Phy::EndRx");
 
     Ptr<LrWpanSpectrumSignalParameters> params = DynamicCast<LrWpanSpectrumSignalParameters>(par);
 
@@ -626,6 +729,7 @@ void
 LrWpanPhy::PdDataRequest(const uint32_t psduLength, Ptr<Packet> p)
 {
     NS_LOG_FUNCTION(this << psduLength << p);
+    LRWPAN_PROFILE("Phy::PdDataRequest");
 
     if (psduLength > lrwpan::aMaxPhyPacketSize)
     {
@@ -643,27 +747,8 @@ LrWpanPhy::PdDataRequest(const uint32_t psduLength, Ptr<Packet> p)
         if (m_trxState == IEEE_802_15_4_PHY_TX_ON)
         {
             // send down
-            NS_ASSERT(m_channel);
-
-            // Remove a possible LQI tag from a previous transmission of the packet.
-            LrWpanLqiTag lqiTag;
-            p->RemovePacketTag(lqiTag);
-
-            m_phyTxBeginTrace(p);
-            m_currentTxPacket.first = p;
-            m_currentTxPacket.second = false;
-
-            Ptr<LrWpanSpectrumSignalParameters> txParams = Create<LrWpanSpectrumSignalParameters>();
-            txParams->duration = CalculateTxTime(p);
-            txParams->txPhy = GetObject<SpectrumPhy>();
-            txParams->psd = m_txPsd;
-            txParams->txAntenna = m_antenna;
-            Ptr<PacketBurst> pb = CreateObject<PacketBurst>();
-            pb->AddPacket(p);
-            txParams->packetBurst = pb;
-            m_channel->StartTx(txParams);
-            m_pdDataRequest = Simulator::Schedule(txParams->duration, &LrWpanPhy::EndTx, this);
-            ChangeTrxState(IEEE_802_15_4_PHY_BUSY_TX);
+            Time duration = TransmitFrame(p);
+            m_pdDataRequest = Simulator::Schedule(duration, &LrWpanPhy::EndTx, this);
             return;
         }
         else if ((m_trxState == IEEE_802_15_4_PHY_RX_ON) ||
@@ -698,16 +783,48 @@ LrWpanPhy::PdDataRequest(const uint32_t psduLength, Ptr<Packet> p)
     }
 }
 
+bool
+LrWpanPhy::PdAutoAckRequest(Ptr<Packet> ack)
+{
+    NS_LOG_FUNCTION(this << ack);
+    LRWPAN_PROFILE("Phy::PdAutoAckRequest");
+
+    if (m_trxState != IEEE_802_15_4_PHY_RX_ON || !m_setTRXState.IsExpired() ||
+        ack->GetSize() > lrwpan::aMaxPhyPacketSize)
+    {
+        return false;
+    }
+
+    // Same as PlmeSetTRXStateRequest(TX_ON) from RX_ON: the receiver stops
+    // synchronizing on new frames for the turnaround.
+    CancelEd(IEEE_802_15_4_PHY_TX_ON);
+    if (!m_ccaRequest.IsExpired())
+    {
+        m_ccaRequest.Cancel();
+        if (!m_plmeCcaConfirmCallback.IsNull())
+        {
+            m_plmeCcaConfirmCallback(IEEE_802_15_4_PHY_BUSY);
+        }
+    }
+    m_trxStatePending = IEEE_802_15_4_PHY_TX_ON;
+
+    Time turnaround = Seconds((double)lrwpan::aTurnaroundTime / GetDataOrSymbolRate(false));
+    m_setTRXState = Simulator::Schedule(turnaround, &LrWpanPhy::StartAutoAck, this, ack);
+    return true;
+}
+
 void
 LrWpanPhy::PlmeCcaRequest()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Phy::PlmeCcaRequest");
 
     if (m_trxState == IEEE_802_15_4_PHY_RX_ON || m_trxState == IEEE_802_15_4_PHY_BUSY_RX)
     {
         m_ccaPeakPower = 0.0;
         Time ccaTime = Seconds(8.0 / GetDataOrSymbolRate(false));
         m_ccaRequest = Simulator::Schedule(ccaTime, &LrWpanPhy::EndCca, this);
+        m_phyCcaBeginTrace(ccaTime);
     }
     else
     {
@@ -743,6 +860,7 @@ LrWpanPhy::PlmeEdRequest()
         m_edPower.lastUpdate = Simulator::Now();
         m_edPower.measurementLength = Seconds(8.0 / GetDataOrSymbolRate(false));
         m_edRequest = Simulator::Schedule(m_edPower.measurementLength, &LrWpanPhy::EndEd, this);
+        m_phyEdBeginTrace(m_edPower.measurementLength);
     }
     else
     {
@@ -1308,6 +1426,13 @@ LrWpanPhy::SetPdDataConfirmCallback(PdDataConfirmCallback c)
     m_pdDataConfirmCallback = c;
 }
 
+void
+LrWpanPhy::SetPdAutoAckConfirmCallback(PdDataConfirmCallback c)
+{
+    NS_LOG_FUNCTION(this);
+    m_pdAutoAckConfirmCallback = c;
+}
+
 void
 LrWpanPhy::SetPlmeCcaConfirmCallback(PlmeCcaConfirmCallback c)
 {
@@ -1380,6 +1505,7 @@ void
 LrWpanPhy::EndEd()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Phy::EndEd");
 
     m_edPower.averagePower +=
         LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
@@ -1416,6 +1542,7 @@ void
 LrWpanPhy::EndCca()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Phy::EndCca");
     PhyEnumeration sensedChannelState = IEEE_802_15_4_PHY_UNSPECIFIED;
 
     // Update peak power.
@@ -1491,6 +1618,7 @@ void
 LrWpanPhy::EndSetTRXState()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Phy::EndSetTRXState");
 
     NS_ABORT_IF((m_trxStatePending != IEEE_802_15_4_PHY_RX_ON) &&
                 (m_trxStatePending != IEEE_802_15_4_PHY_TX_ON));
@@ -1507,6 +1635,7 @@ void
 LrWpanPhy::EndTx()
 {
     NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Phy::EndTx");
 
     NS_ABORT_IF((m_trxState != IEEE_802_15_4_PHY_BUSY_TX) &&
                 (m_trxState != IEEE_802_15_4_PHY_TRX_OFF));
@@ -1559,6 +1688,94 @@ LrWpanPhy::EndTx()
     }
 }
 
+Time
+LrWpanPhy::TransmitFrame(Ptr<Packet> p)
+{
+    NS_ASSERT(m_channel);
+    NS_ASSERT(m_trxState == IEEE_802_15_4_PHY_TX_ON);
+
+    // Remove a possible LQI tag from a previous transmission of the packet.
+    LrWpanLqiTag lqiTag;
+    p->RemovePacketTag(lqiTag);
+
+    m_phyTxBeginTrace(p);
+    m_currentTxPacket.first = p;
+    m_currentTxPacket.second = false;
+
+    Ptr<LrWpanSpectrumSignalParameters> txParams = Create<LrWpanSpectrumSignalParameters>();
+    txParams->duration = CalculateTxTime(p);
+    txParams->txPhy = GetObject<SpectrumPhy>();
+    txParams->psd = m_txPsd;
+    txParams->txAntenna = m_antenna;
+    Ptr<PacketBurst> pb = CreateObject<PacketBurst>();
+    pb->AddPacket(p);
+    txParams->packetBurst = pb;
+    m_channel->StartTx(txParams);
+    ChangeTrxState(IEEE_802_15_4_PHY_BUSY_TX);
+    return txParams->duration;
+}
+
+void
+LrWpanPhy::StartAutoAck(Ptr<Packet> ack)
+{
+    NS_LOG_FUNCTION(this << ack);
+    LRWPAN_PROFILE("Phy::StartAutoAck");
+
+    m_trxStatePending = IEEE_802_15_4_PHY_IDLE;
+    ChangeTrxState(IEEE_802_15_4_PHY_TX_ON);
+
+    // One event covers the ACK and the turnaround back to RX_ON, in which
+    // the transceiver receives nothing either.
+    Time turnaround = Seconds((double)lrwpan::aTurnaroundTime / GetDataOrSymbolRate(false));
+    Time duration = TransmitFrame(ack);
+    m_pdDataRequest = Simulator::Schedule(duration + turnaround, &LrWpanPhy::EndAutoAck, this);
+}
+
+void
+LrWpanPhy::EndAutoAck()
+{
+    NS_LOG_FUNCTION(this);
+    LRWPAN_PROFILE("Phy::EndAutoAck");
+
+    NS_ABORT_IF((m_trxState != IEEE_802_15_4_PHY_BUSY_TX) &&
+                (m_trxState != IEEE_802_15_4_PHY_TRX_OFF));
+
+    PhyEnumeration status = IEEE_802_15_4_PHY_SUCCESS;
+    if (!m_currentTxPacket.second)
+    {
+        NS_LOG_DEBUG("ACK successfully transmitted");
+        m_phyTxEndTrace(m_currentTxPacket.first);
+    }
+    else
+    {
+        NS_LOG_DEBUG("ACK transmission aborted");
+        m_phyTxDropTrace(m_currentTxPacket.first);
+        status = m_trxState;
+    }
+    m_currentTxPacket.first = nullptr;
+    m_currentTxPacket.second = false;
+
+    if (m_trxStatePending != IEEE_802_15_4_PHY_IDLE)
+    {
+        NS_LOG_LOGIC("Apply pending state change to " << m_trxStatePending);
+        ChangeTrxState(m_trxStatePending);
+        m_trxStatePending = IEEE_802_15_4_PHY_IDLE;
+        if (!m_plmeSetTRXStateConfirmCallback.IsNull())
+        {
+            m_plmeSetTRXStateConfirmCallback(IEEE_802_15_4_PHY_SUCCESS);
+        }
+    }
+    else if (m_trxState != IEEE_802_15_4_PHY_TRX_OFF)
+    {
+        ChangeTrxState(IEEE_802_15_4_PHY_RX_ON);
+    }
+
+    if (!m_pdAutoAckConfirmCallback.IsNull())
+    {
+        m_pdAutoAckConfirmCallback(status);
+    }
+}
+
 Time
 LrWpanPhy::CalculateTxTime(Ptr<const Packet> packet)
 {
@@ -1584,6 +1801,12 @@ LrWpanPhy::GetCurrentChannelNum() const
     return m_phyPIBAttributes.phyCurrentChannel;
 }
 
+PhyEnumeration
+LrWpanPhy::GetTrxState() const
+{
+    return m_trxState;
+}
+
 double
 LrWpanPhy::GetDataOrSymbolRate(bool isData)
 {
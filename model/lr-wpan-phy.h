@@ -147,6 +147,19 @@ namespace TracedValueCallback
 typedef void (*PhyEnumeration)(PhyEnumeration oldValue, PhyEnumeration newValue);
 } // namespace TracedValueCallback
 
+/**
+ * \ingroup lr-wpan
+ *
+ * Outcome of a frame arriving while another one is received, with the capture
+ * model of the PHY enabled (see the PhyRxCapture trace).
+ */
+enum PhyCaptureOutcome
+{
+    PHY_CAPTURE_NONE = 0,  //!< Neither frame dominates, both are lost
+    PHY_CAPTURE_FIRST = 1, //!< The frame being received is kept, the late one dropped
+    PHY_CAPTURE_RESYNC = 2 //!< The receiver re-synchronizes on the stronger late frame
+};
+
 /**
  * \ingroup lr-wpan
  *
@@ -364,6 +377,22 @@ class LrWpanPhy : public SpectrumPhy
      */
     void PdDataRequest(const uint32_t psduLength, Ptr<Packet> p);
 
+    /**
+     * Send the acknowledgment of the frame just received, as a transceiver
+     * with automatic acknowledgment does: the ACK is transmitted
+     * aTurnaroundTime after the end of the reception and the receiver is back
+     * in RX_ON aTurnaroundTime after the end of the ACK, without any state
+     * request from the MAC. The ACK goes through the channel as any frame,
+     * with the same timing as PLME-SET-TRX-STATE.request(TX_ON) followed by
+     * PD-DATA.request, so that other devices see it in their CCAs and as
+     * interference. The transceiver stays BUSY_TX until it is back in RX_ON.
+     * The end is reported by the auto ACK confirm callback.
+     *
+     * \param ack the ACK frame
+     * \return false, nothing being done, if the transceiver is not idle in RX_ON
+     */
+    bool PdAutoAckRequest(Ptr<Packet> ack);
+
     /**
      * IEEE 802.15.4-2006 section 6.2.2.1
      * PLME-CCA.request
@@ -424,6 +453,14 @@ class LrWpanPhy : public SpectrumPhy
      */
     void SetPdDataConfirmCallback(PdDataConfirmCallback c);
 
+    /**
+     * set the callback for the end of an automatic acknowledgment (see
+     * PdAutoAckRequest), the transceiver being back in RX_ON or its
+     * requested state.
+     * \param c the callback
+     */
+    void SetPdAutoAckConfirmCallback(PdDataConfirmCallback c);
+
     /**
      * set the callback for the end of a CCA, as part of the
      * interconnections between the PHY and the MAC. The callback
@@ -478,6 +515,13 @@ class LrWpanPhy : public SpectrumPhy
      */
     uint8_t GetCurrentChannelNum() const;
 
+    /**
+     * Get the current state of the transceiver.
+     *
+     * \return the transceiver state
+     */
+    PhyEnumeration GetTrxState() const;
+
     /**
      * implement PLME SetAttribute confirm SAP
      * bit rate is in bit/s.  Symbol rate is in symbol/s.
@@ -561,6 +605,17 @@ class LrWpanPhy : public SpectrumPhy
                                         PhyEnumeration oldState,
                                         PhyEnumeration newState);
 
+    /**
+     * TracedCallback signature for the capture decisions.
+     *
+     * \param [in] current The frame being received.
+     * \param [in] late The frame arriving during its reception.
+     * \param [in] outcome The capture outcome.
+     */
+    typedef void (*CaptureTracedCallback)(Ptr<const Packet> current,
+                                          Ptr<const Packet> late,
+                                          PhyCaptureOutcome outcome);
+
     uint8_t GetPriority();
     void SetPriority(uint8_t priority);
 
@@ -596,12 +651,57 @@ class LrWpanPhy : public SpectrumPhy
      */
     void EndTx();
 
+    /**
+     * Send a frame on the channel and enter BUSY_TX, the transceiver being in
+     * TX_ON.
+     *
+     * \param p the frame
+     * \return the duration of the transmission
+     */
+    Time TransmitFrame(Ptr<Packet> p);
+
+    /**
+     * Start the transmission of an automatic acknowledgment, at the end of the
+     * turnaround to TX_ON.
+     *
+     * \param ack the ACK frame
+     */
+    void StartAutoAck(Ptr<Packet> ack);
+
+    /**
+     * Finish an automatic acknowledgment, at the end of the turnaround back to
+     * RX_ON: fire the trace sources of the end of the transmission, apply a
+     * possibly pending state change and confirm to the MAC.
+     */
+    void EndAutoAck();
+
     /**
      * Check if the interference destroys a frame currently received. Called
      * whenever a change in interference is detected.
      */
     void CheckInterference();
 
+    /**
+     * Resolve the arrival of a frame while another one is received, with the
+     * capture model: the receiver re-synchronizes on the late frame if its
+     * SINR reaches the re-synchronization threshold, else it keeps the current
+     * frame if its SINR reaches the first-frame capture threshold, else both
+     * frames are lost. The late frame must already be part of the signal.
+     *
+     * \param lateRxParams signal parameters of the late frame
+     */
+    void Capture(Ptr<LrWpanSpectrumSignalParameters> lateRxParams);
+
+    /**
+     * Calculate the SINR of a signal, all the other received signals and the
+     * noise being interference.
+     *
+     * \param psd the power spectral density of the signal, part of the
+     *        received signals
+     * \return the SINR (linear)
+     */
+    double GetSinr(Ptr<const SpectrumValue> psd) const;
+
     /**
      * Finish the reception of a frame. This is called at the end of a frame
      * reception, applying possibly pending PHY state changes and firing the
@@ -734,6 +834,30 @@ class LrWpanPhy : public SpectrumPhy
      */
     TracedCallback<Ptr<const Packet>, uint8_t> m_phyRxDropTrace;
 
+    /**
+     * The trace source fired when a CCA starts, with the duration of its
+     * measurement.
+     *
+     * \see class CallBackTraceSource
+     */
+    TracedCallback<Time> m_phyCcaBeginTrace;
+
+    /**
+     * The trace source fired when an ED measurement starts, with its duration.
+     *
+     * \see class CallBackTraceSource
+     */
+    TracedCallback<Time> m_phyEdBeginTrace;
+
+    /**
+     * The trace source fired when the capture model resolves the arrival of
+     * a frame while another one is received: the current frame, the late
+     * frame and the outcome.
+     *
+     * \see class CallBackTraceSource
+     */
+    TracedCallback<Ptr<const Packet>, Ptr<const Packet>, PhyCaptureOutcome> m_phyRxCaptureTrace;
+
     /**
      * The trace source fired when the phy layer changes the transceiver state.
      *
@@ -844,6 +968,12 @@ class LrWpanPhy : public SpectrumPhy
      */
     PdDataConfirmCallback m_pdDataConfirmCallback;
 
+    /**
+     * This callback is used to report the end of an automatic acknowledgment
+     * to the MAC layer.
+     */
+    PdDataConfirmCallback m_pdAutoAckConfirmCallback;
+
     /**
      * This callback is used to report CCA status to the MAC or CSMA/CA.
      * See IEEE 802.15.4-2006, section 6.2.2.2.
@@ -899,6 +1029,21 @@ class LrWpanPhy : public SpectrumPhy
      */
     bool m_isRxCanceled;
 
+    /**
+     * Resolve overlapping frames with the capture model.
+     */
+    bool m_captureEnabled;
+
+    /**
+     * The SINR (dB) a frame being received needs to survive a late frame.
+     */
+    double m_firstCaptureThreshold;
+
+    /**
+     * The SINR (dB) a late frame needs for the receiver to re-synchronize on it.
+     */
+    double m_resyncThreshold;
+
     /**
      * The accumulated signals currently received by the transceiver, including
      * the signal of a possibly received packet, as well as all signals
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-profiler.h"
+
+#include <ns3/global-value.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/string.h>
+
+#include <algorithm>
+#include <iomanip>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanProfiler");
+
+NS_OBJECT_ENSURE_REGISTERED(LrWpanProfilingSimulatorImpl);
+
+bool LrWpanProfiler::s_enabled = false;
+
+/**
+ * The profiler state, shared by the handlers and the simulator.
+ */
+struct LrWpanProfilerState
+{
+    std::vector<LrWpanProfiler::Entry> entries; //!< Handler profiles, by id
+    uint32_t current = 0;                       //!< Handler being run
+    uint32_t sampleInterval = 16;               //!< Timing sample interval
+    bool simulatorProfiled = false;             //!< The profiling simulator is in use
+    double runWallTime = 0;                     //!< Wall time of Simulator::Run() (s)
+};
+
+/**
+ * \return the profiler state; the entry 0 stands for the unmarked code
+ */
+static LrWpanProfilerState&
+GetState()
+{
+    static LrWpanProfilerState state{{{"(other)", 0, 0, 0, 0}}};
+    return state;
+}
+
+double
+LrWpanProfiler::Entry::GetWallTime() const
+{
+    return sampled ? sampledWallTime * calls / sampled : 0;
+}
+
+void
+LrWpanProfiler::Scope::Enter(uint32_t id)
+{
+    LrWpanProfilerState& state = GetState();
+    Entry& e = state.entries[id];
+    m_id = id;
+    m_parent = state.current;
+    state.current = id;
+    m_timed = e.calls++ % state.sampleInterval == 0;
+    if (m_timed)
+    {
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+void
+LrWpanProfiler::Scope::Exit()
+{
+    LrWpanProfilerState& state = GetState();
+    if (m_timed)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+        state.entries[m_id].sampled++;
+        state.entries[m_id].sampledWallTime += elapsed.count();
+    }
+    state.current = m_parent;
+}
+
+void
+LrWpanProfiler::Enable(uint32_t sampleInterval)
+{
+    NS_LOG_FUNCTION(sampleInterval);
+    GetState().sampleInterval = std::max<uint32_t>(sampleInterval, 1);
+    if (!GetState().simulatorProfiled)
+    {
+        GlobalValue::Bind("SimulatorImplementationType",
+                          StringValue("ns3::lrwpan::LrWpanProfilingSimulatorImpl"));
+    }
+    s_enabled = true;
+}
+
+bool
+LrWpanProfiler::IsEnabled()
+{
+    return s_enabled;
+}
+
+void
+LrWpanProfiler::Reset()
+{
+    LrWpanProfilerState& state = GetState();
+    for (auto& e : state.entries)
+    {
+        e.calls = 0;
+        e.scheduled = 0;
+        e.sampled = 0;
+        e.sampledWallTime = 0;
+    }
+    state.runWallTime = 0;
+}
+
+uint32_t
+LrWpanProfiler::Register(const std::string& name)
+{
+    std::vector<Entry>& entries = GetState().entries;
+    entries.push_back({name, 0, 0, 0, 0});
+    return entries.size() - 1;
+}
+
+void
+LrWpanProfiler::Scheduled()
+{
+    if (s_enabled)
+    {
+        LrWpanProfilerState& state = GetState();
+        state.entries[state.current].scheduled++;
+    }
+}
+
+std::vector<LrWpanProfiler::Entry>
+LrWpanProfiler::GetEntries()
+{
+    return GetState().entries;
+}
+
+double
+LrWpanProfiler::GetRunWallTime()
+{
+    return GetState().runWallTime;
+}
+
+void
+LrWpanProfiler::Report(std::ostream& os, uint32_t topN)
+{
+    const LrWpanProfilerState& state = GetState();
+    std::vector<Entry> entries(state.entries.begin() + 1, state.entries.end());
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.GetWallTime() > b.GetWallTime();
+    });
+
+    uint64_t calls = 0;
+    uint64_t scheduled = state.entries[0].scheduled;
+    for (const auto& e : entries)
+    {
+        calls += e.calls;
+        scheduled += e.scheduled;
+    }
+    double simTime = Simulator::Now().GetSeconds();
+
+    os << "PROFILE" << std::endl;
+    os << "simulated time\t" << simTime << " s" << std::endl;
+    os << "events executed\t" << Simulator::GetEventCount() << std::endl;
+    os << "handler calls\t" << calls << std::endl;
+    if (state.simulatorProfiled && state.runWallTime > 0)
+    {
+        os << "events scheduled\t" << scheduled << " (" << state.entries[0].scheduled
+           << " outside the profiled handlers)" << std::endl;
+        os << "wall time\t" << state.runWallTime << " s" << std::endl;
+        os << "sim/wall ratio\t" << simTime / state.runWallTime << std::endl;
+        os << "events/s\t" << Simulator::GetEventCount() / state.runWallTime << std::endl;
+    }
+    else
+    {
+        os << "events scheduled, wall time: n/a (LrWpanProfiler::Enable() was called after "
+              "the simulator was created)"
+           << std::endl;
+    }
+
+    os << std::left << std::setw(40) << "handler" << std::right << std::setw(14) << "calls"
+       << std::setw(14) << "scheduled" << std::setw(14) << "wall (s)" << std::setw(14)
+       << "per call (us)" << std::endl;
+    for (uint32_t i = 0; i < entries.size() && i < topN; i++)
+    {
+        const Entry& e = entries[i];
+        if (e.calls == 0)
+        {
+            break;
+        }
+        os << std::left << std::setw(40) << e.name << std::right << std::setw(14) << e.calls
+           << std::setw(14) << e.scheduled << std::setw(14) << e.GetWallTime() << std::setw(14)
+           << e.GetWallTime() / e.calls * 1e6 << std::endl;
+    }
+}
+
+TypeId
+LrWpanProfilingSimulatorImpl::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::lrwpan::LrWpanProfilingSimulatorImpl")
+                            .SetParent<DefaultSimulatorImpl>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<LrWpanProfilingSimulatorImpl>();
+    return tid;
+}
+
+LrWpanProfilingSimulatorImpl::LrWpanProfilingSimulatorImpl()
+{
+    GetState().simulatorProfiled = true;
+}
+
+LrWpanProfilingSimulatorImpl::~LrWpanProfilingSimulatorImpl()
+{
+    GetState().simulatorProfiled = false;
+}
+
+EventId
+LrWpanProfilingSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    LrWpanProfiler::Scheduled();
+    return DefaultSimulatorImpl::Schedule(delay, event);
+}
+
+void
+LrWpanProfilingSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                  const Time& delay,
+                                                  EventImpl* event)
+{
+    LrWpanProfiler::Scheduled();
+    DefaultSimulatorImpl::ScheduleWithContext(context, delay, event);
+}
+
+EventId
+LrWpanProfilingSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    LrWpanProfiler::Scheduled();
+    return DefaultSimulatorImpl::ScheduleNow(event);
+}
+
+void
+LrWpanProfilingSimulatorImpl::Run()
+{
+    auto start = std::chrono::steady_clock::now();
+    DefaultSimulatorImpl::Run();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    GetState().runWallTime += elapsed.count();
+}
+
+} // namespace lrwpan
+} // namespace ns3
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_PROFILER_H
+#define LR_WPAN_PROFILER_H
+
+#include <ns3/default-simulator-impl.h>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Opt-in wall-clock profiler of the LR-WPAN event handlers.
+ *
+ * The handlers of the PHY, the MAC and the CSMA/CA engines are marked with
+ * LRWPAN_PROFILE(). Once Enable() is called, each marked handler counts its
+ * calls (whether run as an event or called directly) and measures its wall
+ * time on one call out of the sample interval; the wall time is inclusive of
+ * the nested handlers (e.g. PHY EndRx includes the MAC reception).
+ *
+ * Enable() also selects LrWpanProfilingSimulatorImpl, which attributes every
+ * scheduled event to the handler being run when it is scheduled, and times
+ * Simulator::Run() for the sim-time/wall-time ratio. It must therefore be
+ * called before the simulator is first used; otherwise the scheduled counts
+ * and the ratio are not available.
+ *
+ * When the profiler is disabled, a marked handler costs one branch.
+ */
+class LrWpanProfiler
+{
+  public:
+    /**
+     * The profile of a handler.
+     */
+    struct Entry
+    {
+        std::string name;       //!< Handler name
+        uint64_t calls;         //!< Calls
+        uint64_t scheduled;     //!< Events scheduled during the calls
+        uint64_t sampled;       //!< Timed calls
+        double sampledWallTime; //!< Wall time of the timed calls (s)
+
+        /**
+         * \return the wall time of all calls, extrapolated from the timed ones (s)
+         */
+        double GetWallTime() const;
+    };
+
+    /**
+     * Marks a handler call; use LRWPAN_PROFILE().
+     */
+    class Scope
+    {
+      public:
+        /**
+         * \param id the handler id returned by Register()
+         */
+        explicit Scope(uint32_t id)
+            : m_active(s_enabled)
+        {
+            if (m_active)
+            {
+                Enter(id);
+            }
+        }
+
+        ~Scope()
+        {
+            if (m_active)
+            {
+                Exit();
+            }
+        }
+
+      private:
+        /**
+         * \param id the handler id
+         */
+        void Enter(uint32_t id);
+        /// Leave the handler.
+        void Exit();
+
+        bool m_active;                                 //!< The profiler was enabled on entry
+        bool m_timed;                                  //!< This call is timed
+        uint32_t m_id;                                 //!< Handler id
+        uint32_t m_parent;                             //!< Handler id of the caller
+        std::chrono::steady_clock::time_point m_start; //!< Wall-clock entry time
+    };
+
+    /**
+     * \brief Start profiling.
+     * \param sampleInterval time one call out of this many per handler (>= 1)
+     */
+    static void Enable(uint32_t sampleInterval = 16);
+
+    /**
+     * \return true if the profiler is enabled
+     */
+    static bool IsEnabled();
+
+    /**
+     * \brief Clear all counters; the handlers stay registered.
+     */
+    static void Reset();
+
+    /**
+     * \param name the handler name
+     * \return the handler id
+     */
+    static uint32_t Register(const std::string& name);
+
+    /**
+     * \brief Count an event scheduled by the current handler.
+     */
+    static void Scheduled();
+
+    /**
+     * \return the profile of every handler; the first entry collects what
+     *         happens outside of the marked handlers
+     */
+    static std::vector<Entry> GetEntries();
+
+    /**
+     * \return the wall time of Simulator::Run() (s), or 0 if it was not measured
+     */
+    static double GetRunWallTime();
+
+    /**
+     * \brief Print the totals, the sim-time/wall-time ratio and the handlers
+     *        with the largest wall time.
+     * \param os the output stream
+     * \param topN the number of handlers listed
+     */
+    static void Report(std::ostream& os, uint32_t topN = 20);
+
+  private:
+    static bool s_enabled; //!< Profiling is on
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * The default simulator, with the event scheduling counted per LR-WPAN
+ * handler and Simulator::Run() timed for LrWpanProfiler.
+ */
+class LrWpanProfilingSimulatorImpl : public DefaultSimulatorImpl
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanProfilingSimulatorImpl();
+    ~LrWpanProfilingSimulatorImpl() override;
+
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    void Run() override;
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Profile the enclosing handler under the given name (a string literal).
+ */
+#define LRWPAN_PROFILE(name)                                                                       \
+    static const uint32_t lrWpanProfileId = ns3::lrwpan::LrWpanProfiler::Register(name);           \
+    ns3::lrwpan::LrWpanProfiler::Scope lrWpanProfileScope(lrWpanProfileId)
+
+#endif /* LR_WPAN_PROFILER_H */
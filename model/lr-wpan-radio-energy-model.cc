@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-radio-energy-model.h"
+
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanRadioEnergyModel");
+NS_OBJECT_ENSURE_REGISTERED(LrWpanRadioEnergyModel);
+
+TypeId
+LrWpanRadioEnergyModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::lrwpan::LrWpanRadioEnergyModel")
+            .SetParent<energy::DeviceEnergyModel>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<LrWpanRadioEnergyModel>()
+            .AddAttribute("TxCurrentA",
+                          "The current drawn in TX_ON and BUSY_TX (A).",
+                          DoubleValue(0.0174),
+                          MakeDoubleAccessor(&LrWpanRadioEnergyModel::m_txCurrentA),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("RxCurrentA",
+                          "The current drawn in RX_ON and BUSY_RX (A).",
+                          DoubleValue(0.0188),
+                          MakeDoubleAccessor(&LrWpanRadioEnergyModel::m_rxCurrentA),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("TrxOffCurrentA",
+                          "The current drawn in TRX_OFF (A).",
+                          DoubleValue(0.000426),
+                          MakeDoubleAccessor(&LrWpanRadioEnergyModel::m_trxOffCurrentA),
+                          MakeDoubleChecker<double>(0))
+            .AddTraceSource("TotalEnergyConsumption",
+                            "Total energy consumption of the radio device (J).",
+                            MakeTraceSourceAccessor(
+                                &LrWpanRadioEnergyModel::m_totalEnergyConsumption),
+                            "ns3::TracedValueCallback::Double");
+    return tid;
+}
+
+LrWpanRadioEnergyModel::LrWpanRadioEnergyModel()
+    : m_source(nullptr),
+      m_currentState(RADIO_TRX_OFF),
+      m_lastUpdateTime(Simulator::Now()),
+      m_isSupersededChangeState(false),
+      m_totalEnergyConsumption(0),
+      m_stateEnergy{},
+      m_ccaCount(0),
+      m_ccaEnergy(0),
+      m_edCount(0),
+      m_edEnergy(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LrWpanRadioEnergyModel::~LrWpanRadioEnergyModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LrWpanRadioEnergyModel::DoDispose()
+{
+    m_source = nullptr;
+    m_energyDepletionCallback.Nullify();
+    m_energyRechargedCallback.Nullify();
+    energy::DeviceEnergyModel::DoDispose();
+}
+
+void
+LrWpanRadioEnergyModel::SetTransceiver(Transceiver transceiver)
+{
+    switch (transceiver)
+    {
+    case CC2420:
+        m_txCurrentA = 0.0174;
+        m_rxCurrentA = 0.0188;
+        m_trxOffCurrentA = 0.000426;
+        break;
+    case AT86RF233:
+        m_txCurrentA = 0.0138;
+        m_rxCurrentA = 0.0118;
+        m_trxOffCurrentA = 0.0003;
+        break;
+    }
+}
+
+void
+LrWpanRadioEnergyModel::SetEnergySource(Ptr<energy::EnergySource> source)
+{
+    NS_LOG_FUNCTION(this << source);
+    NS_ASSERT(source);
+    m_source = source;
+}
+
+double
+LrWpanRadioEnergyModel::GetTotalEnergyConsumption() const
+{
+    // add the energy of the current state, not accounted yet
+    Time duration = Simulator::Now() - m_lastUpdateTime;
+    double supplyVoltage = m_source ? m_source->GetSupplyVoltage() : 0;
+    return m_totalEnergyConsumption +
+           duration.GetSeconds() * GetStateCurrentA(m_currentState) * supplyVoltage;
+}
+
+void
+LrWpanRadioEnergyModel::ChangeState(int newState)
+{
+    NS_LOG_FUNCTION(this << newState);
+    Time duration = Simulator::Now() - m_lastUpdateTime;
+    NS_ASSERT(duration.IsPositive());
+
+    double energy = duration.GetSeconds() * GetStateCurrentA(m_currentState) *
+                    (m_source ? m_source->GetSupplyVoltage() : 0);
+    m_totalEnergyConsumption += energy;
+    m_stateTime[m_currentState] += duration;
+    m_stateEnergy[m_currentState] += energy;
+    m_lastUpdateTime = Simulator::Now();
+
+    // The source takes the energy drawn at the current of the ending state.
+    // If it runs out, the depletion callback may change the PHY state and
+    // call back into ChangeState(); that nested call then holds the latest
+    // state and this one must not overwrite it.
+    m_isSupersededChangeState = false;
+    if (m_source)
+    {
+        m_source->UpdateEnergySource();
+    }
+    if (!m_isSupersededChangeState)
+    {
+        m_currentState = ToRadioState(static_cast<PhyEnumeration>(newState));
+    }
+    m_isSupersededChangeState = true;
+}
+
+void
+LrWpanRadioEnergyModel::TrxStateChanged(PhyEnumeration oldState, PhyEnumeration newState)
+{
+    if (ToRadioState(newState) != m_currentState)
+    {
+        ChangeState(newState);
+    }
+}
+
+void
+LrWpanRadioEnergyModel::CcaBegin(Time duration)
+{
+    m_ccaCount++;
+    m_ccaEnergy += duration.GetSeconds() * m_rxCurrentA *
+                   (m_source ? m_source->GetSupplyVoltage() : 0);
+}
+
+void
+LrWpanRadioEnergyModel::EdBegin(Time duration)
+{
+    m_edCount++;
+    m_edEnergy += duration.GetSeconds() * m_rxCurrentA *
+                  (m_source ? m_source->GetSupplyVoltage() : 0);
+}
+
+void
+LrWpanRadioEnergyModel::HandleEnergyDepletion()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_energyDepletionCallback.IsNull())
+    {
+        m_energyDepletionCallback();
+    }
+}
+
+void
+LrWpanRadioEnergyModel::HandleEnergyRecharged()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_energyRechargedCallback.IsNull())
+    {
+        m_energyRechargedCallback();
+    }
+}
+
+void
+LrWpanRadioEnergyModel::HandleEnergyChanged()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LrWpanRadioEnergyModel::SetEnergyDepletionCallback(EnergyCallback callback)
+{
+    m_energyDepletionCallback = callback;
+}
+
+void
+LrWpanRadioEnergyModel::SetEnergyRechargedCallback(EnergyCallback callback)
+{
+    m_energyRechargedCallback = callback;
+}
+
+LrWpanRadioEnergyModel::RadioState
+LrWpanRadioEnergyModel::GetCurrentState() const
+{
+    return m_currentState;
+}
+
+Time
+LrWpanRadioEnergyModel::GetStateTime(RadioState state) const
+{
+    NS_ASSERT(state < RADIO_STATE_COUNT);
+    return m_stateTime[state];
+}
+
+double
+LrWpanRadioEnergyModel::GetStateEnergy(RadioState state) const
+{
+    NS_ASSERT(state < RADIO_STATE_COUNT);
+    return m_stateEnergy[state];
+}
+
+uint64_t
+LrWpanRadioEnergyModel::GetCcaCount() const
+{
+    return m_ccaCount;
+}
+
+double
+LrWpanRadioEnergyModel::GetCcaEnergy() const
+{
+    return m_ccaEnergy;
+}
+
+uint64_t
+LrWpanRadioEnergyModel::GetEdCount() const
+{
+    return m_edCount;
+}
+
+double
+LrWpanRadioEnergyModel::GetEdEnergy() const
+{
+    return m_edEnergy;
+}
+
+double
+LrWpanRadioEnergyModel::DoGetCurrentA() const
+{
+    return GetStateCurrentA(m_currentState);
+}
+
+double
+LrWpanRadioEnergyModel::GetStateCurrentA(RadioState state) const
+{
+    switch (state)
+    {
+    case RADIO_RX_ON:
+    case RADIO_BUSY_RX:
+        return m_rxCurrentA;
+    case RADIO_TX_ON:
+    case RADIO_BUSY_TX:
+        return m_txCurrentA;
+    case RADIO_TRX_OFF:
+    default:
+        return m_trxOffCurrentA;
+    }
+}
+
+LrWpanRadioEnergyModel::RadioState
+LrWpanRadioEnergyModel::ToRadioState(PhyEnumeration state)
+{
+    switch (state)
+    {
+    case IEEE_802_15_4_PHY_RX_ON:
+        return RADIO_RX_ON;
+    case IEEE_802_15_4_PHY_BUSY_RX:
+        return RADIO_BUSY_RX;
+    case IEEE_802_15_4_PHY_TX_ON:
+        return RADIO_TX_ON;
+    case IEEE_802_15_4_PHY_BUSY_TX:
+        return RADIO_BUSY_TX;
+    default:
+        return RADIO_TRX_OFF;
+    }
+}
+
+} // namespace lrwpan
+} // namespace ns3
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_RADIO_ENERGY_MODEL_H
+#define LR_WPAN_RADIO_ENERGY_MODEL_H
+
+#include "lr-wpan-phy.h"
+
+#include <ns3/callback.h>
+#include <ns3/device-energy-model.h>
+#include <ns3/energy-source.h>
+#include <ns3/nstime.h>
+#include <ns3/traced-value.h>
+
+#include <cstdint>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Energy consumption of the transceiver of a LrWpanPhy, for the ns-3
+ *        energy framework.
+ *
+ * The model follows the TrxStateValue trace of the PHY (see
+ * LrWpanRadioEnergyModelHelper) and draws, from its energy source, a current
+ * per transceiver state:
+ *
+ * - TRX_OFF: TrxOffCurrentA, the radio off with its oscillator running;
+ * - RX_ON and BUSY_RX: RxCurrentA, CCAs and energy detections included;
+ * - TX_ON and BUSY_TX: TxCurrentA.
+ *
+ * The defaults are those of the TI CC2420 at 0 dBm (17.4 mA TX, 18.8 mA RX,
+ * 426 uA idle); SetTransceiver() loads other common transceivers. The time
+ * spent and the energy drawn are kept per state.
+ *
+ * The CCAs and the energy detections, reported by the PhyCcaBegin and
+ * PhyEdBegin traces, are also tallied apart: their count and the receive
+ * energy of their measurement. This energy is part of the RX_ON energy, the
+ * tally breaks it down; a CCA cancelled before its end is counted in full.
+ *
+ * The remaining battery of each device is traced by its energy source (e.g.
+ * the RemainingEnergy trace of a BasicEnergySource).
+ */
+class LrWpanRadioEnergyModel : public energy::DeviceEnergyModel
+{
+  public:
+    /**
+     * Callback type for the depletion or recharge of the energy source.
+     */
+    typedef Callback<void> EnergyCallback;
+
+    /**
+     * Common IEEE 802.15.4 transceivers, for SetTransceiver().
+     */
+    enum Transceiver
+    {
+        CC2420,   //!< TI CC2420, 0 dBm: 17.4 mA TX, 18.8 mA RX, 0.426 mA idle
+        AT86RF233 //!< Microchip AT86RF233, +4 dBm: 13.8 mA TX, 11.8 mA RX, 0.3 mA TRX_OFF
+    };
+
+    /**
+     * The accounted transceiver states.
+     */
+    enum RadioState
+    {
+        RADIO_TRX_OFF, //!< TRX_OFF
+        RADIO_RX_ON,   //!< RX_ON, listening
+        RADIO_BUSY_RX, //!< BUSY_RX, receiving a frame
+        RADIO_TX_ON,   //!< TX_ON, ready to transmit
+        RADIO_BUSY_TX, //!< BUSY_TX, transmitting a frame
+        RADIO_STATE_COUNT
+    };
+
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanRadioEnergyModel();
+    ~LrWpanRadioEnergyModel() override;
+
+    /**
+     * \brief Load the currents of a common transceiver.
+     * \param transceiver the transceiver
+     */
+    void SetTransceiver(Transceiver transceiver);
+
+    void SetEnergySource(Ptr<energy::EnergySource> source) override;
+    double GetTotalEnergyConsumption() const override;
+
+    /**
+     * \brief Account the time since the last change and enter a PHY state.
+     * \param newState the PhyEnumeration of the new transceiver state
+     */
+    void ChangeState(int newState) override;
+
+    /**
+     * \brief Follow the TrxStateValue trace of a PHY.
+     * \param oldState the previous transceiver state
+     * \param newState the new transceiver state
+     */
+    void TrxStateChanged(PhyEnumeration oldState, PhyEnumeration newState);
+
+    /**
+     * \brief Tally a CCA, from the PhyCcaBegin trace of a PHY.
+     * \param duration the duration of the measurement
+     */
+    void CcaBegin(Time duration);
+
+    /**
+     * \brief Tally an energy detection, from the PhyEdBegin trace of a PHY.
+     * \param duration the duration of the measurement
+     */
+    void EdBegin(Time duration);
+
+    void HandleEnergyDepletion() override;
+    void HandleEnergyRecharged() override;
+    void HandleEnergyChanged() override;
+
+    /**
+     * \param callback called when the energy source is depleted
+     */
+    void SetEnergyDepletionCallback(EnergyCallback callback);
+
+    /**
+     * \param callback called when the energy source is recharged
+     */
+    void SetEnergyRechargedCallback(EnergyCallback callback);
+
+    /**
+     * \return the accounted state of the transceiver
+     */
+    RadioState GetCurrentState() const;
+
+    /**
+     * \param state an accounted state
+     * \return the time spent in the state, until the last change of state
+     */
+    Time GetStateTime(RadioState state) const;
+
+    /**
+     * \param state an accounted state
+     * \return the energy drawn in the state (J), until the last change of state
+     */
+    double GetStateEnergy(RadioState state) const;
+
+    /**
+     * \return the number of CCAs
+     */
+    uint64_t GetCcaCount() const;
+
+    /**
+     * \return the receive energy of the CCAs (J)
+     */
+    double GetCcaEnergy() const;
+
+    /**
+     * \return the number of energy detections
+     */
+    uint64_t GetEdCount() const;
+
+    /**
+     * \return the receive energy of the energy detections (J)
+     */
+    double GetEdEnergy() const;
+
+  private:
+    void DoDispose() override;
+
+    /**
+     * \return the current drawn in the current state (A)
+     */
+    double DoGetCurrentA() const override;
+
+    /**
+     * \param state an accounted state
+     * \return the current drawn in the state (A)
+     */
+    double GetStateCurrentA(RadioState state) const;
+
+    /**
+     * \param state a transceiver state
+     * \return its accounted state
+     */
+    static RadioState ToRadioState(PhyEnumeration state);
+
+    Ptr<energy::EnergySource> m_source; //!< The energy source
+    double m_txCurrentA;                //!< Current in TX_ON and BUSY_TX (A)
+    double m_rxCurrentA;                //!< Current in RX_ON and BUSY_RX (A)
+    double m_trxOffCurrentA;            //!< Current in TRX_OFF (A)
+    RadioState m_currentState;          //!< The accounted state
+    Time m_lastUpdateTime;              //!< Last change of state
+    bool m_isSupersededChangeState;     //!< A nested ChangeState() set the state
+
+    TracedValue<double> m_totalEnergyConsumption; //!< Energy drawn (J)
+    Time m_stateTime[RADIO_STATE_COUNT];          //!< Time per state
+    double m_stateEnergy[RADIO_STATE_COUNT];      //!< Energy per state (J)
+    uint64_t m_ccaCount;                          //!< CCAs
+    double m_ccaEnergy;                           //!< Receive energy of the CCAs (J)
+    uint64_t m_edCount;                           //!< Energy detections
+    double m_edEnergy;                            //!< Receive energy of the energy detections (J)
+
+    EnergyCallback m_energyDepletionCallback; //!< Energy depletion callback
+    EnergyCallback m_energyRechargedCallback; //!< Energy recharged callback
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_RADIO_ENERGY_MODEL_H */
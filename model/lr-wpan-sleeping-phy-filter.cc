@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-sleeping-phy-filter.h"
+
+#include "lr-wpan-mac.h"
+#include "lr-wpan-net-device.h"
+#include "lr-wpan-phy.h"
+
+#include <ns3/antenna-model.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/mobility-model.h>
+#include <ns3/propagation-delay-model.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-signal-parameters.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanSleepingPhyFilter");
+NS_OBJECT_ENSURE_REGISTERED(LrWpanSleepingPhyFilter);
+
+TypeId
+LrWpanSleepingPhyFilter::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::lrwpan::LrWpanSleepingPhyFilter")
+                            .SetParent<SpectrumTransmitFilter>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<LrWpanSleepingPhyFilter>();
+    return tid;
+}
+
+LrWpanSleepingPhyFilter::LrWpanSleepingPhyFilter()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LrWpanSleepingPhyFilter::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_dropped.clear();
+    SpectrumTransmitFilter::DoDispose();
+}
+
+Time
+LrWpanSleepingPhyFilter::GetDelay(Ptr<SpectrumChannel> channel,
+                                  Ptr<const SpectrumSignalParameters> params,
+                                  Ptr<const SpectrumPhy> receiverPhy)
+{
+    Ptr<PropagationDelayModel> delayModel = channel->GetPropagationDelayModel();
+    Ptr<MobilityModel> txMobility = params->txPhy ? params->txPhy->GetMobility() : nullptr;
+    Ptr<MobilityModel> rxMobility = receiverPhy->GetMobility();
+    if (!delayModel || !txMobility || !rxMobility)
+    {
+        return Time(0);
+    }
+    return delayModel->GetDelay(txMobility, rxMobility);
+}
+
+bool
+LrWpanSleepingPhyFilter::DoFilter(Ptr<const SpectrumSignalParameters> params,
+                                  Ptr<const SpectrumPhy> receiverPhy)
+{
+    Ptr<const LrWpanPhy> phy = DynamicCast<const LrWpanPhy>(receiverPhy);
+    if (!phy || phy->GetTrxState() != IEEE_802_15_4_PHY_TRX_OFF)
+    {
+        return false;
+    }
+    Ptr<LrWpanNetDevice> device = DynamicCast<LrWpanNetDevice>(phy->GetDevice());
+    if (!device || !device->GetMac())
+    {
+        return false;
+    }
+    Time sleepEnd = device->GetMac()->GetSleepEnd();
+    if (sleepEnd <= Simulator::Now())
+    {
+        return false;
+    }
+
+    Ptr<SpectrumChannel> channel = ConstCast<LrWpanPhy>(phy)->GetChannel();
+    if (!channel || channel->GetSpectrumPropagationLossModel() ||
+        channel->GetPhasedArraySpectrumPropagationLossModel())
+    {
+        // the gain of the signal could not be restored by WakeUp()
+        return false;
+    }
+    Time arrival = Simulator::Now() + GetDelay(channel, params, receiverPhy);
+    Time end = arrival + params->duration;
+    if (end >= sleepEnd)
+    {
+        return false;
+    }
+
+    std::vector<DroppedSignal>& dropped = m_dropped[receiverPhy];
+    dropped.erase(std::remove_if(dropped.begin(),
+                                 dropped.end(),
+                                 [](const DroppedSignal& signal) {
+                                     return signal.end <= Simulator::Now();
+                                 }),
+                  dropped.end());
+    dropped.push_back({params, arrival, end});
+    return true;
+}
+
+void
+LrWpanSleepingPhyFilter::WakeUp(Ptr<LrWpanPhy> phy)
+{
+    Ptr<SpectrumChannel> channel = phy->GetChannel();
+    if (!channel)
+    {
+        return;
+    }
+    for (Ptr<const SpectrumTransmitFilter> filter = channel->GetSpectrumTransmitFilter(); filter;
+         filter = filter->GetNext())
+    {
+        Ptr<const LrWpanSleepingPhyFilter> sleeping =
+            DynamicCast<const LrWpanSleepingPhyFilter>(filter);
+        if (sleeping)
+        {
+            ConstCast<LrWpanSleepingPhyFilter>(sleeping)->Deliver(phy);
+        }
+    }
+}
+
+void
+LrWpanSleepingPhyFilter::Deliver(Ptr<LrWpanPhy> phy)
+{
+    NS_LOG_FUNCTION(this << phy);
+    auto it = m_dropped.find(phy);
+    if (it == m_dropped.end())
+    {
+        return;
+    }
+    std::vector<DroppedSignal> dropped = std::move(it->second);
+    m_dropped.erase(it);
+
+    Ptr<SpectrumChannel> channel = phy->GetChannel();
+    Ptr<MobilityModel> rxMobility = phy->GetMobility();
+    Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel>(phy->GetAntenna());
+    DoubleValue maxLossDb;
+    channel->GetAttribute("MaxLossDb", maxLossDb);
+    Time now = Simulator::Now();
+    for (const auto& signal : dropped)
+    {
+        if (signal.end <= now)
+        {
+            continue;
+        }
+
+        // the path loss of SingleModelSpectrumChannel::StartTx
+        Ptr<MobilityModel> txMobility =
+            signal.params->txPhy ? signal.params->txPhy->GetMobility() : nullptr;
+        double pathLossDb = 0;
+        if (txMobility && rxMobility)
+        {
+            if (signal.params->txAntenna)
+            {
+                Angles txAngles(rxMobility->GetPosition(), txMobility->GetPosition());
+                pathLossDb -= signal.params->txAntenna->GetGainDb(txAngles);
+            }
+            if (rxAntenna)
+            {
+                Angles rxAngles(txMobility->GetPosition(), rxMobility->GetPosition());
+                pathLossDb -= rxAntenna->GetGainDb(rxAngles);
+            }
+            if (channel->GetPropagationLossModel())
+            {
+                pathLossDb -=
+                    channel->GetPropagationLossModel()->CalcRxPower(0, txMobility, rxMobility);
+            }
+        }
+        if (pathLossDb > maxLossDb.Get())
+        {
+            continue;
+        }
+
+        Ptr<SpectrumSignalParameters> rxParams = signal.params->Copy();
+        *(rxParams->psd) *= std::pow(10.0, -pathLossDb / 10.0);
+        if (signal.arrival > now)
+        {
+            Simulator::Schedule(signal.arrival - now, &LrWpanPhy::StartRx, phy, rxParams);
+        }
+        else
+        {
+            // the part of the signal still on the air, as interference
+            rxParams->duration = signal.end - now;
+            phy->StartRx(rxParams);
+        }
+    }
+}
+
+int64_t
+LrWpanSleepingPhyFilter::DoAssignStreams(int64_t stream)
+{
+    return 0;
+}
+
+} // namespace lrwpan
+} // namespace ns3
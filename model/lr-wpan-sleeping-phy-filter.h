@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_SLEEPING_PHY_FILTER_H
+#define LR_WPAN_SLEEPING_PHY_FILTER_H
+
+#include <ns3/nstime.h>
+#include <ns3/spectrum-transmit-filter.h>
+
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+class SpectrumChannel;
+
+namespace lrwpan
+{
+
+class LrWpanPhy;
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Spectrum transmit filter that does not deliver the signals that end
+ *        while their receiver sleeps in an inactive period.
+ *
+ * A LrWpanPhy whose transceiver is off still follows every signal of the
+ * channel, for its interference. The filter drops, at the transmission, the
+ * signals to a LrWpanPhy in TRX_OFF whose MAC sleeps until after the signal
+ * has ended at the receiver, the propagation delay of the channel included
+ * (see LrWpanMac::GetSleepEnd): such a signal is over before the transceiver
+ * could receive or sense it. The other receivers and the signals of other
+ * technologies are not filtered.
+ *
+ * The MAC may still wake the transceiver before its sleep end, for an MLME
+ * request (LrWpanMac::StopInactiveSleep). The filter keeps the signals it
+ * dropped until they end, and WakeUp() delivers the ones still on the air
+ * to the PHY, with the gain the channel would have applied, so that an early
+ * wake sees the same interference as without the filter.
+ */
+class LrWpanSleepingPhyFilter : public SpectrumTransmitFilter
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanSleepingPhyFilter();
+
+    /**
+     * \brief Deliver to a PHY woken before its sleep end the signals dropped
+     *        for it that are not over yet.
+     *
+     * Does nothing if the channel of the PHY has no LrWpanSleepingPhyFilter.
+     *
+     * \param phy the PHY
+     */
+    static void WakeUp(Ptr<LrWpanPhy> phy);
+
+  private:
+    /**
+     * A signal dropped for a sleeping PHY.
+     */
+    struct DroppedSignal
+    {
+        Ptr<const SpectrumSignalParameters> params; //!< The transmitted signal
+        Time arrival;                               //!< Start of the signal at the receiver
+        Time end;                                   //!< End of the signal at the receiver
+    };
+
+    void DoDispose() override;
+    bool DoFilter(Ptr<const SpectrumSignalParameters> params,
+                  Ptr<const SpectrumPhy> receiverPhy) override;
+    int64_t DoAssignStreams(int64_t stream) override;
+
+    /**
+     * \brief Deliver the dropped signals of a PHY that are not over yet.
+     * \param phy the PHY
+     */
+    void Deliver(Ptr<LrWpanPhy> phy);
+
+    /**
+     * \param channel the channel of the receiver
+     * \param params a transmitted signal
+     * \param receiverPhy the receiver
+     * \return the propagation delay of the signal to the receiver
+     */
+    static Time GetDelay(Ptr<SpectrumChannel> channel,
+                         Ptr<const SpectrumSignalParameters> params,
+                         Ptr<const SpectrumPhy> receiverPhy);
+
+    /// The signals dropped for each PHY, until they end
+    std::map<Ptr<const SpectrumPhy>, std::vector<DroppedSignal>> m_dropped;
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_SLEEPING_PHY_FILTER_H */
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-slot-scheduler.h"
+
+#include <ns3/assert.h>
+#include <ns3/log.h>
+#include <ns3/uinteger.h>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanSlotScheduler");
+NS_OBJECT_ENSURE_REGISTERED(LrWpanSlotScheduler);
+
+TypeId
+LrWpanSlotScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::lrwpan::LrWpanSlotScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<LrWpanSlotScheduler>()
+            .AddAttribute("SlotWidth",
+                          "The width of a slot of the calendar, a backoff period by default "
+                          "(aUnitBackoffPeriod symbols at 62.5 ksymbol/s)",
+                          TimeValue(MicroSeconds(320)),
+                          MakeTimeAccessor(&LrWpanSlotScheduler::m_slotWidth),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("Buckets",
+                          "The number of slots of the calendar, its horizon in slots",
+                          UintegerValue(4096),
+                          MakeUintegerAccessor(&LrWpanSlotScheduler::m_bucketCount),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+LrWpanSlotScheduler::LrWpanSlotScheduler()
+    : m_slotSteps(1),
+      m_currentSlot(0),
+      m_ringSize(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LrWpanSlotScheduler::~LrWpanSlotScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LrWpanSlotScheduler::AllocateBuckets()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(m_slotWidth.IsStrictlyPositive());
+    m_slotSteps = static_cast<uint64_t>(m_slotWidth.GetTimeStep());
+    m_buckets.resize(m_bucketCount);
+}
+
+uint64_t
+LrWpanSlotScheduler::GetSlot(uint64_t ts) const
+{
+    return ts / m_slotSteps;
+}
+
+void
+LrWpanSlotScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+
+    if (m_buckets.empty())
+    {
+        AllocateBuckets();
+    }
+
+    uint64_t slot = GetSlot(ev.key.m_ts);
+    NS_ASSERT_MSG(slot >= m_currentSlot, "Event before the current slot");
+    if (slot - m_currentSlot < m_buckets.size())
+    {
+        InsertInBucket(ev);
+    }
+    else
+    {
+        m_farEvents.emplace(ev.key, ev.impl);
+    }
+}
+
+void
+LrWpanSlotScheduler::InsertInBucket(const Event& ev)
+{
+    Bucket& bucket = m_buckets[GetSlot(ev.key.m_ts) % m_buckets.size()];
+
+    // Usually appended: the events of a time come in increasing uid order.
+    auto it = bucket.events.end();
+    auto head = bucket.events.begin() + bucket.head;
+    while (it != head && ev.key < (it - 1)->key)
+    {
+        --it;
+    }
+    bucket.events.insert(it, ev);
+    m_ringSize++;
+}
+
+bool
+LrWpanSlotScheduler::IsEmpty() const
+{
+    return m_ringSize == 0 && m_farEvents.empty();
+}
+
+Scheduler::Event
+LrWpanSlotScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+
+    if (m_ringSize == 0)
+    {
+        auto first = m_farEvents.begin();
+        return Event{first->second, first->first};
+    }
+
+    // Every event of the ring lies within the horizon: one slot per bucket.
+    for (uint64_t slot = m_currentSlot;; slot++)
+    {
+        const Bucket& bucket = m_buckets[slot % m_buckets.size()];
+        if (bucket.head < bucket.events.size())
+        {
+            return bucket.events[bucket.head];
+        }
+    }
+}
+
+Scheduler::Event
+LrWpanSlotScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+
+    if (m_ringSize == 0)
+    {
+        // Nothing within the horizon: jump to the first far event.
+        SetCurrentSlot(GetSlot(m_farEvents.begin()->first.m_ts));
+    }
+
+    Bucket* bucket = &m_buckets[m_currentSlot % m_buckets.size()];
+    while (bucket->head == bucket->events.size())
+    {
+        SetCurrentSlot(m_currentSlot + 1);
+        bucket = &m_buckets[m_currentSlot % m_buckets.size()];
+    }
+
+    Event ev = bucket->events[bucket->head++];
+    if (bucket->head == bucket->events.size())
+    {
+        bucket->events.clear();
+        bucket->head = 0;
+    }
+    m_ringSize--;
+    NS_LOG_DEBUG("Remove " << ev.impl << " at " << ev.key.m_ts);
+    return ev;
+}
+
+void
+LrWpanSlotScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+
+    uint64_t slot = GetSlot(ev.key.m_ts);
+    NS_ASSERT(slot >= m_currentSlot);
+    if (slot - m_currentSlot >= m_buckets.size())
+    {
+        auto it = m_farEvents.find(ev.key);
+        NS_ASSERT_MSG(it != m_farEvents.end() && it->second == ev.impl, "Unknown event");
+        m_farEvents.erase(it);
+        return;
+    }
+
+    Bucket& bucket = m_buckets[slot % m_buckets.size()];
+    for (auto it = bucket.events.begin() + bucket.head; it != bucket.events.end(); ++it)
+    {
+        if (it->key.m_uid == ev.key.m_uid)
+        {
+            NS_ASSERT(it->impl == ev.impl);
+            bucket.events.erase(it);
+            if (bucket.head == bucket.events.size())
+            {
+                bucket.events.clear();
+                bucket.head = 0;
+            }
+            m_ringSize--;
+            return;
+        }
+    }
+    NS_ASSERT_MSG(false, "Unknown event");
+}
+
+void
+LrWpanSlotScheduler::SetCurrentSlot(uint64_t slot)
+{
+    NS_ASSERT(slot >= m_currentSlot);
+    m_currentSlot = slot;
+
+    // The far events are in time order: those of the slot entering the
+    // horizon come first, and are appended to their empty bucket.
+    while (!m_farEvents.empty())
+    {
+        auto first = m_farEvents.begin();
+        if (GetSlot(first->first.m_ts) - m_currentSlot >= m_buckets.size())
+        {
+            break;
+        }
+        InsertInBucket(Event{first->second, first->first});
+        m_farEvents.erase(first);
+    }
+}
+
+} // namespace lrwpan
+} // namespace ns3
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_SLOT_SCHEDULER_H
+#define LR_WPAN_SLOT_SCHEDULER_H
+
+#include <ns3/nstime.h>
+#include <ns3/scheduler.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Event scheduler with a calendar of backoff period slots.
+ *
+ * In a beacon-enabled PAN, most events fall on the boundaries of the backoff
+ * periods (aUnitBackoffPeriod symbols, 320 us at 2.4 GHz): the backoffs, the
+ * CCAs, the deferrals and the superframe boundaries of every device, often
+ * many at the same time. The scheduler keeps the events of the next Buckets
+ * slots of SlotWidth in a ring, one bucket per slot, each in (time, uid)
+ * order. Events of the same time are scheduled in increasing uid order, so
+ * they are appended to their bucket and popped from its front, in constant
+ * time. The later events wait in an ordered map and enter the ring when
+ * their slot comes within the horizon.
+ *
+ * Select it for all the simulation, before the first event:
+ *
+ * \code
+ *   GlobalValue::Bind("SchedulerType", StringValue("ns3::lrwpan::LrWpanSlotScheduler"));
+ * \endcode
+ *
+ * or with --SchedulerType=ns3::lrwpan::LrWpanSlotScheduler on the command
+ * line. The order of the events, hence the results, are the same as with the
+ * other schedulers.
+ */
+class LrWpanSlotScheduler : public Scheduler
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanSlotScheduler();
+    ~LrWpanSlotScheduler() override;
+
+    void Insert(const Event& ev) override;
+    bool IsEmpty() const override;
+    Event PeekNext() const override;
+    Event RemoveNext() override;
+    void Remove(const Event& ev) override;
+
+  private:
+    /**
+     * The events of one slot, in (time, uid) order. The popped events are
+     * skipped by the head index until the bucket is empty, so the vector
+     * keeps its storage from a slot to the next.
+     */
+    struct Bucket
+    {
+        std::vector<Event> events; //!< The events
+        std::size_t head = 0;      //!< The first event not popped
+    };
+
+    /**
+     * \brief Allocate the ring, from the attributes, at the first event.
+     */
+    void AllocateBuckets();
+
+    /**
+     * \param ts the time of an event, in time steps
+     * \return its slot
+     */
+    uint64_t GetSlot(uint64_t ts) const;
+
+    /**
+     * \brief Insert an event in the bucket of its slot, within the horizon.
+     * \param ev the event
+     */
+    void InsertInBucket(const Event& ev);
+
+    /**
+     * \brief Move the ring to a later slot and bring the far events that
+     *        come within the horizon into the ring.
+     * \param slot the new first slot of the ring
+     */
+    void SetCurrentSlot(uint64_t slot);
+
+    Time m_slotWidth;                                      //!< Width of a slot
+    uint32_t m_bucketCount;                                //!< Slots in the ring
+    uint64_t m_slotSteps;                                  //!< Width of a slot, in time steps
+    uint64_t m_currentSlot;                                //!< First slot of the ring
+    std::size_t m_ringSize;                                //!< Events in the ring
+    std::vector<Bucket> m_buckets;                         //!< The ring
+    std::map<Scheduler::EventKey, EventImpl*> m_farEvents; //!< Events beyond the ring
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_SLOT_SCHEDULER_H */
@@ -0,0 +1,541 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include "lr-wpan-traffic-generator.h"
+
+#include "lr-wpan-deadline-tag.h"
+#include "lr-wpan-delay-tag.h"
+#include "lr-wpan-mac.h"
+#include "lr-wpan-priority-tag.h"
+
+#include <ns3/abort.h>
+#include <ns3/boolean.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/packet.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/simulator.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanTrafficGenerator");
+
+NS_OBJECT_ENSURE_REGISTERED(LrWpanTrafficSource);
+NS_OBJECT_ENSURE_REGISTERED(LrWpanPoissonTrafficSource);
+NS_OBJECT_ENSURE_REGISTERED(LrWpanPeriodicTrafficSource);
+NS_OBJECT_ENSURE_REGISTERED(LrWpanOnOffTrafficSource);
+NS_OBJECT_ENSURE_REGISTERED(LrWpanTraceTrafficSource);
+NS_OBJECT_ENSURE_REGISTERED(LrWpanTrafficGenerator);
+
+TypeId
+LrWpanTrafficSource::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::lrwpan::LrWpanTrafficSource").SetParent<Object>().SetGroupName("LrWpan");
+    return tid;
+}
+
+LrWpanTrafficSource::~LrWpanTrafficSource()
+{
+}
+
+uint32_t
+LrWpanTrafficSource::GetPacketSize()
+{
+    return 0;
+}
+
+int64_t
+LrWpanTrafficSource::AssignStreams(int64_t stream)
+{
+    return 0;
+}
+
+TypeId
+LrWpanPoissonTrafficSource::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::lrwpan::LrWpanPoissonTrafficSource")
+            .SetParent<LrWpanTrafficSource>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<LrWpanPoissonTrafficSource>()
+            .AddAttribute("Rate",
+                          "Mean number of packets per second",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(&LrWpanPoissonTrafficSource::m_rate),
+                          MakeDoubleChecker<double>(0));
+    return tid;
+}
+
+LrWpanPoissonTrafficSource::LrWpanPoissonTrafficSource()
+{
+    m_interval = CreateObject<ExponentialRandomVariable>();
+}
+
+Time
+LrWpanPoissonTrafficSource::GetNextArrival(Time now)
+{
+    if (m_rate <= 0)
+    {
+        return Time::Max();
+    }
+    return now + Seconds(m_interval->GetValue(1.0 / m_rate, 0));
+}
+
+int64_t
+LrWpanPoissonTrafficSource::AssignStreams(int64_t stream)
+{
+    m_interval->SetStream(stream);
+    return 1;
+}
+
+TypeId
+LrWpanPeriodicTrafficSource::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::lrwpan::LrWpanPeriodicTrafficSource")
+            .SetParent<LrWpanTrafficSource>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<LrWpanPeriodicTrafficSource>()
+            .AddAttribute("Period",
+                          "Time between two period boundaries",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&LrWpanPeriodicTrafficSource::m_period),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("Jitter",
+                          "Maximum delay of an arrival from its period boundary (< Period)",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&LrWpanPeriodicTrafficSource::m_jitter),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("RandomPhase",
+                          "Start at a random point of the first period",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LrWpanPeriodicTrafficSource::m_randomPhase),
+                          MakeBooleanChecker());
+    return tid;
+}
+
+LrWpanPeriodicTrafficSource::LrWpanPeriodicTrafficSource()
+    : m_started(false)
+{
+    m_uniform = CreateObject<UniformRandomVariable>();
+}
+
+Time
+LrWpanPeriodicTrafficSource::GetNextArrival(Time now)
+{
+    NS_ABORT_MSG_IF(m_jitter >= m_period, "The jitter must be shorter than the period");
+    if (!m_started)
+    {
+        m_boundary = now;
+        if (m_randomPhase)
+        {
+            m_boundary += Seconds(m_uniform->GetValue(0, m_period.GetSeconds()));
+        }
+        m_started = true;
+    }
+    else
+    {
+        m_boundary += m_period;
+    }
+    return m_boundary + Seconds(m_uniform->GetValue(0, m_jitter.GetSeconds()));
+}
+
+int64_t
+LrWpanPeriodicTrafficSource::AssignStreams(int64_t stream)
+{
+    m_uniform->SetStream(stream);
+    return 1;
+}
+
+TypeId
+LrWpanOnOffTrafficSource::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::lrwpan::LrWpanOnOffTrafficSource")
+            .SetParent<LrWpanTrafficSource>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<LrWpanOnOffTrafficSource>()
+            .AddAttribute("Rate",
+                          "Mean number of packets per second in the on state",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(&LrWpanOnOffTrafficSource::m_rate),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("MeanOnTime",
+                          "Mean duration of the on state",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&LrWpanOnOffTrafficSource::m_meanOn),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("MeanOffTime",
+                          "Mean duration of the off state",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&LrWpanOnOffTrafficSource::m_meanOff),
+                          MakeTimeChecker(Seconds(0)));
+    return tid;
+}
+
+LrWpanOnOffTrafficSource::LrWpanOnOffTrafficSource()
+    : m_started(false)
+{
+    m_exp = CreateObject<ExponentialRandomVariable>();
+}
+
+Time
+LrWpanOnOffTrafficSource::GetNextArrival(Time now)
+{
+    if (m_rate <= 0)
+    {
+        return Time::Max();
+    }
+    if (!m_started)
+    {
+        m_onEnd = now + Seconds(m_exp->GetValue(m_meanOn.GetSeconds(), 0));
+        m_started = true;
+    }
+
+    // Both states are memoryless: an arrival that falls past the end of the
+    // on period is redrawn from the start of the next one.
+    Time t = now;
+    while (true)
+    {
+        t += Seconds(m_exp->GetValue(1.0 / m_rate, 0));
+        if (t < m_onEnd)
+        {
+            return t;
+        }
+        t = m_onEnd + Seconds(m_exp->GetValue(m_meanOff.GetSeconds(), 0));
+        m_onEnd = t + Seconds(m_exp->GetValue(m_meanOn.GetSeconds(), 0));
+    }
+}
+
+int64_t
+LrWpanOnOffTrafficSource::AssignStreams(int64_t stream)
+{
+    m_exp->SetStream(stream);
+    return 1;
+}
+
+TypeId
+LrWpanTraceTrafficSource::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::lrwpan::LrWpanTraceTrafficSource")
+                            .SetParent<LrWpanTrafficSource>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<LrWpanTraceTrafficSource>();
+    return tid;
+}
+
+LrWpanTraceTrafficSource::LrWpanTraceTrafficSource()
+    : m_next(0),
+      m_start(Time::Min()),
+      m_size(0)
+{
+}
+
+void
+LrWpanTraceTrafficSource::AddArrival(Time at, uint32_t size)
+{
+    m_arrivals.emplace_back(at, size);
+}
+
+Time
+LrWpanTraceTrafficSource::GetNextArrival(Time now)
+{
+    if (m_start == Time::Min())
+    {
+        m_start = now;
+        std::stable_sort(m_arrivals.begin(),
+                         m_arrivals.end(),
+                         [](const std::pair<Time, uint32_t>& a, const std::pair<Time, uint32_t>& b) {
+                             return a.first < b.first;
+                         });
+    }
+    if (m_next == m_arrivals.size())
+    {
+        return Time::Max();
+    }
+    m_size = m_arrivals[m_next].second;
+    return m_start + m_arrivals[m_next++].first;
+}
+
+uint32_t
+LrWpanTraceTrafficSource::GetPacketSize()
+{
+    return m_size;
+}
+
+TypeId
+LrWpanTrafficGenerator::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::lrwpan::LrWpanTrafficGenerator")
+            .SetParent<Object>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<LrWpanTrafficGenerator>()
+            .AddAttribute("PacketSize",
+                          "Packet size of the TPs without their own size (bytes)",
+                          UintegerValue(50),
+                          MakeUintegerAccessor(&LrWpanTrafficGenerator::m_packetSize),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("PanId",
+                          "Destination PAN identifier",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&LrWpanTrafficGenerator::m_panId),
+                          MakeUintegerChecker<uint16_t>())
+            .AddAttribute("Destination",
+                          "Destination short address, by default the PAN coordinator of "
+                          "LrWpanHelper::CreateAssociatedPan",
+                          Mac16AddressValue(Mac16Address("00:01")),
+                          MakeMac16AddressAccessor(&LrWpanTrafficGenerator::m_destination),
+                          MakeMac16AddressChecker())
+            .AddAttribute("AckRequested",
+                          "Request an acknowledgment for every packet",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&LrWpanTrafficGenerator::m_ack),
+                          MakeBooleanChecker())
+            .AddTraceSource("Tx",
+                            "A packet is handed to McpsDataRequest, with its TP",
+                            MakeTraceSourceAccessor(&LrWpanTrafficGenerator::m_txTrace),
+                            "ns3::lrwpan::LrWpanTrafficGenerator::TxTracedCallback");
+    return tid;
+}
+
+LrWpanTrafficGenerator::LrWpanTrafficGenerator()
+    : m_stop(Time::Max()),
+      m_started(false),
+      m_packets(0),
+      m_msduHandle(0)
+{
+}
+
+LrWpanTrafficGenerator::~LrWpanTrafficGenerator()
+{
+}
+
+void
+LrWpanTrafficGenerator::DoDispose()
+{
+    m_event.Cancel();
+    m_flows.clear();
+    m_calendar = decltype(m_calendar)();
+    Object::DoDispose();
+}
+
+void
+LrWpanTrafficGenerator::SetSource(uint8_t tp, ObjectFactory factory)
+{
+    m_tps[tp].source = factory;
+}
+
+void
+LrWpanTrafficGenerator::SetPacketSize(uint8_t tp, uint32_t size)
+{
+    m_tps[tp].size = size;
+}
+
+void
+LrWpanTrafficGenerator::SetDeadline(uint8_t tp, Time deadline)
+{
+    m_tps[tp].deadline = deadline;
+}
+
+void
+LrWpanTrafficGenerator::Install(Ptr<LrWpanNetDevice> device)
+{
+    uint8_t tp = device->GetMac()->GetPriority();
+    auto it = m_tps.find(tp);
+    NS_ABORT_MSG_IF(it == m_tps.end() || it->second.source.GetTypeId() == TypeId(),
+                    "No traffic source for TP " << +tp);
+    Install(device, it->second.source.Create<LrWpanTrafficSource>());
+}
+
+void
+LrWpanTrafficGenerator::Install(Ptr<LrWpanNetDevice> device, Ptr<LrWpanTrafficSource> source)
+{
+    NS_LOG_FUNCTION(this << device << source);
+    m_flows.push_back({device, source, device->GetMac()->GetPriority()});
+    if (m_started)
+    {
+        Push(m_flows.size() - 1, source->GetNextArrival(Simulator::Now()));
+        Reschedule();
+    }
+}
+
+void
+LrWpanTrafficGenerator::InstallTrace(NetDeviceContainer devices, std::string filename)
+{
+    std::ifstream file(filename);
+    NS_ABORT_MSG_IF(!file, "Cannot open traffic trace " << filename);
+
+    std::map<uint32_t, Ptr<LrWpanTraceTrafficSource>> sources;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream iss(line);
+        double at;
+        uint32_t index;
+        uint32_t size = 0;
+        if (!(iss >> at >> index))
+        {
+            continue;
+        }
+        iss >> size;
+        NS_ABORT_MSG_IF(index >= devices.GetN(),
+                        "Device " << index << " of " << filename << " is not installed");
+        Ptr<LrWpanTraceTrafficSource>& source = sources[index];
+        if (!source)
+        {
+            source = CreateObject<LrWpanTraceTrafficSource>();
+        }
+        source->AddArrival(Seconds(at), size);
+    }
+
+    for (const auto& [index, source] : sources)
+    {
+        Install(DynamicCast<LrWpanNetDevice>(devices.Get(index)), source);
+    }
+}
+
+void
+LrWpanTrafficGenerator::Start(Time at)
+{
+    Simulator::Schedule(at - Simulator::Now(), &LrWpanTrafficGenerator::DoStart, this);
+}
+
+void
+LrWpanTrafficGenerator::Stop(Time at)
+{
+    m_stop = at;
+    // drop the arrivals already queued from the stop time on
+    std::vector<Arrival> arrivals;
+    while (!m_calendar.empty())
+    {
+        if (m_calendar.top().first < m_stop)
+        {
+            arrivals.push_back(m_calendar.top());
+        }
+        m_calendar.pop();
+    }
+    m_calendar = decltype(m_calendar)(std::greater<Arrival>(), std::move(arrivals));
+    Reschedule();
+}
+
+void
+LrWpanTrafficGenerator::DoStart()
+{
+    NS_LOG_FUNCTION(this);
+    m_started = true;
+    Time now = Simulator::Now();
+    for (uint32_t i = 0; i < m_flows.size(); i++)
+    {
+        Push(i, m_flows[i].source->GetNextArrival(now));
+    }
+    Reschedule();
+}
+
+void
+LrWpanTrafficGenerator::Push(uint32_t flow, Time at)
+{
+    if (at < m_stop)
+    {
+        m_calendar.emplace(at, flow);
+    }
+}
+
+void
+LrWpanTrafficGenerator::Reschedule()
+{
+    m_event.Cancel();
+    if (!m_calendar.empty())
+    {
+        m_event = Simulator::Schedule(m_calendar.top().first - Simulator::Now(),
+                                      &LrWpanTrafficGenerator::Fire,
+                                      this);
+    }
+}
+
+void
+LrWpanTrafficGenerator::Fire()
+{
+    Time now = Simulator::Now();
+    while (!m_calendar.empty() && m_calendar.top().first <= now)
+    {
+        uint32_t flow = m_calendar.top().second;
+        m_calendar.pop();
+        Send(m_flows[flow]);
+        Push(flow, m_flows[flow].source->GetNextArrival(now));
+    }
+    Reschedule();
+}
+
+void
+LrWpanTrafficGenerator::Send(Flow& flow)
+{
+    const TpConfig& tp = m_tps[flow.tp];
+    uint32_t size = flow.source->GetPacketSize();
+    if (size == 0)
+    {
+        size = tp.size ? tp.size : m_packetSize;
+    }
+    Ptr<Packet> p = Create<Packet>(size);
+
+    LrWpanDelayTag delayTag;
+    delayTag.Set(Simulator::Now().GetMilliSeconds());
+    p->AddPacketTag(delayTag);
+
+    LrWpanPriorityTag priorityTag;
+    priorityTag.Set(flow.tp);
+    p->AddPacketTag(priorityTag);
+
+    if (tp.deadline.IsStrictlyPositive())
+    {
+        LrWpanDeadlineTag deadlineTag;
+        deadlineTag.Set((Simulator::Now() + tp.deadline).GetMilliSeconds());
+        p->AddPacketTag(deadlineTag);
+    }
+
+    McpsDataRequestParams params;
+    params.m_dstPanId = m_panId;
+    params.m_srcAddrMode = SHORT_ADDR;
+    params.m_dstAddrMode = SHORT_ADDR;
+    params.m_dstAddr = m_destination;
+    params.m_msduHandle = ++m_msduHandle;
+    params.m_txOptions = m_ack ? TX_OPTION_ACK : TX_OPTION_NONE;
+
+    m_txTrace(p, flow.tp);
+    m_packets++;
+    flow.device->GetMac()->McpsDataRequest(params, p);
+}
+
+uint64_t
+LrWpanTrafficGenerator::GetPacketCount() const
+{
+    return m_packets;
+}
+
+int64_t
+LrWpanTrafficGenerator::AssignStreams(int64_t stream)
+{
+    int64_t used = 0;
+    for (auto& flow : m_flows)
+    {
+        used += flow.source->AssignStreams(stream + used);
+    }
+    return used;
+}
+
+} // namespace lrwpan
+} // namespace ns3
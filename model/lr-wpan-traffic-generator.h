@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#ifndef LR_WPAN_TRAFFIC_GENERATOR_H
+#define LR_WPAN_TRAFFIC_GENERATOR_H
+
+#include "lr-wpan-net-device.h"
+
+#include <ns3/event-id.h>
+#include <ns3/mac16-address.h>
+#include <ns3/net-device-container.h>
+#include <ns3/nstime.h>
+#include <ns3/object-factory.h>
+#include <ns3/object.h>
+#include <ns3/traced-callback.h>
+
+#include <map>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+class ExponentialRandomVariable;
+class UniformRandomVariable;
+
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * The arrival process of one device of a LrWpanTrafficGenerator.
+ */
+class LrWpanTrafficSource : public Object
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    ~LrWpanTrafficSource() override;
+
+    /**
+     * \param now the time of the current arrival, or the start time on the first call
+     * \return the time of the next arrival, not before now, or Time::Max() if the
+     *         source is exhausted
+     */
+    virtual Time GetNextArrival(Time now) = 0;
+
+    /**
+     * \return the size of the packet of the arrival returned by the last
+     *         GetNextArrival(), or 0 for the size of the TP
+     */
+    virtual uint32_t GetPacketSize();
+
+    /**
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned
+     */
+    virtual int64_t AssignStreams(int64_t stream);
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Poisson arrivals.
+ */
+class LrWpanPoissonTrafficSource : public LrWpanTrafficSource
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanPoissonTrafficSource();
+
+    Time GetNextArrival(Time now) override;
+    int64_t AssignStreams(int64_t stream) override;
+
+  private:
+    double m_rate;                                //!< Arrivals per second
+    Ptr<ExponentialRandomVariable> m_interval;    //!< Inter-arrival time (s)
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Periodic arrivals, each delayed by a uniform jitter from its period
+ * boundary; the jitter does not accumulate.
+ */
+class LrWpanPeriodicTrafficSource : public LrWpanTrafficSource
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanPeriodicTrafficSource();
+
+    Time GetNextArrival(Time now) override;
+    int64_t AssignStreams(int64_t stream) override;
+
+  private:
+    Time m_period;                        //!< Period
+    Time m_jitter;                        //!< Maximum jitter
+    bool m_randomPhase;                   //!< Start at a random phase of the period
+    bool m_started;                       //!< The first arrival was drawn
+    Time m_boundary;                      //!< Start of the period of the last arrival
+    Ptr<UniformRandomVariable> m_uniform; //!< Phase and jitter
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Markov on/off source: exponentially distributed on and off periods,
+ * Poisson arrivals during the on periods.
+ */
+class LrWpanOnOffTrafficSource : public LrWpanTrafficSource
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanOnOffTrafficSource();
+
+    Time GetNextArrival(Time now) override;
+    int64_t AssignStreams(int64_t stream) override;
+
+  private:
+    double m_rate;                              //!< Arrivals per second in the on state
+    Time m_meanOn;                              //!< Mean on period
+    Time m_meanOff;                             //!< Mean off period
+    bool m_started;                             //!< The first on period was drawn
+    Time m_onEnd;                               //!< End of the current on period
+    Ptr<ExponentialRandomVariable> m_exp;       //!< Arrivals and state durations
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Replays a list of arrivals.
+ */
+class LrWpanTraceTrafficSource : public LrWpanTrafficSource
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanTraceTrafficSource();
+
+    /**
+     * \param at the arrival time, from the start of the generator
+     * \param size the packet size, 0 for the size of the TP
+     */
+    void AddArrival(Time at, uint32_t size);
+
+    Time GetNextArrival(Time now) override;
+    uint32_t GetPacketSize() override;
+
+  private:
+    std::vector<std::pair<Time, uint32_t>> m_arrivals; //!< Arrivals, sorted on the first call
+    uint32_t m_next;                                   //!< Next arrival
+    Time m_start;                                      //!< Start of the replay
+    uint32_t m_size;                                   //!< Size of the last arrival
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Data traffic of many LR-WPAN devices, sent with McpsDataRequest.
+ *
+ * Every device has a LrWpanTrafficSource, created from the factory of its TP
+ * (the MAC priority) unless given explicitly. The packets get the size and
+ * the deadline of the TP and are stamped with a LrWpanDelayTag, a
+ * LrWpanPriorityTag and, when the TP has a deadline, a LrWpanDeadlineTag.
+ *
+ * The next arrival of every device is kept in a single calendar (a binary
+ * heap), and only its earliest entry is scheduled in the simulator: all the
+ * arrivals that fall on the same time are sent by one event. The simulator
+ * thus holds one event per generator whatever the number of devices, and
+ * synchronized sources (e.g. periodic without jitter) cost one event per
+ * period.
+ */
+class LrWpanTrafficGenerator : public Object
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LrWpanTrafficGenerator();
+    ~LrWpanTrafficGenerator() override;
+
+    /**
+     * \param tp the TP
+     * \param factory the factory of the sources of the devices of the TP
+     */
+    void SetSource(uint8_t tp, ObjectFactory factory);
+
+    /**
+     * \param tp the TP
+     * \param name the source TypeId name
+     * \param args name and AttributeValue pairs to set
+     */
+    template <typename... Ts>
+    void SetSource(uint8_t tp, std::string name, Ts&&... args);
+
+    /**
+     * \param tp the TP
+     * \param size the packet size of the TP, overriding the PacketSize attribute
+     */
+    void SetPacketSize(uint8_t tp, uint32_t size);
+
+    /**
+     * \param tp the TP
+     * \param deadline the relative deadline of the packets of the TP
+     */
+    void SetDeadline(uint8_t tp, Time deadline);
+
+    /**
+     * \brief Generate the traffic of a device with the source of its TP.
+     * \param device the device
+     */
+    void Install(Ptr<LrWpanNetDevice> device);
+
+    /**
+     * \brief Generate the traffic of a device.
+     * \param device the device
+     * \param source its source
+     */
+    void Install(Ptr<LrWpanNetDevice> device, Ptr<LrWpanTrafficSource> source);
+
+    /**
+     * \brief Replay a CSV trace.
+     *
+     * Each line is "time,device,size": the arrival time in seconds from the
+     * start, the index of the device in the container and the packet size in
+     * bytes (0 for the size of the TP). Lines that do not start with a number
+     * (e.g. a header) are ignored.
+     *
+     * \param devices the devices
+     * \param filename the trace file
+     */
+    void InstallTrace(NetDeviceContainer devices, std::string filename);
+
+    /**
+     * \param at the absolute time of the first arrivals
+     */
+    void Start(Time at);
+
+    /**
+     * \param at the absolute time from which no packet is sent
+     */
+    void Stop(Time at);
+
+    /**
+     * \return the number of packets sent
+     */
+    uint64_t GetPacketCount() const;
+
+    /**
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned
+     */
+    int64_t AssignStreams(int64_t stream);
+
+    /**
+     * TracedCallback signature for the packets handed to McpsDataRequest.
+     *
+     * \param [in] packet The packet.
+     * \param [in] tp The TP of the sender.
+     */
+    typedef void (*TxTracedCallback)(Ptr<const Packet> packet, uint8_t tp);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * A device and its source.
+     */
+    struct Flow
+    {
+        Ptr<LrWpanNetDevice> device;      //!< The device
+        Ptr<LrWpanTrafficSource> source; //!< Its arrivals
+        uint8_t tp;                      //!< Its TP
+    };
+
+    /**
+     * The settings of a TP.
+     */
+    struct TpConfig
+    {
+        ObjectFactory source; //!< Source factory
+        uint32_t size = 0;    //!< Packet size, 0: PacketSize attribute
+        Time deadline;        //!< Relative deadline, 0: none
+    };
+
+    /// Calendar entry: arrival time and flow index
+    typedef std::pair<Time, uint32_t> Arrival;
+
+    /// Draw the first arrival of every flow.
+    void DoStart();
+
+    /// Send the arrivals due now and schedule the next one.
+    void Fire();
+
+    /**
+     * \param flow the flow index
+     * \param at the time of its next arrival
+     */
+    void Push(uint32_t flow, Time at);
+
+    /// Schedule the earliest arrival of the calendar.
+    void Reschedule();
+
+    /**
+     * \param flow the flow with an arrival now
+     */
+    void Send(Flow& flow);
+
+    std::vector<Flow> m_flows;                 //!< Flows, by index
+    std::map<uint8_t, TpConfig> m_tps;         //!< TP settings
+    std::priority_queue<Arrival, std::vector<Arrival>, std::greater<Arrival>>
+        m_calendar;                            //!< Next arrival of each flow
+    EventId m_event;                           //!< The earliest arrival
+    Time m_stop;                               //!< End of the traffic
+    bool m_started;                            //!< Start() took effect
+    uint64_t m_packets;                        //!< Packets sent
+    uint8_t m_msduHandle;                      //!< Last MSDU handle
+    uint16_t m_panId;                          //!< Destination PAN
+    Mac16Address m_destination;                //!< Destination address
+    bool m_ack;                                //!< Acknowledged transmissions
+    uint32_t m_packetSize;                     //!< Default packet size
+
+    /**
+     * Packet handed to McpsDataRequest, with its TP.
+     */
+    TracedCallback<Ptr<const Packet>, uint8_t> m_txTrace;
+};
+
+template <typename... Ts>
+void
+LrWpanTrafficGenerator::SetSource(uint8_t tp, std::string name, Ts&&... args)
+{
+    SetSource(tp, ObjectFactory(name, std::forward<Ts>(args)...));
+}
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_TRAFFIC_GENERATOR_H */
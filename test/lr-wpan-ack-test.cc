@@ -14,6 +14,7 @@
 #include <ns3/core-module.h>
 #include <ns3/log.h>
 #include <ns3/lr-wpan-module.h>
+#include <ns3/node.h>
 #include <ns3/packet.h>
 #include <ns3/propagation-delay-model.h>
 #include <ns3/propagation-loss-model.h>
@@ -299,6 +300,139 @@ LrWpanAckTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check that an ACK sent by the PHY alone (AutoAck) is on the air at the
+ *        same time as one sent through the MAC state requests, with fewer events.
+ */
+class LrWpanAutoAckTestCase : public TestCase
+{
+  public:
+    LrWpanAutoAckTestCase();
+    ~LrWpanAutoAckTestCase() override;
+
+  private:
+    /**
+     * What is seen of one acknowledged data frame.
+     */
+    struct AckExchange
+    {
+        Time ackStart;        //!< Start of the ACK transmission
+        Time listening;       //!< Last switch of the receiver to RX_ON
+        Time confirmed;       //!< MCPS-DATA.confirm at the sender
+        MacStatus status;     //!< Status of the MCPS-DATA.confirm
+        uint32_t indications; //!< MCPS-DATA.indications at the receiver
+        uint64_t events;      //!< Executed simulator events
+    };
+
+    /**
+     * \brief Send one data frame with an ACK request between two devices.
+     * \param autoAck the AutoAck attribute of the receiver
+     * \return what is seen of the exchange
+     */
+    static AckExchange Exchange(bool autoAck);
+
+    void DoRun() override;
+};
+
+LrWpanAutoAckTestCase::LrWpanAutoAckTestCase()
+    : TestCase("ACK sent by the PHY without the MAC state requests")
+{
+}
+
+LrWpanAutoAckTestCase::~LrWpanAutoAckTestCase()
+{
+}
+
+LrWpanAutoAckTestCase::AckExchange
+LrWpanAutoAckTestCase::Exchange(bool autoAck)
+{
+    AckExchange exchange{};
+    exchange.status = MacStatus::NO_ACK;
+
+    Ptr<SingleModelSpectrumChannel> channel = CreateObject<SingleModelSpectrumChannel>();
+    Ptr<LrWpanNetDevice> devs[2];
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        Ptr<Node> node = CreateObject<Node>();
+        devs[i] = CreateObject<LrWpanNetDevice>();
+        devs[i]->SetAddress(Mac16Address(i == 0 ? "00:01" : "00:02"));
+        devs[i]->SetChannel(channel);
+        devs[i]->AssignStreams(10 * i);
+        node->AddDevice(devs[i]);
+        Ptr<ConstantPositionMobilityModel> mobility =
+            CreateObject<ConstantPositionMobilityModel>();
+        mobility->SetPosition(Vector(10 * i, 0, 0));
+        devs[i]->GetPhy()->SetMobility(mobility);
+    }
+    devs[1]->GetMac()->SetAttribute("AutoAck", BooleanValue(autoAck));
+
+    devs[0]->GetMac()->SetMcpsDataConfirmCallback(
+        McpsDataConfirmCallback([&exchange](McpsDataConfirmParams params) {
+            exchange.confirmed = Simulator::Now();
+            exchange.status = params.m_status;
+        }));
+    devs[1]->GetMac()->SetMcpsDataIndicationCallback(
+        McpsDataIndicationCallback([&exchange](McpsDataIndicationParams, Ptr<Packet>) {
+            exchange.indications++;
+        }));
+    devs[1]->GetPhy()->TraceConnectWithoutContext(
+        "PhyTxBegin",
+        Callback<void, Ptr<const Packet>>(
+            [&exchange](Ptr<const Packet>) { exchange.ackStart = Simulator::Now(); }));
+    devs[1]->GetPhy()->TraceConnectWithoutContext(
+        "TrxStateValue",
+        Callback<void, PhyEnumeration, PhyEnumeration>(
+            [&exchange](PhyEnumeration, PhyEnumeration newState) {
+                if (newState == IEEE_802_15_4_PHY_RX_ON)
+                {
+                    exchange.listening = Simulator::Now();
+                }
+            }));
+
+    McpsDataRequestParams params;
+    params.m_srcAddrMode = SHORT_ADDR;
+    params.m_dstAddrMode = SHORT_ADDR;
+    params.m_dstAddr = devs[1]->GetMac()->GetShortAddress();
+    params.m_dstPanId = 0;
+    params.m_msduHandle = 0;
+    params.m_txOptions = TX_OPTION_ACK;
+    Simulator::Schedule(Seconds(1),
+                        &LrWpanMac::McpsDataRequest,
+                        devs[0]->GetMac(),
+                        params,
+                        Create<Packet>(50));
+    Simulator::Run();
+    exchange.events = Simulator::GetEventCount();
+    Simulator::Destroy();
+    return exchange;
+}
+
+void
+LrWpanAutoAckTestCase::DoRun()
+{
+    // Same streams in both runs: the sender backs off the same way.
+    AckExchange reference = Exchange(false);
+    AckExchange autoAck = Exchange(true);
+
+    NS_TEST_ASSERT_MSG_EQ(reference.status, MacStatus::SUCCESS, "The frame must be acknowledged");
+    NS_TEST_ASSERT_MSG_EQ(autoAck.status, MacStatus::SUCCESS, "The auto ACK must be received");
+    NS_TEST_ASSERT_MSG_EQ(autoAck.indications, 1U, "The frame must be indicated once");
+    NS_TEST_ASSERT_MSG_GT(autoAck.ackStart, Seconds(1), "The receiver must send the ACK");
+    NS_TEST_ASSERT_MSG_EQ(autoAck.ackStart,
+                          reference.ackStart,
+                          "The auto ACK must start aTurnaroundTime after the frame");
+    NS_TEST_ASSERT_MSG_EQ(autoAck.confirmed,
+                          reference.confirmed,
+                          "The sender must see the auto ACK at the same time");
+    NS_TEST_ASSERT_MSG_EQ(autoAck.listening,
+                          reference.listening,
+                          "The receiver must listen again at the same time");
+    NS_TEST_ASSERT_MSG_LT(autoAck.events, reference.events, "The auto ACK must save events");
+}
+
 /**
  * \ingroup lr-wpan-test
  * \ingroup tests
@@ -325,6 +459,7 @@ LrWpanAckTestSuite::LrWpanAckTestSuite()
     AddTestCase(
         new LrWpanAckTestCase("extended-unicast", LrWpanAckTestCase::EXTENDED_ADDRESS_UNICAST),
         TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanAutoAckTestCase, TestCase::Duration::QUICK);
 }
 
 static LrWpanAckTestSuite g_lrWpanAckTestSuite; //!< Static variable for test initialization
@@ -6,6 +6,7 @@
  * Author: Tommaso Pecorella <tommaso.pecorella@unifi.it>
  */
 
+#include <ns3/boolean.h>
 #include <ns3/log.h>
 #include <ns3/lr-wpan-module.h>
 #include <ns3/mac16-address.h>
@@ -16,6 +17,8 @@
 #include <ns3/spectrum-module.h>
 #include <ns3/test.h>
 
+#include <vector>
+
 using namespace ns3;
 using namespace ns3::lrwpan;
 
@@ -205,6 +208,186 @@ LrWpanCollisionTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan Capture Test: a receiver with the capture model enabled
+ *        re-synchronizes on a much stronger late frame, keeps a much stronger
+ *        first frame, and loses both frames when neither dominates.
+ */
+class LrWpanCaptureTestCase : public TestCase
+{
+  public:
+    LrWpanCaptureTestCase();
+    ~LrWpanCaptureTestCase() override;
+
+  private:
+    /**
+     * \brief Function called when DataIndication is hit.
+     * \param params The MCPS params.
+     * \param p The packet.
+     */
+    void DataIndication(McpsDataIndicationParams params, Ptr<Packet> p);
+
+    /**
+     * \brief Function called when PhyRxCapture is hit.
+     * \param current The frame being received.
+     * \param late The late frame.
+     * \param outcome The capture outcome.
+     */
+    void RxCapture(Ptr<const Packet> current, Ptr<const Packet> late, PhyCaptureOutcome outcome);
+
+    void DoRun() override;
+
+    std::vector<uint32_t> m_rxSizes;            //!< MSDU sizes of the received packets.
+    std::vector<PhyCaptureOutcome> m_outcomes; //!< Capture outcomes.
+};
+
+LrWpanCaptureTestCase::LrWpanCaptureTestCase()
+    : TestCase("Test the 802.15.4 capture model")
+{
+}
+
+LrWpanCaptureTestCase::~LrWpanCaptureTestCase()
+{
+}
+
+void
+LrWpanCaptureTestCase::DataIndication(McpsDataIndicationParams params, Ptr<Packet> p)
+{
+    m_rxSizes.push_back(p->GetSize());
+}
+
+void
+LrWpanCaptureTestCase::RxCapture(Ptr<const Packet> current,
+                                 Ptr<const Packet> late,
+                                 PhyCaptureOutcome outcome)
+{
+    m_outcomes.push_back(outcome);
+}
+
+void
+LrWpanCaptureTestCase::DoRun()
+{
+    // dev1 (1 m) and dev2 (30 m) send to dev0, the second one 100 us after
+    // the first; both CCAs end before either transmission starts.
+    Ptr<Node> n0 = CreateObject<Node>();
+    Ptr<Node> n1 = CreateObject<Node>();
+    Ptr<Node> n2 = CreateObject<Node>();
+
+    Ptr<LrWpanNetDevice> dev0 = CreateObject<LrWpanNetDevice>();
+    Ptr<LrWpanNetDevice> dev1 = CreateObject<LrWpanNetDevice>();
+    Ptr<LrWpanNetDevice> dev2 = CreateObject<LrWpanNetDevice>();
+
+    dev0->SetAddress(Mac16Address("00:01"));
+    dev1->SetAddress(Mac16Address("00:02"));
+    dev2->SetAddress(Mac16Address("00:03"));
+
+    Ptr<SingleModelSpectrumChannel> channel = CreateObject<SingleModelSpectrumChannel>();
+    Ptr<LogDistancePropagationLossModel> propModel =
+        CreateObject<LogDistancePropagationLossModel>();
+    channel->AddPropagationLossModel(propModel);
+    channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+
+    dev0->SetChannel(channel);
+    dev1->SetChannel(channel);
+    dev2->SetChannel(channel);
+    n0->AddDevice(dev0);
+    n1->AddDevice(dev1);
+    n2->AddDevice(dev2);
+
+    Ptr<ConstantPositionMobilityModel> mobility0 = CreateObject<ConstantPositionMobilityModel>();
+    mobility0->SetPosition(Vector(0, 0, 0));
+    dev0->GetPhy()->SetMobility(mobility0);
+    Ptr<ConstantPositionMobilityModel> mobility1 = CreateObject<ConstantPositionMobilityModel>();
+    mobility1->SetPosition(Vector(0, 1, 0));
+    dev1->GetPhy()->SetMobility(mobility1);
+    Ptr<ConstantPositionMobilityModel> mobility2 = CreateObject<ConstantPositionMobilityModel>();
+    mobility2->SetPosition(Vector(30, 0, 0));
+    dev2->GetPhy()->SetMobility(mobility2);
+
+    dev0->GetPhy()->SetAttribute("CaptureEnabled", BooleanValue(true));
+    dev0->GetMac()->SetMcpsDataIndicationCallback(
+        MakeCallback(&LrWpanCaptureTestCase::DataIndication, this));
+    dev0->GetPhy()->TraceConnectWithoutContext(
+        "PhyRxCapture",
+        MakeCallback(&LrWpanCaptureTestCase::RxCapture, this));
+
+    // Disable first backoff
+    for (auto dev : {dev0, dev1, dev2})
+    {
+        DynamicCast<LrWpanCsmaCa>(dev->GetCsmaCa())->SetMacMinBE(0);
+    }
+
+    McpsDataRequestParams params;
+    params.m_srcAddrMode = SHORT_ADDR;
+    params.m_dstAddrMode = SHORT_ADDR;
+    params.m_dstPanId = 0;
+    params.m_msduHandle = 0;
+    params.m_dstAddr = Mac16Address("00:01");
+
+    // First case: the strong frame arrives during the weak one
+    Simulator::Schedule(Seconds(0.01),
+                        &LrWpanMac::McpsDataRequest,
+                        dev2->GetMac(),
+                        params,
+                        Create<Packet>(100));
+    Simulator::Schedule(Seconds(0.0101),
+                        &LrWpanMac::McpsDataRequest,
+                        dev1->GetMac(),
+                        params,
+                        Create<Packet>(20));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_outcomes.size(), 1U, "One overlap");
+    NS_TEST_EXPECT_MSG_EQ(m_outcomes[0], PHY_CAPTURE_RESYNC, "Re-synchronized on the late frame");
+    NS_TEST_ASSERT_MSG_EQ(m_rxSizes.size(), 1U, "One packet received");
+    NS_TEST_EXPECT_MSG_EQ(m_rxSizes[0], 20, "The strong late frame is received");
+
+    // Second case: the weak frame arrives during the strong one
+    m_outcomes.clear();
+    m_rxSizes.clear();
+    Simulator::Schedule(Seconds(0.1),
+                        &LrWpanMac::McpsDataRequest,
+                        dev1->GetMac(),
+                        params,
+                        Create<Packet>(60));
+    Simulator::Schedule(Seconds(0.1001),
+                        &LrWpanMac::McpsDataRequest,
+                        dev2->GetMac(),
+                        params,
+                        Create<Packet>(20));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_outcomes.size(), 1U, "One overlap");
+    NS_TEST_EXPECT_MSG_EQ(m_outcomes[0], PHY_CAPTURE_FIRST, "The first frame is captured");
+    NS_TEST_ASSERT_MSG_EQ(m_rxSizes.size(), 1U, "One packet received");
+    NS_TEST_EXPECT_MSG_EQ(m_rxSizes[0], 60, "The strong first frame is received");
+
+    // Third case: two frames of the same power
+    m_outcomes.clear();
+    m_rxSizes.clear();
+    mobility2->SetPosition(Vector(0, -1, 0));
+    Simulator::Schedule(Seconds(0.2),
+                        &LrWpanMac::McpsDataRequest,
+                        dev1->GetMac(),
+                        params,
+                        Create<Packet>(60));
+    Simulator::Schedule(Seconds(0.2001),
+                        &LrWpanMac::McpsDataRequest,
+                        dev2->GetMac(),
+                        params,
+                        Create<Packet>(20));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_outcomes.size(), 1U, "One overlap");
+    NS_TEST_EXPECT_MSG_EQ(m_outcomes[0], PHY_CAPTURE_NONE, "Neither frame is captured");
+    NS_TEST_EXPECT_MSG_EQ(m_rxSizes.size(), 0U, "Both frames are lost");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup lr-wpan-test
  * \ingroup tests
@@ -221,6 +404,7 @@ LrWpanCollisionTestSuite::LrWpanCollisionTestSuite()
     : TestSuite("lr-wpan-collision", Type::UNIT)
 {
     AddTestCase(new LrWpanCollisionTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanCaptureTestCase, TestCase::Duration::QUICK);
 }
 
 static LrWpanCollisionTestSuite
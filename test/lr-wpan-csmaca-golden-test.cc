@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/core-module.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-csmaca-gnu-noba.h>
+#include <ns3/lr-wpan-csmaca-noba.h>
+#include <ns3/lr-wpan-csmaca-standard.h>
+#include <ns3/lr-wpan-csmaca-sw-noba.h>
+#include <ns3/lr-wpan-delay-tag.h>
+#include <ns3/lr-wpan-helper.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/lr-wpan-priority-tag.h>
+#include <ns3/lr-wpan-superframe-monitor.h>
+#include <ns3/node-container.h>
+#include <ns3/packet.h>
+#include <ns3/test.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-csmaca-golden-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Pin the per-TP counters of a CSMA/CA variant on a fixed-seed star PAN.
+ *
+ * 16 devices, two per TP, send Poisson traffic to the coordinator of a
+ * beacon-enabled PAN (BO = SO = 3) for 3 seconds. The enqueued, acknowledged,
+ * collided (busy CCA), deferred and (m,k)-violating transmissions of each TP,
+ * and the frames received by the coordinator and the sum of their delays, must
+ * match the golden file of the variant, lr-wpan-csmaca-golden-<variant>.txt in
+ * the test directory.
+ *
+ * The golden files are regenerated by running the suite with --update-data:
+ *
+ *   ./test.py --update-data -s lr-wpan-csmaca-golden
+ *
+ * The suite is only built once the five files exist; configure with
+ * -DLRWPAN_RECORD_GOLDEN=ON to build it and record them the first time.
+ *
+ * A behavioral change of a variant must come with its regenerated golden file;
+ * a performance change must leave it untouched.
+ */
+class LrWpanCsmaCaGoldenTestCase : public TestCase
+{
+  public:
+    /**
+     * \param variant the variant name, used in the golden file name
+     * \param option the MAC CSMA/CA option of the variant
+     */
+    LrWpanCsmaCaGoldenTestCase(std::string variant, CsmaOption option);
+    ~LrWpanCsmaCaGoldenTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \param tp the TP of the device
+     * \return the CSMA/CA engine of the variant
+     */
+    Ptr<LrWpanCsmaCaCommon> CreateCsmaCa(uint8_t tp) const;
+
+    /**
+     * \param record a finished superframe, or the last one when flushed
+     */
+    void Superframe(const LrWpanSuperframeRecord& record);
+
+    /**
+     * Frame received by the coordinator.
+     * \param p the packet
+     * \param tp the TP of the receiver (unused)
+     */
+    void Received(Ptr<const Packet> p, uint8_t tp);
+
+    std::string m_variant; //!< Variant name
+    CsmaOption m_option;   //!< MAC CSMA/CA option
+
+    uint64_t m_enqueued[TP_COUNT];     //!< Packets enqueued
+    uint64_t m_success[TP_COUNT];      //!< Packets acknowledged
+    uint64_t m_collisions[TP_COUNT];   //!< Busy CCAs
+    uint64_t m_deferrals[TP_COUNT];    //!< Transmissions deferred to the next CAP
+    uint64_t m_mkViolations[TP_COUNT]; //!< (m,k)-firm violations
+    uint64_t m_received[TP_COUNT];     //!< Frames received by the coordinator
+    int64_t m_delaySum[TP_COUNT];      //!< Sum of their delays (ms)
+};
+
+LrWpanCsmaCaGoldenTestCase::LrWpanCsmaCaGoldenTestCase(std::string variant, CsmaOption option)
+    : TestCase("Golden counters of the " + variant + " CSMA/CA"),
+      m_variant(variant),
+      m_option(option)
+{
+    SetDataDir(NS_TEST_SOURCEDIR);
+}
+
+LrWpanCsmaCaGoldenTestCase::~LrWpanCsmaCaGoldenTestCase()
+{
+}
+
+Ptr<LrWpanCsmaCaCommon>
+LrWpanCsmaCaGoldenTestCase::CreateCsmaCa(uint8_t tp) const
+{
+    switch (m_option)
+    {
+    case CSMA_ORIGINAL:
+        return CreateObject<LrWpanCsmaCa>(tp);
+    case CSMA_NOBA:
+        return CreateObject<LrWpanCsmaCaNoba>(tp);
+    case CSMA_SW_NOBA:
+        return CreateObject<LrWpanCsmaCaSwNoba>(tp);
+    case CSMA_STANDARD:
+        return CreateObject<LrWpanCsmaCaStandard>(tp);
+    case CSMA_GNU_NOBA:
+        return CreateObject<LrWpanCsmaCaGnuNoba>(tp);
+    }
+    return nullptr;
+}
+
+void
+LrWpanCsmaCaGoldenTestCase::Superframe(const LrWpanSuperframeRecord& record)
+{
+    for (uint32_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        m_enqueued[tp] += record.enqueued[tp];
+        m_success[tp] += record.success[tp];
+        m_collisions[tp] += record.collisions[tp];
+        m_deferrals[tp] += record.deferrals[tp];
+        m_mkViolations[tp] += record.mkViolations[tp];
+    }
+}
+
+void
+LrWpanCsmaCaGoldenTestCase::Received(Ptr<const Packet> p, uint8_t tp)
+{
+    LrWpanDelayTag delayTag;
+    LrWpanPriorityTag priorityTag;
+    if (p->PeekPacketTag(delayTag) && p->PeekPacketTag(priorityTag))
+    {
+        m_received[priorityTag.Get()]++;
+        m_delaySum[priorityTag.Get()] +=
+            Simulator::Now().GetMilliSeconds() - static_cast<int64_t>(delayTag.Get());
+    }
+}
+
+void
+LrWpanCsmaCaGoldenTestCase::DoRun()
+{
+    for (uint32_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        m_enqueued[tp] = 0;
+        m_success[tp] = 0;
+        m_collisions[tp] = 0;
+        m_deferrals[tp] = 0;
+        m_mkViolations[tp] = 0;
+        m_received[tp] = 0;
+        m_delaySum[tp] = 0;
+    }
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    // The variants keep their windows in process-wide tables.
+    LrWpanCsmaCaNoba::InitializeGlobals(true);
+    LrWpanCsmaCaSwNoba::InitializeGlobals(true);
+    LrWpanCsmaCaGnuNoba::InitializeAggregations();
+
+    LrWpanSuperframeMonitor monitor;
+    {
+        NodeContainer nodes;
+        nodes.Create(17); // first one is coordinator
+
+        LrWpanHelper helper;
+        NetDeviceContainer devices = helper.Install(nodes);
+        helper.CreateAssociatedPan(devices, 5);
+
+        NetDeviceContainer endDevices;
+        for (uint32_t i = 0; i < devices.GetN(); i++)
+        {
+            Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice>(devices.Get(i));
+            if (i == 0) // coordinator
+            {
+                dev->GetMac()->setPriority(7);
+                dev->SetCsmaCa(CreateObject<LrWpanCsmaCa>(7));
+                dev->GetMac()->TraceConnectWithoutContext(
+                    "MacRx",
+                    MakeCallback(&LrWpanCsmaCaGoldenTestCase::Received, this));
+
+                MlmeStartRequestParams params;
+                params.m_panCoor = true;
+                params.m_PanId = 5;
+                params.m_bcnOrd = 3;
+                params.m_sfrmOrd = 3;
+                Simulator::ScheduleWithContext(1,
+                                               Seconds(0.01),
+                                               &LrWpanMacBase::MlmeStartRequest,
+                                               dev->GetMac(),
+                                               params);
+            }
+            else
+            {
+                uint8_t tp = (i - 1) % TP_COUNT;
+                dev->GetMac()->setPriority(tp);
+                dev->GetMac()->SetCsmaCaOption(m_option);
+                dev->SetCsmaCa(CreateCsmaCa(tp));
+                endDevices.Add(dev);
+            }
+        }
+        helper.AssignStreams(devices, 0);
+
+        monitor.AddSink(Create<LrWpanSuperframeCallbackSink>(
+            MakeCallback(&LrWpanCsmaCaGoldenTestCase::Superframe, this)));
+        monitor.Install(DynamicCast<LrWpanNetDevice>(devices.Get(0)), devices);
+
+        Ptr<LrWpanTrafficGenerator> traffic = CreateObject<LrWpanTrafficGenerator>();
+        for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            traffic->SetSource(tp,
+                               "ns3::lrwpan::LrWpanPoissonTrafficSource",
+                               "Rate",
+                               DoubleValue(5));
+        }
+        helper.InstallTraffic(endDevices, traffic);
+        traffic->AssignStreams(1000);
+        traffic->Start(Seconds(0.1));
+        traffic->Stop(Seconds(3));
+
+        Simulator::Stop(Seconds(3));
+        Simulator::Run();
+        // count the traffic of the last, unfinished superframe too
+        monitor.Flush();
+    }
+    Simulator::Destroy();
+
+    std::ostringstream counters;
+    for (uint32_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        counters << "tp" << tp << " enqueued " << m_enqueued[tp] << "\n"
+                 << "tp" << tp << " success " << m_success[tp] << "\n"
+                 << "tp" << tp << " collisions " << m_collisions[tp] << "\n"
+                 << "tp" << tp << " deferrals " << m_deferrals[tp] << "\n"
+                 << "tp" << tp << " mkViolations " << m_mkViolations[tp] << "\n"
+                 << "tp" << tp << " received " << m_received[tp] << "\n"
+                 << "tp" << tp << " delaySum " << m_delaySum[tp] << "\n";
+    }
+
+    // With --update-data, the temporary file is the golden file itself.
+    std::string filename = "lr-wpan-csmaca-golden-" + m_variant + ".txt";
+    {
+        std::ofstream out(CreateTempDirFilename(filename));
+        out << counters.str();
+    }
+
+    std::ifstream golden(CreateDataDirFilename(filename));
+    NS_TEST_ASSERT_MSG_EQ(golden.is_open(),
+                          true,
+                          "No golden file " << filename
+                                            << "; record it with test.py --update-data");
+    std::istringstream actual(counters.str());
+    std::string expectedLine;
+    std::string actualLine;
+    while (std::getline(golden, expectedLine))
+    {
+        std::getline(actual, actualLine);
+        NS_TEST_EXPECT_MSG_EQ(actualLine, expectedLine, m_variant << " counter changed");
+    }
+    NS_TEST_EXPECT_MSG_EQ(std::getline(actual, actualLine).fail(),
+                          true,
+                          m_variant << " counter missing from the golden file");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan CSMA/CA golden counters TestSuite
+ */
+class LrWpanCsmaCaGoldenTestSuite : public TestSuite
+{
+  public:
+    LrWpanCsmaCaGoldenTestSuite();
+};
+
+LrWpanCsmaCaGoldenTestSuite::LrWpanCsmaCaGoldenTestSuite()
+    : TestSuite("lr-wpan-csmaca-golden", Type::UNIT)
+{
+    AddTestCase(new LrWpanCsmaCaGoldenTestCase("beb", CSMA_ORIGINAL), TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanCsmaCaGoldenTestCase("noba", CSMA_NOBA), TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanCsmaCaGoldenTestCase("swnoba", CSMA_SW_NOBA), TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanCsmaCaGoldenTestCase("standard", CSMA_STANDARD),
+                TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanCsmaCaGoldenTestCase("gnunoba", CSMA_GNU_NOBA),
+                TestCase::Duration::QUICK);
+}
+
+static LrWpanCsmaCaGoldenTestSuite
+    g_lrWpanCsmaCaGoldenTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/log.h>
+#include <ns3/lr-wpan-csmaca-model.h>
+#include <ns3/test.h>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-csmaca-model-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check the trends of the analytical CSMA/CA model.
+ *
+ * The model is not compared to exact values, only to what any sane estimate
+ * must show: a lone device always succeeds, contention lowers the success
+ * probability, a smaller window gives a smaller delay, freezing the countdown
+ * beats restarting it, and an overloaded channel fails most accesses.
+ */
+class LrWpanCsmaCaModelTestCase : public TestCase
+{
+  public:
+    LrWpanCsmaCaModelTestCase();
+    ~LrWpanCsmaCaModelTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanCsmaCaModelTestCase::LrWpanCsmaCaModelTestCase()
+    : TestCase("Test the trends of the analytical CSMA/CA model")
+{
+}
+
+LrWpanCsmaCaModelTestCase::~LrWpanCsmaCaModelTestCase()
+{
+}
+
+void
+LrWpanCsmaCaModelTestCase::DoRun()
+{
+    // A lone device on a light load
+    {
+        LrWpanCsmaCaModel model;
+        model.SetSuperframe(6, 6);
+        model.SetTraffic(0, 1, 1);
+        auto estimates = model.Estimate();
+        NS_TEST_ASSERT_MSG_EQ_TOL(estimates[0].success, 1, 1e-3, "A lone device must succeed");
+        NS_TEST_ASSERT_MSG_EQ_TOL(estimates[0].throughput, 1, 1e-3, "Wrong throughput");
+        NS_TEST_ASSERT_MSG_EQ(estimates[0].saturated, false, "A light load must not saturate");
+        NS_TEST_ASSERT_MSG_EQ(estimates[1].nodes, 0, "TP 1 has no devices");
+    }
+
+    // Contention
+    double lastSuccess = 1.1;
+    double lastBusy = -1;
+    for (uint32_t nodes : {1, 5, 20, 40})
+    {
+        LrWpanCsmaCaModel model;
+        model.SetSuperframe(6, 6);
+        model.SetTraffic(0, nodes, 4);
+        auto estimates = model.Estimate();
+        NS_TEST_ASSERT_MSG_LT(estimates[0].success,
+                              lastSuccess,
+                              "The success probability must drop with " << nodes << " devices");
+        NS_TEST_ASSERT_MSG_GT(model.GetBusyProbability(),
+                              lastBusy,
+                              "The busy probability must grow with " << nodes << " devices");
+        NS_TEST_ASSERT_MSG_LT(model.GetIterations(), 101, "The solver must converge");
+        lastSuccess = estimates[0].success;
+        lastBusy = model.GetBusyProbability();
+    }
+
+    // Windows ordered by TP, restarting then freezing the countdown
+    LrWpanCsmaCaModel model;
+    model.SetSuperframe(6, 6);
+    model.SetBackoffMode(LrWpanCsmaCaModel::RESTART_COUNTDOWN);
+    for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        model.SetContentionWindow(tp, 1 + 2 * (TP_COUNT - 1 - tp), 2 + 2 * (TP_COUNT - 1 - tp));
+        model.SetTraffic(tp, 5, 2);
+    }
+    auto restart = model.Estimate();
+    for (uint8_t tp = 1; tp < TP_COUNT; tp++)
+    {
+        NS_TEST_ASSERT_MSG_LT(restart[tp].delay,
+                              restart[tp - 1].delay,
+                              "TP " << +tp << " has a smaller window than TP " << tp - 1);
+    }
+    model.SetBackoffMode(LrWpanCsmaCaModel::FREEZE_COUNTDOWN);
+    auto freeze = model.Estimate();
+    for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+    {
+        NS_TEST_ASSERT_MSG_LT(freeze[tp].delay,
+                              restart[tp].delay,
+                              "Freezing the countdown must be faster for TP " << +tp);
+    }
+
+    // Overload
+    {
+        LrWpanCsmaCaModel model;
+        model.SetSuperframe(6, 6);
+        for (uint8_t tp = 0; tp < TP_COUNT; tp++)
+        {
+            model.SetTraffic(tp, 30, 20);
+        }
+        auto estimates = model.Estimate();
+        NS_TEST_ASSERT_MSG_GT(model.GetBusyProbability(), 0.5, "The channel must be busy");
+        NS_TEST_ASSERT_MSG_LT(estimates[0].success, 0.5, "Most accesses must fail");
+        NS_TEST_ASSERT_MSG_LT(model.GetIterations(), 101, "The solver must converge");
+    }
+
+    // The engines' windows
+    model.Configure(CSMA_ORIGINAL);
+    NS_TEST_ASSERT_MSG_EQ(model.GetContentionWindow(0).first, 0, "Wrong BEB window");
+    NS_TEST_ASSERT_MSG_EQ(model.GetContentionWindow(0).second, 7, "Wrong BEB window");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan CSMA/CA analytical model TestSuite
+ */
+class LrWpanCsmaCaModelTestSuite : public TestSuite
+{
+  public:
+    LrWpanCsmaCaModelTestSuite();
+};
+
+LrWpanCsmaCaModelTestSuite::LrWpanCsmaCaModelTestSuite()
+    : TestSuite("lr-wpan-csmaca-model", Type::UNIT)
+{
+    AddTestCase(new LrWpanCsmaCaModelTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanCsmaCaModelTestSuite
+    g_lrWpanCsmaCaModelTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/basic-energy-source-helper.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/lr-wpan-radio-energy-model-helper.h>
+#include <ns3/node.h>
+#include <ns3/simulator.h>
+#include <ns3/single-model-spectrum-channel.h>
+#include <ns3/test.h>
+
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-energy-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check the energy drawn per transceiver state and the CCA tally of a
+ *        LrWpanRadioEnergyModel installed by its helper.
+ */
+class LrWpanRadioEnergyModelTestCase : public TestCase
+{
+  public:
+    LrWpanRadioEnergyModelTestCase();
+    ~LrWpanRadioEnergyModelTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanRadioEnergyModelTestCase::LrWpanRadioEnergyModelTestCase()
+    : TestCase("Radio energy of a LR-WPAN device per transceiver state")
+{
+}
+
+LrWpanRadioEnergyModelTestCase::~LrWpanRadioEnergyModelTestCase()
+{
+}
+
+void
+LrWpanRadioEnergyModelTestCase::DoRun()
+{
+    // The MAC turns the receiver on at initialization, after the turnaround
+    // time (12 symbols), a CCA (8 symbols) is done at 0.5 s and the receiver
+    // is turned off at 1 s, until the end at 2 s.
+    const double symbolTime = 1.0 / 62500; // 2.4 GHz O-QPSK
+    const double voltage = 3.0;
+    const double initialEnergy = 10.0;
+    const double rxCurrent = 0.0188; // CC2420 defaults
+    const double offCurrent = 0.000426;
+
+    Ptr<Node> node = CreateObject<Node>();
+    Ptr<LrWpanNetDevice> dev = CreateObject<LrWpanNetDevice>();
+    dev->SetAddress(Mac16Address("00:01"));
+    dev->SetChannel(CreateObject<SingleModelSpectrumChannel>());
+    node->AddDevice(dev);
+
+    BasicEnergySourceHelper sourceHelper;
+    sourceHelper.Set("BasicEnergySourceInitialEnergyJ", DoubleValue(initialEnergy));
+    sourceHelper.Set("BasicEnergySupplyVoltageV", DoubleValue(voltage));
+    energy::EnergySourceContainer sources = sourceHelper.Install(node);
+
+    LrWpanRadioEnergyModelHelper radioHelper;
+    energy::DeviceEnergyModelContainer models = radioHelper.Install(dev, sources.Get(0));
+    Ptr<LrWpanRadioEnergyModel> model = DynamicCast<LrWpanRadioEnergyModel>(models.Get(0));
+    NS_TEST_ASSERT_MSG_NE(model, nullptr, "The helper must install a LrWpanRadioEnergyModel");
+
+    Simulator::Schedule(Seconds(0.5), &LrWpanPhy::PlmeCcaRequest, dev->GetPhy());
+    Simulator::Schedule(Seconds(1), &LrWpanMac::SetRxOnWhenIdle, dev->GetMac(), false);
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+
+    double rxTime = 1 - 12 * symbolTime;
+    double offTime = 1 + 12 * symbolTime;
+    NS_TEST_ASSERT_MSG_EQ(model->GetCurrentState(),
+                          LrWpanRadioEnergyModel::RADIO_TRX_OFF,
+                          "The receiver must end off");
+    Time listening = model->GetStateTime(LrWpanRadioEnergyModel::RADIO_RX_ON);
+    NS_TEST_ASSERT_MSG_EQ_TOL(listening.GetSeconds(),
+                              rxTime,
+                              1e-9,
+                              "Time spent listening");
+    NS_TEST_ASSERT_MSG_EQ_TOL(model->GetStateEnergy(LrWpanRadioEnergyModel::RADIO_RX_ON),
+                              rxTime * rxCurrent * voltage,
+                              1e-9,
+                              "Energy drawn listening");
+    NS_TEST_ASSERT_MSG_EQ(model->GetStateTime(LrWpanRadioEnergyModel::RADIO_BUSY_TX),
+                          Seconds(0),
+                          "Nothing is transmitted");
+
+    NS_TEST_ASSERT_MSG_EQ(model->GetCcaCount(), 1, "One CCA");
+    NS_TEST_ASSERT_MSG_EQ_TOL(model->GetCcaEnergy(),
+                              8 * symbolTime * rxCurrent * voltage,
+                              1e-12,
+                              "Receive energy of the CCA");
+    NS_TEST_ASSERT_MSG_EQ(model->GetEdCount(), 0, "No energy detection");
+
+    // the last TRX_OFF period is only accounted by the total
+    double total = rxTime * rxCurrent * voltage + offTime * offCurrent * voltage;
+    NS_TEST_ASSERT_MSG_EQ_TOL(model->GetTotalEnergyConsumption(),
+                              total,
+                              1e-9,
+                              "Total energy drawn");
+    NS_TEST_ASSERT_MSG_EQ_TOL(sources.Get(0)->GetRemainingEnergy(),
+                              initialEnergy - total,
+                              1e-9,
+                              "The source must be drained by the model");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check that a device sleeps in the inactive periods, wakes before
+ *        each beacon and widens its listening window when beacons are missed.
+ */
+class LrWpanInactiveSleepTestCase : public TestCase
+{
+  public:
+    LrWpanInactiveSleepTestCase();
+    ~LrWpanInactiveSleepTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanInactiveSleepTestCase::LrWpanInactiveSleepTestCase()
+    : TestCase("Inactive period sleep and beacon guard time of a LR-WPAN device")
+{
+}
+
+LrWpanInactiveSleepTestCase::~LrWpanInactiveSleepTestCase()
+{
+}
+
+void
+LrWpanInactiveSleepTestCase::DoRun()
+{
+    // BO = 6, SO = 3: the device may sleep 7/8 of each beacon interval. It is
+    // moved out of range in the middle of the sixth superframe: it misses the
+    // next beacons, wakes one more guard time earlier each time, and stays on
+    // after aMaxLostBeacons + 1 misses.
+    const Time interval = Seconds(aBaseSuperframeDuration * 64 / 62500.0);
+    const Time guard = MilliSeconds(10);
+    const Time start = Seconds(1);
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    LrWpanHelper helper;
+    NetDeviceContainer devices = helper.InstallStarPan(nodes, 5, {1});
+    Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice>(devices.Get(1));
+
+    Ptr<ConstantPositionMobilityModel> coordMobility =
+        CreateObject<ConstantPositionMobilityModel>();
+    Ptr<ConstantPositionMobilityModel> devMobility = CreateObject<ConstantPositionMobilityModel>();
+    devMobility->SetPosition(Vector(10, 0, 0));
+    helper.AddMobility(DynamicCast<LrWpanNetDevice>(devices.Get(0))->GetPhy(), coordMobility);
+    helper.AddMobility(dev->GetPhy(), devMobility);
+
+    helper.EnableInactiveSleep(NetDeviceContainer(dev), guard);
+    helper.StartSynchronizedPan(devices, 6, 3, start);
+
+    BasicEnergySourceHelper sourceHelper;
+    energy::EnergySourceContainer sources = sourceHelper.Install(nodes.Get(1));
+    LrWpanRadioEnergyModelHelper radioHelper;
+    Ptr<LrWpanRadioEnergyModel> model =
+        DynamicCast<LrWpanRadioEnergyModel>(radioHelper.Install(dev, sources.Get(0)).Get(0));
+
+    std::vector<Time> sleepEnds;
+    Ptr<LrWpanMac> mac = dev->GetMac();
+    dev->GetPhy()->TraceConnectWithoutContext(
+        "TrxStateValue",
+        Callback<void, PhyEnumeration, PhyEnumeration>(
+            [&sleepEnds, mac](PhyEnumeration, PhyEnumeration newState) {
+                Time sleepEnd = mac->GetSleepEnd();
+                if (newState == IEEE_802_15_4_PHY_TRX_OFF && sleepEnd.IsStrictlyPositive())
+                {
+                    sleepEnds.push_back(sleepEnd);
+                }
+            }));
+
+    Simulator::Schedule(start + Seconds(interval.GetSeconds() * 5.5),
+                        &ConstantPositionMobilityModel::SetPosition,
+                        devMobility,
+                        Vector(100000, 0, 0));
+    Simulator::Stop(start + interval * 15);
+    Simulator::Run();
+
+    // six superframes followed, then four sleeps with a widened window
+    NS_TEST_ASSERT_MSG_EQ(sleepEnds.size(), 10U, "Sleeps of the device");
+    for (std::size_t i = 1; i < sleepEnds.size(); i++)
+    {
+        Time expected = i < 6 ? interval : interval - guard;
+        NS_TEST_ASSERT_MSG_EQ_TOL((sleepEnds[i] - sleepEnds[i - 1]).GetSeconds(),
+                                  expected.GetSeconds(),
+                                  1e-6,
+                                  "Wakeup " << i << " of the device");
+    }
+    NS_TEST_ASSERT_MSG_EQ(dev->GetPhy()->GetTrxState(),
+                          IEEE_802_15_4_PHY_RX_ON,
+                          "The device must listen after the beacons are lost");
+    NS_TEST_ASSERT_MSG_GT(model->GetStateTime(LrWpanRadioEnergyModel::RADIO_TRX_OFF),
+                          interval * 7,
+                          "The transceiver must be off most of the time");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan radio energy model TestSuite
+ */
+class LrWpanEnergyTestSuite : public TestSuite
+{
+  public:
+    LrWpanEnergyTestSuite();
+};
+
+LrWpanEnergyTestSuite::LrWpanEnergyTestSuite()
+    : TestSuite("lr-wpan-energy", Type::UNIT)
+{
+    AddTestCase(new LrWpanRadioEnergyModelTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanInactiveSleepTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanEnergyTestSuite g_lrWpanEnergyTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-association-manager.h>
+#include <ns3/lr-wpan-csmaca-gnu-noba.h>
+#include <ns3/lr-wpan-csmaca-sw-noba.h>
+#include <ns3/lr-wpan-csmaca.h>
+#include <ns3/lr-wpan-helper.h>
+#include <ns3/lr-wpan-net-device.h>
+#include <ns3/lr-wpan-partition-helper.h>
+#include <ns3/lr-wpan-traffic-generator.h>
+#include <ns3/node-container.h>
+#include <ns3/object-factory.h>
+#include <ns3/packet.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/simulator.h>
+#include <ns3/test.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-helper-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check the star PANs built by LrWpanHelper::InstallStarPan.
+ *
+ * A PAN of a coordinator, two TP 0 devices and one TP 2 device is built with
+ * the SW-NOBA variant: every device must be addressed, associated and run the
+ * variant with its TP, and the coordinator the IEEE 802.15.4 CSMA/CA with TP 7.
+ * The attributes given with the variant must reach its engines.
+ */
+class LrWpanStarPanTestCase : public TestCase
+{
+  public:
+    LrWpanStarPanTestCase();
+    ~LrWpanStarPanTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanStarPanTestCase::LrWpanStarPanTestCase()
+    : TestCase("Test the star PANs built by the LrWpanHelper")
+{
+}
+
+LrWpanStarPanTestCase::~LrWpanStarPanTestCase()
+{
+}
+
+void
+LrWpanStarPanTestCase::DoRun()
+{
+    // A helper that never installed a device has no channel to dispose of
+    {
+        LrWpanHelper helper;
+    }
+
+    // The engines have a default constructor, for the ObjectFactory
+    ObjectFactory factory("ns3::lrwpan::LrWpanCsmaCaGnuNoba");
+    Ptr<LrWpanCsmaCaCommon> engine = factory.Create<LrWpanCsmaCaCommon>();
+    NS_TEST_ASSERT_MSG_EQ(+engine->GetTP(), 0, "Wrong default TP");
+    engine->SetTP(5);
+    NS_TEST_ASSERT_MSG_EQ(+engine->GetTP(), 5, "Wrong TP");
+    NS_TEST_ASSERT_MSG_EQ(engine->GetCsmaOption(), CSMA_GNU_NOBA, "Wrong CSMA/CA option");
+
+    NodeContainer nodes;
+    nodes.Create(4);
+    LrWpanHelper helper;
+    helper.SetCsmaCa("ns3::lrwpan::LrWpanCsmaCaSwNoba");
+    NetDeviceContainer devices = helper.InstallStarPan(nodes, 5, {2, 0, 1});
+    NS_TEST_ASSERT_MSG_EQ(devices.GetN(), 4, "Wrong number of devices");
+
+    const uint8_t tps[] = {7, 0, 0, 2};
+    const char* addresses[] = {"00:01", "00:02", "00:03", "00:04"};
+    for (uint32_t i = 0; i < devices.GetN(); i++)
+    {
+        Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice>(devices.Get(i));
+        NS_TEST_ASSERT_MSG_EQ(dev->GetNode(), nodes.Get(i), "Device " << i << " not installed");
+        NS_TEST_ASSERT_MSG_EQ(dev->GetMac()->GetPanId(), 5, "Wrong PAN of device " << i);
+        NS_TEST_ASSERT_MSG_EQ(dev->GetMac()->GetShortAddress(),
+                              Mac16Address(addresses[i]),
+                              "Wrong address of device " << i);
+        NS_TEST_ASSERT_MSG_EQ(dev->GetMac()->GetCoordShortAddress(),
+                              Mac16Address("00:01"),
+                              "Wrong coordinator of device " << i);
+        NS_TEST_ASSERT_MSG_EQ(+dev->GetMac()->GetPriority(),
+                              +tps[i],
+                              "Wrong TP of the MAC of device " << i);
+        NS_TEST_ASSERT_MSG_EQ(+dev->GetCsmaCa()->GetTP(),
+                              +tps[i],
+                              "Wrong TP of the CSMA/CA of device " << i);
+        if (i == 0)
+        {
+            NS_TEST_ASSERT_MSG_NE(DynamicCast<LrWpanCsmaCa>(dev->GetCsmaCa()),
+                                  nullptr,
+                                  "The coordinator must run the IEEE 802.15.4 CSMA/CA");
+        }
+        else
+        {
+            NS_TEST_ASSERT_MSG_NE(DynamicCast<LrWpanCsmaCaSwNoba>(dev->GetCsmaCa()),
+                                  nullptr,
+                                  "Device " << i << " must run SW-NOBA");
+        }
+    }
+
+    // Attribute overrides of the variant
+    NodeContainer otherNodes;
+    otherNodes.Create(2);
+    helper.SetCsmaCa("ns3::lrwpan::LrWpanCsmaCa", "MacMinBE", UintegerValue(2));
+    NetDeviceContainer otherDevices = helper.InstallStarPan(otherNodes, 6, {0, 0, 0, 1});
+    Ptr<LrWpanCsmaCa> csma = DynamicCast<LrWpanCsmaCa>(
+        DynamicCast<LrWpanNetDevice>(otherDevices.Get(1))->GetCsmaCa());
+    NS_TEST_ASSERT_MSG_EQ(+csma->GetMacMinBE(), 2, "The attribute override is lost");
+    NS_TEST_ASSERT_MSG_EQ(+csma->GetTP(), 3, "Wrong TP");
+    NS_TEST_ASSERT_MSG_EQ(DynamicCast<LrWpanNetDevice>(otherDevices.Get(1))->GetChannel(),
+                          DynamicCast<LrWpanNetDevice>(devices.Get(1))->GetChannel(),
+                          "The PANs of a helper must share its channel");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check the admission control of LrWpanAssociationManager.
+ *
+ * Twelve devices join a beacon-enabled coordinator at the same instant, with
+ * a budget of two admissions per superframe: every device must join with its
+ * own short address, and no superframe may queue more responses than the
+ * budget.
+ */
+class LrWpanAssociationManagerTestCase : public TestCase
+{
+  public:
+    LrWpanAssociationManagerTestCase();
+    ~LrWpanAssociationManagerTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanAssociationManagerTestCase::LrWpanAssociationManagerTestCase()
+    : TestCase("Test the admission control of the LrWpanAssociationManager")
+{
+}
+
+LrWpanAssociationManagerTestCase::~LrWpanAssociationManagerTestCase()
+{
+}
+
+void
+LrWpanAssociationManagerTestCase::DoRun()
+{
+    // The beacon payload
+    uint8_t budget;
+    double probability;
+    uint8_t octets[] = {3, 255};
+    NS_TEST_ASSERT_MSG_EQ(
+        LrWpanAssociationManager::ParseBeaconPayload(Create<Packet>(octets, 2), budget, probability),
+        true,
+        "A manager payload must be read");
+    NS_TEST_ASSERT_MSG_EQ(+budget, 3, "Wrong budget");
+    NS_TEST_ASSERT_MSG_EQ_TOL(probability, 1, 1e-9, "Wrong access probability");
+    NS_TEST_ASSERT_MSG_EQ(
+        LrWpanAssociationManager::ParseBeaconPayload(Create<Packet>(3), budget, probability),
+        false,
+        "Other payloads must be rejected");
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    const uint32_t joiners = 12;
+    NodeContainer nodes;
+    nodes.Create(joiners + 1);
+    LrWpanHelper helper;
+    NetDeviceContainer devices = helper.Install(nodes);
+    helper.SetExtendedAddresses(devices);
+
+    Ptr<LrWpanNetDevice> coord = DynamicCast<LrWpanNetDevice>(devices.Get(0));
+    coord->GetMac()->SetShortAddress(Mac16Address("CA:FE"));
+
+    // responses queued per superframe, reset before the manager's batch
+    uint32_t queued = 0;
+    uint32_t maxQueued = 0;
+    coord->GetMac()->TraceConnectWithoutContext(
+        "BeaconStart",
+        Callback<void, SequenceNumber8>([&queued](SequenceNumber8) { queued = 0; }));
+    coord->GetMac()->TraceConnectWithoutContext(
+        "MacIndTxEnqueue",
+        Callback<void, Ptr<const Packet>>([&queued, &maxQueued](Ptr<const Packet>) {
+            maxQueued = std::max(maxQueued, ++queued);
+        }));
+
+    LrWpanAssociationManager manager;
+    manager.SetJoinBudget(2);
+    manager.SetInitialAccessProbability(0.5);
+    manager.AssignStreams(0);
+    manager.Install(coord);
+
+    MlmeStartRequestParams startParams;
+    startParams.m_panCoor = true;
+    startParams.m_PanId = 5;
+    startParams.m_bcnOrd = 3;
+    startParams.m_sfrmOrd = 3;
+    Simulator::ScheduleWithContext(nodes.Get(0)->GetId(),
+                                   Seconds(0.01),
+                                   &LrWpanMacBase::MlmeStartRequest,
+                                   coord->GetMac(),
+                                   startParams);
+
+    MlmeAssociateRequestParams assocParams;
+    assocParams.m_chNum = 11;
+    assocParams.m_coordPanId = 5;
+    assocParams.m_coordAddrMode = SHORT_ADDR;
+    assocParams.m_coordShortAddr = Mac16Address("CA:FE");
+    CapabilityField capability;
+    capability.SetShortAddrAllocOn(true);
+    assocParams.m_capabilityInfo = capability.GetCapability();
+    for (uint32_t i = 1; i <= joiners; i++)
+    {
+        Simulator::ScheduleWithContext(nodes.Get(i)->GetId(),
+                                       Seconds(0.5),
+                                       &LrWpanAssociationManager::Join,
+                                       &manager,
+                                       DynamicCast<LrWpanNetDevice>(devices.Get(i)),
+                                       assocParams);
+    }
+
+    Simulator::Stop(Seconds(60));
+    Simulator::Run();
+
+    const LrWpanAssociationStats& stats = manager.GetStats();
+    NS_TEST_ASSERT_MSG_EQ(stats.joined, joiners, "Every device must join");
+    NS_TEST_ASSERT_MSG_EQ(manager.GetJoinLatency().GetCount(), joiners, "Wrong latency count");
+    NS_TEST_ASSERT_MSG_GT(manager.GetJoinLatency().GetMin(), 0, "Joining takes time");
+    NS_TEST_ASSERT_MSG_LT(maxQueued, 3, "A superframe queued more responses than the budget");
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(stats.attempts, joiners, "Every device must request");
+
+    std::set<Mac16Address> addresses;
+    for (uint32_t i = 1; i <= joiners; i++)
+    {
+        Ptr<LrWpanMac> mac = DynamicCast<LrWpanNetDevice>(devices.Get(i))->GetMac();
+        NS_TEST_ASSERT_MSG_EQ(mac->GetPanId(), 5, "Device " << i << " not associated");
+        NS_TEST_ASSERT_MSG_NE(mac->GetShortAddress(),
+                              Mac16Address("CA:FE"),
+                              "Device " << i << " got the coordinator address");
+        addresses.insert(mac->GetShortAddress());
+    }
+    NS_TEST_ASSERT_MSG_EQ(addresses.size(), joiners, "The short addresses must be unique");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check the partitions of a site found by the LrWpanPartitionHelper.
+ *
+ * With the default LogDistance loss and a cut at 120 dB, PANs 1 and 2 are 90 m apart and 2 and 5
+ * 200 m apart: they form one partition, although 1 and 5 are 290 m apart,
+ * beyond 120 dB. PANs 3 and 4, 2 km away, form another. With a max loss of
+ * 100 dB every PAN is alone.
+ */
+class LrWpanPartitionTestCase : public TestCase
+{
+  public:
+    LrWpanPartitionTestCase();
+    ~LrWpanPartitionTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanPartitionTestCase::LrWpanPartitionTestCase()
+    : TestCase("Test the partitions of a site of PANs")
+{
+}
+
+LrWpanPartitionTestCase::~LrWpanPartitionTestCase()
+{
+}
+
+void
+LrWpanPartitionTestCase::DoRun()
+{
+    LrWpanPartitionHelper site;
+    site.SetMaxLossDb(120);
+    site.AddPan(1, {Vector(0, 0, 0), Vector(10, 0, 0)});
+    site.AddPan(3, {Vector(2000, 0, 0)});
+    site.AddPan(2, {Vector(100, 0, 0)});
+    site.AddPan(5, {Vector(300, 0, 0)});
+    site.AddPan(4, {Vector(2200, 0, 0)});
+
+    std::vector<LrWpanPartitionHelper::Partition> partitions = site.GetPartitions();
+    NS_TEST_ASSERT_MSG_EQ(partitions.size(), 2U, "Two groups of coupled PANs");
+    NS_TEST_ASSERT_MSG_EQ((partitions[0].panIds == std::vector<uint16_t>{1, 2, 5}),
+                          true,
+                          "PAN 5 is coupled to PAN 1 through PAN 2");
+    NS_TEST_ASSERT_MSG_EQ(partitions[0].devices, 4U, "Devices of the first partition");
+    NS_TEST_ASSERT_MSG_EQ((partitions[1].panIds == std::vector<uint16_t>{3, 4}),
+                          true,
+                          "PANs 3 and 4 are coupled");
+    NS_TEST_ASSERT_MSG_EQ(partitions[1].devices, 2U, "Devices of the second partition");
+
+    site.SetMaxLossDb(100);
+    partitions = site.GetPartitions();
+    NS_TEST_ASSERT_MSG_EQ(partitions.size(), 5U, "No PANs within 100 dB");
+    for (uint16_t i = 0; i < partitions.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(partitions[i].panIds.size(), 1U, "Partition " << i);
+        NS_TEST_ASSERT_MSG_EQ(partitions[i].panIds.front(), i + 1U, "Partition " << i);
+    }
+
+    // the failed partitions do not count
+    partitions[0].values = {{"delivered", 3}, {"events", 10}};
+    partitions[1].values = {{"events", 5}, {"delivered", 1}, {"lost", 2}};
+    partitions[2].values = {{"delivered", 100}};
+    partitions[2].status = 1;
+    LrWpanProcessPool::Records sum = LrWpanPartitionHelper::Sum(partitions);
+    NS_TEST_ASSERT_MSG_EQ(sum.size(), 3U, "One record per name");
+    NS_TEST_ASSERT_MSG_EQ(sum[0].first, "delivered", "Records in order of appearance");
+    NS_TEST_ASSERT_MSG_EQ(sum[0].second, 4, "Sum of the delivered frames");
+    NS_TEST_ASSERT_MSG_EQ(sum[1].second, 15, "Sum of the events");
+    NS_TEST_ASSERT_MSG_EQ(sum[2].second, 2, "Record of one partition");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check a partitioned site against a run of the whole site on one
+ *        channel cut at the same loss.
+ *
+ * PANs 1 and 2, 100 m apart, take turns in one partition; PAN 3, 2 km away,
+ * is alone in another. Each partition is run on its own channel, then the
+ * three PANs on one channel with the same MaxLossDb: every coordinator must
+ * receive the same frames at the same times.
+ */
+class LrWpanPartitionRunTestCase : public TestCase
+{
+  public:
+    LrWpanPartitionRunTestCase();
+    ~LrWpanPartitionRunTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Build PANs of the site on the channel of a helper, with their traffic.
+     *
+     * \param site the site
+     * \param helper the helper
+     * \param panIds the PANs to build
+     */
+    void InstallPans(const LrWpanPartitionHelper& site,
+                     LrWpanHelper& helper,
+                     const std::vector<uint16_t>& panIds);
+
+    /**
+     * Run the PANs of a helper and clear the simulator.
+     *
+     * \param site the site
+     * \param helper the helper
+     */
+    void RunPans(const LrWpanPartitionHelper& site, LrWpanHelper& helper);
+
+    std::map<uint16_t, std::vector<Time>> m_received; //!< Receptions of the coordinators
+};
+
+LrWpanPartitionRunTestCase::LrWpanPartitionRunTestCase()
+    : TestCase("Test a partitioned site against a run on one channel")
+{
+}
+
+LrWpanPartitionRunTestCase::~LrWpanPartitionRunTestCase()
+{
+}
+
+void
+LrWpanPartitionRunTestCase::InstallPans(const LrWpanPartitionHelper& site,
+                                        LrWpanHelper& helper,
+                                        const std::vector<uint16_t>& panIds)
+{
+    const Time superframeDuration = MicroSeconds(16 * 960) * (1 << 3);
+    for (uint16_t panId : panIds)
+    {
+        NodeContainer nodes;
+        nodes.Create(site.GetPositions(panId).size());
+        NetDeviceContainer devices = site.InstallPan(helper, nodes, panId, {3});
+        int64_t stream = LrWpanPartitionHelper::GetFirstStream(panId);
+        stream += helper.AssignStreams(devices, stream);
+
+        std::vector<Time>& received = m_received[panId];
+        DynamicCast<LrWpanNetDevice>(devices.Get(0))
+            ->GetMac()
+            ->TraceConnectWithoutContext("MacRx",
+                                         Callback<void, Ptr<const Packet>, uint8_t>(
+                                             [&received](Ptr<const Packet>, uint8_t) {
+                                                 received.push_back(Simulator::Now());
+                                             }));
+
+        NetDeviceContainer endDevices;
+        for (uint32_t i = 1; i < devices.GetN(); i++)
+        {
+            endDevices.Add(devices.Get(i));
+        }
+        Ptr<LrWpanTrafficGenerator> traffic = CreateObject<LrWpanTrafficGenerator>();
+        traffic->SetSource(0, "ns3::lrwpan::LrWpanPoissonTrafficSource", "Rate", DoubleValue(5));
+        helper.InstallTraffic(endDevices, traffic);
+        traffic->AssignStreams(stream);
+        // PANs 1 and 2 take turns, BO = SO + 1
+        helper.StartSynchronizedPan(devices,
+                                    4,
+                                    3,
+                                    MilliSeconds(10) + superframeDuration * (panId % 2));
+        traffic->Start(Seconds(0.1));
+        traffic->Stop(Seconds(3));
+    }
+}
+
+void
+LrWpanPartitionRunTestCase::RunPans(const LrWpanPartitionHelper& site, LrWpanHelper& helper)
+{
+    site.ConfigureChannel(helper.GetChannel());
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+LrWpanPartitionRunTestCase::DoRun()
+{
+    LrWpanPartitionHelper site;
+    site.SetMaxLossDb(120);
+    const double centers[] = {0, 100, 2000};
+    for (uint16_t panId = 1; panId <= 3; panId++)
+    {
+        Vector center(centers[panId - 1], 0, 0);
+        std::vector<Vector> positions{center};
+        for (double dx : {-10, 10})
+        {
+            positions.emplace_back(center.x + dx, 0, 0);
+        }
+        positions.emplace_back(center.x, 10, 0);
+        site.AddPan(panId, positions);
+    }
+
+    std::vector<LrWpanPartitionHelper::Partition> partitions = site.GetPartitions();
+    NS_TEST_ASSERT_MSG_EQ(partitions.size(), 2U, "PANs 1 and 2 coupled, PAN 3 alone");
+    for (const auto& partition : partitions)
+    {
+        LrWpanHelper helper;
+        InstallPans(site, helper, partition.panIds);
+        RunPans(site, helper);
+    }
+    std::map<uint16_t, std::vector<Time>> partitioned;
+    partitioned.swap(m_received);
+
+    {
+        LrWpanHelper helper;
+        InstallPans(site, helper, {1, 2, 3});
+        RunPans(site, helper);
+    }
+    for (uint16_t panId = 1; panId <= 3; panId++)
+    {
+        NS_TEST_ASSERT_MSG_GT(partitioned[panId].size(),
+                              0U,
+                              "PAN " << panId << " received nothing");
+        NS_TEST_ASSERT_MSG_EQ((partitioned[panId] == m_received[panId]),
+                              true,
+                              "PAN " << panId << " differs from the run on one channel");
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan helper TestSuite
+ */
+class LrWpanHelperTestSuite : public TestSuite
+{
+  public:
+    LrWpanHelperTestSuite();
+};
+
+LrWpanHelperTestSuite::LrWpanHelperTestSuite()
+    : TestSuite("lr-wpan-helper", Type::UNIT)
+{
+    AddTestCase(new LrWpanStarPanTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanAssociationManagerTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanPartitionTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanPartitionRunTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanHelperTestSuite g_lrWpanHelperTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-latency-histogram.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/test.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-latency-histogram-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Compare the histogram quantiles with the exact quantiles of a sample.
+ */
+class LrWpanLatencyHistogramTestCase : public TestCase
+{
+  public:
+    LrWpanLatencyHistogramTestCase();
+    ~LrWpanLatencyHistogramTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanLatencyHistogramTestCase::LrWpanLatencyHistogramTestCase()
+    : TestCase("Test the relative error, merge and serialization of the latency histogram")
+{
+}
+
+LrWpanLatencyHistogramTestCase::~LrWpanLatencyHistogramTestCase()
+{
+}
+
+void
+LrWpanLatencyHistogramTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    Ptr<ExponentialRandomVariable> delay = CreateObject<ExponentialRandomVariable>();
+    delay->SetAttribute("Mean", DoubleValue(100));
+
+    LrWpanLatencyHistogram all;
+    LrWpanLatencyHistogram odd;
+    LrWpanLatencyHistogram even;
+    std::vector<double> samples;
+    double sum = 0;
+    for (uint32_t i = 0; i < 100000; i++)
+    {
+        double d = delay->GetValue();
+        samples.push_back(d);
+        sum += d;
+        all.Record(d);
+        (i % 2 ? odd : even).Record(d);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    NS_TEST_ASSERT_MSG_EQ(all.GetCount(), samples.size(), "Wrong sample count");
+    NS_TEST_ASSERT_MSG_EQ(all.GetMin(), samples.front(), "The minimum must be exact");
+    NS_TEST_ASSERT_MSG_EQ(all.GetMax(), samples.back(), "The maximum must be exact");
+    NS_TEST_ASSERT_MSG_EQ_TOL(all.GetMean(), sum / samples.size(), 1e-9, "Wrong mean");
+
+    for (double q : {0.5, 0.9, 0.99, 0.999})
+    {
+        double exact = samples[std::ceil(q * samples.size()) - 1];
+        NS_TEST_ASSERT_MSG_EQ_TOL(all.GetQuantile(q),
+                                  exact,
+                                  exact * all.GetRelativeError(),
+                                  "Quantile " << q << " out of the error bound");
+    }
+
+    odd.Merge(even);
+    NS_TEST_ASSERT_MSG_EQ(odd.GetCount(), all.GetCount(), "Wrong merged count");
+    NS_TEST_ASSERT_MSG_EQ(odd.GetQuantile(0.99),
+                          all.GetQuantile(0.99),
+                          "Merging must not change the quantiles");
+
+    std::stringstream ss;
+    all.Write(ss);
+    LrWpanLatencyHistogram read;
+    NS_TEST_ASSERT_MSG_EQ(read.Read(ss), true, "Cannot read a written histogram");
+    NS_TEST_ASSERT_MSG_EQ(read.GetQuantile(0.999),
+                          all.GetQuantile(0.999),
+                          "Serialization must not change the quantiles");
+
+    LrWpanLatencyHistogram coarse(1, 3);
+    std::stringstream ss2;
+    all.Write(ss2);
+    NS_TEST_ASSERT_MSG_EQ(coarse.Read(ss2), false, "Histograms with different layouts");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan latency histogram TestSuite
+ */
+class LrWpanLatencyHistogramTestSuite : public TestSuite
+{
+  public:
+    LrWpanLatencyHistogramTestSuite();
+};
+
+LrWpanLatencyHistogramTestSuite::LrWpanLatencyHistogramTestSuite()
+    : TestSuite("lr-wpan-latency-histogram", Type::UNIT)
+{
+    AddTestCase(new LrWpanLatencyHistogramTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanLatencyHistogramTestSuite
+    g_lrWpanLatencyHistogramTestSuite; //!< Static variable for test initialization
@@ -707,6 +707,301 @@ TestOrphanScan::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Test the beacons sent from the cached beacon template.
+ */
+class TestBeaconTemplate : public TestCase
+{
+  public:
+    TestBeaconTemplate();
+    ~TestBeaconTemplate() override;
+
+  private:
+    /**
+     * Check a beacon sent by the coordinator.
+     *
+     * \param p the transmitted frame
+     */
+    void PhyTxBegin(Ptr<const Packet> p);
+
+    void DoRun() override;
+
+    uint32_t m_beacons;         //!< Beacons sent
+    uint32_t m_badFcs;          //!< Beacons with a wrong FCS
+    uint32_t m_badBsn;          //!< Beacons that do not follow the previous BSN
+    uint8_t m_lastBsn;          //!< BSN of the previous beacon
+    uint32_t m_payloadBeacons;  //!< Beacons with the 2 octets payload
+    uint32_t m_noPermitBeacons; //!< Beacons without association permit
+};
+
+TestBeaconTemplate::TestBeaconTemplate()
+    : TestCase("Test the BSN, FCS and content of the beacons built from the beacon template"),
+      m_beacons(0),
+      m_badFcs(0),
+      m_badBsn(0),
+      m_lastBsn(0),
+      m_payloadBeacons(0),
+      m_noPermitBeacons(0)
+{
+}
+
+TestBeaconTemplate::~TestBeaconTemplate()
+{
+}
+
+void
+TestBeaconTemplate::PhyTxBegin(Ptr<const Packet> p)
+{
+    Ptr<Packet> frame = p->Copy();
+    LrWpanMacTrailer trailer;
+    frame->RemoveTrailer(trailer);
+    trailer.EnableFcs(true);
+    if (!trailer.CheckFcs(frame))
+    {
+        m_badFcs++;
+    }
+
+    LrWpanMacHeader hdr;
+    frame->RemoveHeader(hdr);
+    if (!hdr.IsBeacon())
+    {
+        return;
+    }
+    if (m_beacons > 0 && hdr.GetSeqNum() != static_cast<uint8_t>(m_lastBsn + 1))
+    {
+        m_badBsn++;
+    }
+    m_lastBsn = hdr.GetSeqNum();
+    m_beacons++;
+
+    BeaconPayloadHeader beaconPayload;
+    frame->RemoveHeader(beaconPayload);
+    if (frame->GetSize() == 2)
+    {
+        m_payloadBeacons++;
+    }
+    if (!SuperframeField(beaconPayload.GetSuperframeSpecField()).IsAssocPermit())
+    {
+        m_noPermitBeacons++;
+    }
+}
+
+void
+TestBeaconTemplate::DoRun()
+{
+    /*
+     * A beacon-enabled PAN coordinator (BO = SO = 3, about 8 beacons/s) with
+     * FCS enabled. At 1 s a beacon payload is set, at 2 s the association
+     * permit is cleared. Every beacon must carry a valid FCS and the next BSN,
+     * and the beacons must follow the payload and superframe changes.
+     */
+    GlobalValue::Bind("ChecksumEnabled", BooleanValue(true));
+
+    Ptr<Node> coord = CreateObject<Node>();
+    Ptr<LrWpanNetDevice> coordNetDevice = CreateObject<LrWpanNetDevice>();
+    coordNetDevice->GetMac()->SetExtendedAddress("00:00:00:00:00:00:CA:FE");
+    coordNetDevice->GetMac()->SetShortAddress(Mac16Address("00:01"));
+
+    Ptr<SingleModelSpectrumChannel> channel = CreateObject<SingleModelSpectrumChannel>();
+    coordNetDevice->SetChannel(channel);
+    coord->AddDevice(coordNetDevice);
+
+    coordNetDevice->GetPhy()->TraceConnectWithoutContext(
+        "PhyTxBegin",
+        MakeCallback(&TestBeaconTemplate::PhyTxBegin, this));
+
+    MlmeStartRequestParams params;
+    params.m_panCoor = true;
+    params.m_PanId = 5;
+    params.m_bcnOrd = 3;
+    params.m_sfrmOrd = 3;
+    Simulator::ScheduleWithContext(1,
+                                   Seconds(0.01),
+                                   &LrWpanMac::MlmeStartRequest,
+                                   coordNetDevice->GetMac(),
+                                   params);
+
+    Ptr<MacPibAttributes> payloadAttribute = Create<MacPibAttributes>();
+    payloadAttribute->macBeaconPayload = {1, 2};
+    Simulator::ScheduleWithContext(1,
+                                   Seconds(1),
+                                   &LrWpanMac::MlmeSetRequest,
+                                   coordNetDevice->GetMac(),
+                                   MacPibAttributeIdentifier::macBeaconPayload,
+                                   payloadAttribute);
+
+    Ptr<MacPibAttributes> permitAttribute = Create<MacPibAttributes>();
+    permitAttribute->macAssociationPermit = false;
+    Simulator::ScheduleWithContext(1,
+                                   Seconds(2),
+                                   &LrWpanMac::MlmeSetRequest,
+                                   coordNetDevice->GetMac(),
+                                   MacPibAttributeIdentifier::macAssociationPermit,
+                                   permitAttribute);
+
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_GT(m_beacons, 20, "Error, beacons not sent");
+    NS_TEST_EXPECT_MSG_EQ(m_badFcs, 0, "Error, beacon with a wrong FCS");
+    NS_TEST_EXPECT_MSG_EQ(m_badBsn, 0, "Error, beacon with a wrong BSN");
+    NS_TEST_EXPECT_MSG_GT(m_payloadBeacons, 0, "Error, the beacon payload was not sent");
+    NS_TEST_EXPECT_MSG_LT(m_payloadBeacons, m_beacons, "Error, beacon payload sent too early");
+    NS_TEST_EXPECT_MSG_GT(m_noPermitBeacons, 0, "Error, the association permit was not cleared");
+    NS_TEST_EXPECT_MSG_LT(m_noPermitBeacons,
+                          m_payloadBeacons,
+                          "Error, association permit cleared too early");
+
+    Simulator::Destroy();
+    GlobalValue::Bind("ChecksumEnabled", BooleanValue(false));
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Test the PANs started with their devices already synchronized.
+ */
+class TestPresetSync : public TestCase
+{
+  public:
+    TestPresetSync();
+    ~TestPresetSync() override;
+
+  private:
+    /**
+     * Record a frame received by the coordinator.
+     *
+     * \param p the received frame
+     * \param tp the TP of the frame
+     */
+    void CoordRx(Ptr<const Packet> p, uint8_t tp);
+
+    /**
+     * Record a loss of synchronization.
+     *
+     * \param params the MLME-SYNC-LOSS.indication parameters
+     */
+    void SyncLoss(MlmeSyncLossIndicationParams params);
+
+    void DoRun() override;
+
+    Time m_rxTime;           //!< Time the coordinator received the data frame
+    uint32_t m_syncLosses;   //!< Losses of synchronization
+    Time m_syncLossTime;     //!< Time of the last loss of synchronization
+};
+
+TestPresetSync::TestPresetSync()
+    : TestCase("Test the devices synchronized to the superframe without scan and association"),
+      m_syncLosses(0)
+{
+}
+
+TestPresetSync::~TestPresetSync()
+{
+}
+
+void
+TestPresetSync::CoordRx(Ptr<const Packet> p, uint8_t tp)
+{
+    m_rxTime = Simulator::Now();
+}
+
+void
+TestPresetSync::SyncLoss(MlmeSyncLossIndicationParams params)
+{
+    m_syncLosses++;
+    m_syncLossTime = Simulator::Now();
+}
+
+void
+TestPresetSync::DoRun()
+{
+    /*
+     * A coordinator and two devices, started at 10 ms with BO = SO = 3
+     * (superframe of 122.88 ms). A data frame enqueued before the first beacon
+     * must be sent in the first CAP, and the devices must keep tracking the
+     * beacons. Then a device synchronized to a coordinator that never starts
+     * must lose the synchronization after aMaxLostBeacons + 2 beacon search
+     * times of 960 * (2^3 + 1) symbols (138.24 ms) each.
+     */
+    {
+        NodeContainer nodes;
+        nodes.Create(3);
+        LrWpanHelper helper;
+        NetDeviceContainer devices = helper.InstallStarPan(nodes, 5, {2});
+        helper.StartSynchronizedPan(devices, 3, 3, Seconds(0.01));
+
+        Ptr<LrWpanNetDevice> coord = DynamicCast<LrWpanNetDevice>(devices.Get(0));
+        coord->GetMac()->TraceConnectWithoutContext("MacRx",
+                                                    MakeCallback(&TestPresetSync::CoordRx, this));
+        for (uint32_t i = 1; i < devices.GetN(); i++)
+        {
+            DynamicCast<LrWpanNetDevice>(devices.Get(i))
+                ->GetMac()
+                ->SetMlmeSyncLossIndicationCallback(MakeCallback(&TestPresetSync::SyncLoss, this));
+        }
+
+        McpsDataRequestParams params;
+        params.m_dstPanId = 5;
+        params.m_srcAddrMode = SHORT_ADDR;
+        params.m_dstAddrMode = SHORT_ADDR;
+        params.m_dstAddr = Mac16Address("00:01");
+        params.m_msduHandle = 0;
+        params.m_txOptions = TX_OPTION_ACK;
+        Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice>(devices.Get(1));
+        Simulator::ScheduleWithContext(dev->GetNode()->GetId(),
+                                       Seconds(0.005),
+                                       &LrWpanMac::McpsDataRequest,
+                                       dev->GetMac(),
+                                       params,
+                                       Create<Packet>(20));
+
+        Simulator::Stop(Seconds(2));
+        Simulator::Run();
+
+        NS_TEST_EXPECT_MSG_GT(m_rxTime, Seconds(0.01), "Error, data sent before the first beacon");
+        NS_TEST_EXPECT_MSG_LT(m_rxTime,
+                              Seconds(0.01 + 0.12288),
+                              "Error, data not sent in the first CAP");
+        NS_TEST_EXPECT_MSG_EQ(m_syncLosses, 0, "Error, synchronization lost");
+        Simulator::Destroy();
+    }
+
+    {
+        NodeContainer nodes;
+        nodes.Create(2);
+        LrWpanHelper helper;
+        NetDeviceContainer devices = helper.InstallStarPan(nodes, 6, {1});
+
+        SuperframeField superframe;
+        superframe.SetBeaconOrder(3);
+        superframe.SetSuperframeOrder(3);
+        superframe.SetFinalCapSlot(15);
+        Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice>(devices.Get(1));
+        dev->GetMac()->SetMlmeSyncLossIndicationCallback(
+            MakeCallback(&TestPresetSync::SyncLoss, this));
+        Simulator::ScheduleWithContext(dev->GetNode()->GetId(),
+                                       Seconds(0.01),
+                                       &LrWpanMac::PresetSync,
+                                       dev->GetMac(),
+                                       superframe);
+
+        Simulator::Stop(Seconds(2));
+        Simulator::Run();
+
+        NS_TEST_EXPECT_MSG_EQ(m_syncLosses, 1, "Error, synchronization not lost");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_syncLossTime.GetSeconds(),
+                                  0.01 + (aMaxLostBeacons + 2) * 0.13824,
+                                  1e-6,
+                                  "Error, synchronization lost at the wrong time");
+        Simulator::Destroy();
+    }
+}
+
 /**
  * \ingroup lr-wpan-test
  * \ingroup tests
@@ -725,6 +1020,8 @@ LrWpanMacTestSuite::LrWpanMacTestSuite()
     AddTestCase(new TestRxOffWhenIdleAfterCsmaFailure, TestCase::Duration::QUICK);
     AddTestCase(new TestActiveScanPanDescriptors, TestCase::Duration::QUICK);
     AddTestCase(new TestOrphanScan, TestCase::Duration::QUICK);
+    AddTestCase(new TestBeaconTemplate, TestCase::Duration::QUICK);
+    AddTestCase(new TestPresetSync, TestCase::Duration::QUICK);
 }
 
 static LrWpanMacTestSuite g_lrWpanMacTestSuite; //!< Static variable for test initialization
@@ -6,6 +6,7 @@
  * Author:  Tom Henderson <thomas.r.henderson@boeing.com>
  */
 #include <ns3/log.h>
+#include <ns3/lr-wpan-mac-header-view.h>
 #include <ns3/lr-wpan-mac-header.h>
 #include <ns3/lr-wpan-mac-trailer.h>
 #include <ns3/mac16-address.h>
@@ -97,6 +98,208 @@ LrWpanPacketTestCase::DoRun()
     // Compare macHdr with receivedMacHdr, macTrailer with receivedMacTrailer,...
 }
 
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Compare the MAC header view with the deserialized MAC header
+ */
+class LrWpanMacHeaderViewTestCase : public TestCase
+{
+  public:
+    LrWpanMacHeaderViewTestCase();
+    ~LrWpanMacHeaderViewTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanMacHeaderViewTestCase::LrWpanMacHeaderViewTestCase()
+    : TestCase("Test the 802.15.4 MAC header view against the MAC header")
+{
+}
+
+LrWpanMacHeaderViewTestCase::~LrWpanMacHeaderViewTestCase()
+{
+}
+
+void
+LrWpanMacHeaderViewTestCase::DoRun()
+{
+    std::vector<LrWpanMacHeader> headers;
+
+    LrWpanMacHeader data(LrWpanMacHeader::LRWPAN_MAC_DATA, 17);
+    data.SetSrcAddrMode(LrWpanMacHeader::SHORTADDR);
+    data.SetDstAddrMode(LrWpanMacHeader::SHORTADDR);
+    data.SetPanIdComp();
+    data.SetAckReq();
+    data.SetSrcAddrFields(5, Mac16Address("00:02"));
+    data.SetDstAddrFields(5, Mac16Address("00:01"));
+    headers.push_back(data);
+
+    LrWpanMacHeader command(LrWpanMacHeader::LRWPAN_MAC_COMMAND, 200);
+    command.SetSrcAddrMode(LrWpanMacHeader::EXTADDR);
+    command.SetDstAddrMode(LrWpanMacHeader::EXTADDR);
+    command.SetNoPanIdComp();
+    command.SetSrcAddrFields(0xffff, Mac64Address("00:00:00:00:00:00:00:02"));
+    command.SetDstAddrFields(0x1234, Mac64Address("01:02:03:04:05:06:07:08"));
+    command.SetSecEnable();
+    command.SetSecControl(0x03 << 3); // long key source
+    command.SetKeyId(uint64_t{0x0102030405060708}, 9);
+    headers.push_back(command);
+
+    LrWpanMacHeader beacon(LrWpanMacHeader::LRWPAN_MAC_BEACON, 3);
+    beacon.SetSrcAddrMode(LrWpanMacHeader::SHORTADDR);
+    beacon.SetDstAddrMode(LrWpanMacHeader::NOADDR);
+    beacon.SetNoPanIdComp();
+    beacon.SetSrcAddrFields(100, Mac16Address("00:11"));
+    headers.push_back(beacon);
+
+    LrWpanMacHeader mixed(LrWpanMacHeader::LRWPAN_MAC_DATA, 9);
+    mixed.SetSrcAddrMode(LrWpanMacHeader::EXTADDR);
+    mixed.SetDstAddrMode(LrWpanMacHeader::SHORTADDR);
+    mixed.SetNoPanIdComp();
+    mixed.SetSrcAddrFields(7, Mac64Address("00:00:00:00:00:00:00:09"));
+    mixed.SetDstAddrFields(6, Mac16Address("ff:ff"));
+    headers.push_back(mixed);
+
+    headers.emplace_back(LrWpanMacHeader::LRWPAN_MAC_ACKNOWLEDGMENT, 42);
+
+    for (const auto& hdr : headers)
+    {
+        Ptr<Packet> p = Create<Packet>(10);
+        p->AddHeader(hdr);
+
+        LrWpanMacHeaderView view;
+        uint32_t size = p->PeekHeader(view);
+        NS_TEST_ASSERT_MSG_EQ(size, hdr.GetSerializedSize(), "Wrong header size");
+        NS_TEST_ASSERT_MSG_EQ(view.GetType(), hdr.GetType(), "Wrong frame type");
+        NS_TEST_ASSERT_MSG_EQ(view.IsAckReq(), hdr.IsAckReq(), "Wrong Ack. Request bit");
+        NS_TEST_ASSERT_MSG_EQ(view.IsSecEnable(), hdr.IsSecEnable(), "Wrong Security bit");
+        NS_TEST_ASSERT_MSG_EQ(view.GetFrameVer(), hdr.GetFrameVer(), "Wrong frame version");
+        NS_TEST_ASSERT_MSG_EQ(view.GetSeqNum(), hdr.GetSeqNum(), "Wrong sequence number");
+        NS_TEST_ASSERT_MSG_EQ(view.GetDstAddrMode(), hdr.GetDstAddrMode(), "Wrong dst mode");
+        NS_TEST_ASSERT_MSG_EQ(view.GetSrcAddrMode(), hdr.GetSrcAddrMode(), "Wrong src mode");
+        if (hdr.GetDstAddrMode() != LrWpanMacHeader::NOADDR)
+        {
+            NS_TEST_ASSERT_MSG_EQ(view.GetDstPanId(), hdr.GetDstPanId(), "Wrong dst PAN ID");
+        }
+        if (hdr.GetDstAddrMode() == LrWpanMacHeader::SHORTADDR)
+        {
+            NS_TEST_ASSERT_MSG_EQ(view.GetShortDstAddr(), hdr.GetShortDstAddr(), "Wrong dst");
+        }
+        if (hdr.GetDstAddrMode() == LrWpanMacHeader::EXTADDR)
+        {
+            NS_TEST_ASSERT_MSG_EQ(view.GetExtDstAddr(), hdr.GetExtDstAddr(), "Wrong dst");
+        }
+        if (hdr.GetSrcAddrMode() != LrWpanMacHeader::NOADDR)
+        {
+            NS_TEST_ASSERT_MSG_EQ(view.GetSrcPanId(), hdr.GetSrcPanId(), "Wrong src PAN ID");
+        }
+        if (hdr.GetSrcAddrMode() == LrWpanMacHeader::SHORTADDR)
+        {
+            NS_TEST_ASSERT_MSG_EQ(view.GetShortSrcAddr(), hdr.GetShortSrcAddr(), "Wrong src");
+        }
+        if (hdr.GetSrcAddrMode() == LrWpanMacHeader::EXTADDR)
+        {
+            NS_TEST_ASSERT_MSG_EQ(view.GetExtSrcAddr(), hdr.GetExtSrcAddr(), "Wrong src");
+        }
+        NS_TEST_ASSERT_MSG_EQ(p->GetSize(), 10 + size, "Peeking must not change the packet");
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Test the FCS computation and the batch FCS check of the MAC trailer
+ */
+class LrWpanMacTrailerFcsTestCase : public TestCase
+{
+  public:
+    LrWpanMacTrailerFcsTestCase();
+    ~LrWpanMacTrailerFcsTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanMacTrailerFcsTestCase::LrWpanMacTrailerFcsTestCase()
+    : TestCase("Test the 802.15.4 MAC trailer FCS")
+{
+}
+
+LrWpanMacTrailerFcsTestCase::~LrWpanMacTrailerFcsTestCase()
+{
+}
+
+void
+LrWpanMacTrailerFcsTestCase::DoRun()
+{
+    // CRC-16/KERMIT check value
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    NS_TEST_ASSERT_MSG_EQ(LrWpanMacTrailer::GenerateCrc16(check, sizeof(check)),
+                          0x2189,
+                          "Wrong CRC-16/KERMIT check value");
+
+    std::vector<Ptr<const Packet>> frames;
+    std::vector<bool> expected;
+    for (uint32_t size = 0; size < 130; size += 7)
+    {
+        std::vector<uint8_t> payload(size);
+        for (uint32_t i = 0; i < size; i++)
+        {
+            payload[i] = static_cast<uint8_t>(i * 31 + size);
+        }
+        Ptr<Packet> p = Create<Packet>(payload.data(), size);
+        LrWpanMacHeader macHdr(LrWpanMacHeader::LRWPAN_MAC_DATA, size);
+        macHdr.SetSrcAddrMode(LrWpanMacHeader::SHORTADDR);
+        macHdr.SetDstAddrMode(LrWpanMacHeader::SHORTADDR);
+        macHdr.SetPanIdComp();
+        macHdr.SetSrcAddrFields(5, Mac16Address("00:02"));
+        macHdr.SetDstAddrFields(5, Mac16Address("00:01"));
+        p->AddHeader(macHdr);
+
+        LrWpanMacTrailer macTrailer;
+        macTrailer.EnableFcs(true);
+        macTrailer.SetFcs(p);
+        NS_TEST_ASSERT_MSG_EQ(macTrailer.CheckFcs(p), true, "FCS of the frame does not match");
+
+        // the bitwise CRC the table-driven one replaces
+        std::vector<uint8_t> frame(p->GetSize());
+        p->CopyData(frame.data(), frame.size());
+        uint16_t accumulator = 0;
+        for (uint8_t octet : frame)
+        {
+            accumulator ^= octet;
+            accumulator = (accumulator >> 8) | (accumulator << 8);
+            accumulator ^= (accumulator & 0xff00) << 4;
+            accumulator ^= (accumulator >> 8) >> 4;
+            accumulator ^= (accumulator & 0xff00) >> 5;
+        }
+        NS_TEST_ASSERT_MSG_EQ(macTrailer.GetFcs(), accumulator, "Wrong FCS for size " << size);
+
+        Ptr<Packet> good = p->Copy();
+        good->AddTrailer(macTrailer);
+        frames.push_back(good);
+        expected.push_back(true);
+
+        // corrupt one octet of the frame
+        frame[frame.size() / 2] ^= 0x10;
+        Ptr<Packet> bad = Create<Packet>(frame.data(), frame.size());
+        bad->AddTrailer(macTrailer);
+        frames.push_back(bad);
+        expected.push_back(false);
+    }
+
+    std::vector<bool> valid = LrWpanMacTrailer::CheckFcsBatch(frames);
+    NS_TEST_ASSERT_MSG_EQ(valid.size(), frames.size(), "One result per frame expected");
+    for (uint32_t i = 0; i < valid.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(valid[i], expected[i], "Wrong batch FCS check of frame " << i);
+    }
+}
+
 /**
  * \ingroup lr-wpan-test
  * \ingroup tests
@@ -113,6 +316,8 @@ LrWpanPacketTestSuite::LrWpanPacketTestSuite()
     : TestSuite("lr-wpan-packet", Type::UNIT)
 {
     AddTestCase(new LrWpanPacketTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanMacHeaderViewTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanMacTrailerFcsTestCase, TestCase::Duration::QUICK);
 }
 
 static LrWpanPacketTestSuite g_lrWpanPacketTestSuite; //!< Static variable for test initialization
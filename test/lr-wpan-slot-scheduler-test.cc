@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-helper.h>
+#include <ns3/lr-wpan-net-device.h>
+#include <ns3/lr-wpan-slot-scheduler.h>
+#include <ns3/lr-wpan-traffic-generator.h>
+#include <ns3/make-event.h>
+#include <ns3/map-scheduler.h>
+#include <ns3/node-container.h>
+#include <ns3/object-factory.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/simulator.h>
+#include <ns3/test.h>
+#include <ns3/uinteger.h>
+
+#include <iterator>
+#include <map>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-slot-scheduler-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check that the LrWpanSlotScheduler gives its events in the order of a
+ *        MapScheduler, with events far beyond its horizon and removals.
+ */
+class LrWpanSlotSchedulerOrderTestCase : public TestCase
+{
+  public:
+    LrWpanSlotSchedulerOrderTestCase();
+    ~LrWpanSlotSchedulerOrderTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanSlotSchedulerOrderTestCase::LrWpanSlotSchedulerOrderTestCase()
+    : TestCase("Order of the events of the slot scheduler")
+{
+}
+
+LrWpanSlotSchedulerOrderTestCase::~LrWpanSlotSchedulerOrderTestCase()
+{
+}
+
+void
+LrWpanSlotSchedulerOrderTestCase::DoRun()
+{
+    // A short calendar of 8 slots: a third of the events lie beyond it.
+    Ptr<LrWpanSlotScheduler> slots = CreateObject<LrWpanSlotScheduler>();
+    slots->SetAttribute("Buckets", UintegerValue(8));
+    Ptr<MapScheduler> reference = CreateObject<MapScheduler>();
+    const uint64_t slotSteps = MicroSeconds(320).GetTimeStep();
+
+    Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+    random->SetStream(1);
+
+    std::vector<EventImpl*> impls;
+    std::map<uint32_t, Scheduler::Event> pending; // by uid
+    uint64_t now = 0;
+    uint32_t uid = 0;
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        uint32_t action = random->GetInteger(0, 9);
+        if (action < 5)
+        {
+            // same time, next backoff boundaries, off boundary or far away
+            uint64_t delay = 0;
+            switch (random->GetInteger(0, 3))
+            {
+            case 1:
+                delay = slotSteps * random->GetInteger(1, 4);
+                break;
+            case 2:
+                delay = random->GetInteger(1, static_cast<uint32_t>(5 * slotSteps));
+                break;
+            case 3:
+                delay = slotSteps * random->GetInteger(8, 100);
+                break;
+            }
+            EventImpl* impl = MakeEvent([]() {});
+            impls.push_back(impl);
+            Scheduler::Event ev{impl, {now + delay, uid++, 0}};
+            slots->Insert(ev);
+            reference->Insert(ev);
+            pending[ev.key.m_uid] = ev;
+        }
+        else if (action < 8 && !reference->IsEmpty())
+        {
+            Scheduler::Event peeked = slots->PeekNext();
+            Scheduler::Event next = slots->RemoveNext();
+            Scheduler::Event expected = reference->RemoveNext();
+            NS_TEST_ASSERT_MSG_EQ(peeked.impl, next.impl, "PeekNext must give the next event");
+            NS_TEST_ASSERT_MSG_EQ(next.key.m_uid, expected.key.m_uid, "Event " << i);
+            NS_TEST_ASSERT_MSG_EQ(next.key.m_ts, expected.key.m_ts, "Time of event " << i);
+            now = next.key.m_ts;
+            pending.erase(next.key.m_uid);
+        }
+        else if (!pending.empty())
+        {
+            // cancel a random pending event
+            auto it = std::next(pending.begin(), random->GetInteger(0, pending.size() - 1));
+            slots->Remove(it->second);
+            reference->Remove(it->second);
+            pending.erase(it);
+        }
+        NS_TEST_ASSERT_MSG_EQ(slots->IsEmpty(), reference->IsEmpty(), "Emptiness " << i);
+    }
+    while (!reference->IsEmpty())
+    {
+        NS_TEST_ASSERT_MSG_EQ(slots->RemoveNext().key.m_uid,
+                              reference->RemoveNext().key.m_uid,
+                              "Remaining events");
+    }
+    NS_TEST_ASSERT_MSG_EQ(slots->IsEmpty(), true, "Every event must be given once");
+
+    for (EventImpl* impl : impls)
+    {
+        impl->Unref();
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check that a beacon-enabled PAN runs the same with the
+ *        LrWpanSlotScheduler as with the default scheduler.
+ */
+class LrWpanSlotSchedulerPanTestCase : public TestCase
+{
+  public:
+    LrWpanSlotSchedulerPanTestCase();
+    ~LrWpanSlotSchedulerPanTestCase() override;
+
+  private:
+    /**
+     * \brief Run a star PAN with Poisson traffic.
+     * \param scheduler the TypeId name of the scheduler
+     * \param events the executed events
+     * \return the times the coordinator received a frame
+     */
+    static std::vector<Time> RunPan(const std::string& scheduler, uint64_t& events);
+
+    void DoRun() override;
+};
+
+LrWpanSlotSchedulerPanTestCase::LrWpanSlotSchedulerPanTestCase()
+    : TestCase("Beacon-enabled PAN run with the slot scheduler")
+{
+}
+
+LrWpanSlotSchedulerPanTestCase::~LrWpanSlotSchedulerPanTestCase()
+{
+}
+
+std::vector<Time>
+LrWpanSlotSchedulerPanTestCase::RunPan(const std::string& scheduler, uint64_t& events)
+{
+    ObjectFactory factory(scheduler);
+    Simulator::SetScheduler(factory);
+
+    std::vector<Time> receptions;
+    NodeContainer nodes;
+    nodes.Create(9);
+    LrWpanHelper helper;
+    NetDeviceContainer devices = helper.InstallStarPan(nodes, 5, {2, 2, 2, 2});
+    helper.AssignStreams(devices, 0);
+    DynamicCast<LrWpanNetDevice>(devices.Get(0))
+        ->GetMac()
+        ->TraceConnectWithoutContext("MacRx",
+                                     Callback<void, Ptr<const Packet>, uint8_t>(
+                                         [&receptions](Ptr<const Packet>, uint8_t) {
+                                             receptions.push_back(Simulator::Now());
+                                         }));
+
+    NetDeviceContainer endDevices;
+    for (uint32_t i = 1; i < devices.GetN(); i++)
+    {
+        endDevices.Add(devices.Get(i));
+    }
+    Ptr<LrWpanTrafficGenerator> traffic = CreateObject<LrWpanTrafficGenerator>();
+    for (uint8_t tp = 0; tp < 8; tp++)
+    {
+        traffic->SetSource(tp, "ns3::lrwpan::LrWpanPoissonTrafficSource", "Rate", DoubleValue(5));
+    }
+    helper.InstallTraffic(endDevices, traffic);
+    traffic->AssignStreams(100);
+    helper.StartSynchronizedPan(devices, 4, 4, Seconds(0.01));
+    traffic->Start(Seconds(0.1));
+    traffic->Stop(Seconds(3));
+
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+    events = Simulator::GetEventCount();
+    Simulator::Destroy();
+    return receptions;
+}
+
+void
+LrWpanSlotSchedulerPanTestCase::DoRun()
+{
+    uint64_t mapEvents = 0;
+    uint64_t slotEvents = 0;
+    std::vector<Time> mapReceptions = RunPan("ns3::MapScheduler", mapEvents);
+    std::vector<Time> slotReceptions = RunPan("ns3::lrwpan::LrWpanSlotScheduler", slotEvents);
+
+    NS_TEST_ASSERT_MSG_GT(mapReceptions.size(), 0U, "The coordinator must receive frames");
+    NS_TEST_ASSERT_MSG_EQ(slotEvents, mapEvents, "The same events must be executed");
+    NS_TEST_ASSERT_MSG_EQ(slotReceptions.size(), mapReceptions.size(), "Frames received");
+    for (std::size_t i = 0; i < mapReceptions.size() && i < slotReceptions.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(slotReceptions[i], mapReceptions[i], "Reception " << i);
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan slot scheduler TestSuite
+ */
+class LrWpanSlotSchedulerTestSuite : public TestSuite
+{
+  public:
+    LrWpanSlotSchedulerTestSuite();
+};
+
+LrWpanSlotSchedulerTestSuite::LrWpanSlotSchedulerTestSuite()
+    : TestSuite("lr-wpan-slot-scheduler", Type::UNIT)
+{
+    AddTestCase(new LrWpanSlotSchedulerOrderTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanSlotSchedulerPanTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanSlotSchedulerTestSuite
+    g_lrWpanSlotSchedulerTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-steady-state-controller.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/test.h>
+
+#include <cmath>
+#include <cstring>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-steady-state-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Feed the controller a correlated series with an initial transient.
+ */
+class LrWpanSteadyStateTestCase : public TestCase
+{
+  public:
+    LrWpanSteadyStateTestCase();
+    ~LrWpanSteadyStateTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanSteadyStateTestCase::LrWpanSteadyStateTestCase()
+    : TestCase("Test the MSER-5 warm-up removal and the batch means convergence")
+{
+}
+
+LrWpanSteadyStateTestCase::~LrWpanSteadyStateTestCase()
+{
+}
+
+void
+LrWpanSteadyStateTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    Ptr<NormalRandomVariable> noise = CreateObject<NormalRandomVariable>();
+    noise->SetAttribute("Variance", DoubleValue(0.0025));
+
+    LrWpanSteadyStateController controller;
+    controller.AddMetric("ratio",
+                         LrWpanSteadyStateController::Metric([](const LrWpanSuperframeRecord& r) {
+                             return r.enqueued[0] ? r.success[0] / 1000.0 : std::nan("");
+                         }));
+    controller.SetTargetHalfWidth(0.005);
+    uint32_t convergedAt = 0;
+    uint32_t superframes = 0;
+    controller.SetConvergedCallback(
+        Callback<void>([&convergedAt, &superframes]() { convergedAt = superframes; }));
+    Ptr<LrWpanSuperframeSink> sink = controller.GetSink();
+
+    // Start at 0.2 and settle at 0.8 with an AR(1) noise; every 7th superframe
+    // has no traffic and must be skipped.
+    double ar = 0;
+    for (superframes = 1; superframes <= 10000 && convergedAt == 0; superframes++)
+    {
+        LrWpanSuperframeRecord record;
+        std::memset(&record, 0, sizeof(record));
+        ar = 0.7 * ar + noise->GetValue();
+        double value = 0.8 - 0.6 * std::exp(-(superframes / 40.0)) + ar;
+        record.enqueued[0] = superframes % 7 ? 1 : 0;
+        record.success[0] = std::lround(value * 1000);
+        sink->Write(record);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(controller.IsConverged(), true, "No convergence in 10000 superframes");
+    NS_TEST_ASSERT_MSG_GT(convergedAt, 0, "The converged callback was not invoked");
+
+    LrWpanSteadyStateController::Estimate e = controller.GetEstimates()[0];
+    NS_TEST_ASSERT_MSG_GT(e.warmup, 0, "The transient was not removed");
+    NS_TEST_ASSERT_MSG_LT(e.warmup, e.n, "More warm-up than steady state");
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(e.halfWidth, 0.005, "Converged above the target half width");
+    NS_TEST_ASSERT_MSG_EQ_TOL(e.mean, 0.8, 0.015, "Wrong steady-state mean");
+
+    // Without a warm-up removal, a strong transient biases a short series.
+    std::vector<double> samples(400, 1.0);
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        samples[i] = 0;
+    }
+    NS_TEST_ASSERT_MSG_EQ(LrWpanSteadyStateController::Mser5(samples), 50, "Wrong truncation");
+    double mean;
+    double halfWidth;
+    NS_TEST_ASSERT_MSG_EQ(LrWpanSteadyStateController::BatchMeans(samples, 50, 10, mean, halfWidth),
+                          true,
+                          "Enough samples for 10 batches");
+    NS_TEST_ASSERT_MSG_EQ_TOL(mean, 1.0, 1e-12, "Warm-up included in the mean");
+    NS_TEST_ASSERT_MSG_EQ_TOL(halfWidth, 0.0, 1e-12, "Constant series has no variance");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan steady-state controller TestSuite
+ */
+class LrWpanSteadyStateTestSuite : public TestSuite
+{
+  public:
+    LrWpanSteadyStateTestSuite();
+};
+
+LrWpanSteadyStateTestSuite::LrWpanSteadyStateTestSuite()
+    : TestSuite("lr-wpan-steady-state", Type::UNIT)
+{
+    AddTestCase(new LrWpanSteadyStateTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanSteadyStateTestSuite g_lrWpanSteadyStateTestSuite; //!< Static variable for test initialization
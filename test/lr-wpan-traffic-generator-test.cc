@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025 Gyeongsang National University, Jinju, South Korea.
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author:  Jo Seoung Hyeon <gmelan@gnu.ac.kr>
+ */
+#include <ns3/boolean.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-deadline-tag.h>
+#include <ns3/lr-wpan-helper.h>
+#include <ns3/lr-wpan-traffic-generator.h>
+#include <ns3/node-container.h>
+#include <ns3/packet.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/simulator.h>
+#include <ns3/test.h>
+
+#include <map>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-traffic-generator-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check the arrival processes of the traffic sources.
+ */
+class LrWpanTrafficSourceTestCase : public TestCase
+{
+  public:
+    LrWpanTrafficSourceTestCase();
+    ~LrWpanTrafficSourceTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \param source a source
+     * \param duration the observation time
+     * \return the number of arrivals in [1 s, 1 s + duration)
+     */
+    uint32_t Count(Ptr<LrWpanTrafficSource> source, Time duration);
+};
+
+LrWpanTrafficSourceTestCase::LrWpanTrafficSourceTestCase()
+    : TestCase("Test the Poisson, periodic, on/off and trace traffic sources")
+{
+}
+
+LrWpanTrafficSourceTestCase::~LrWpanTrafficSourceTestCase()
+{
+}
+
+uint32_t
+LrWpanTrafficSourceTestCase::Count(Ptr<LrWpanTrafficSource> source, Time duration)
+{
+    Time start = Seconds(1);
+    uint32_t count = 0;
+    for (Time t = source->GetNextArrival(start); t < start + duration;
+         t = source->GetNextArrival(t))
+    {
+        NS_TEST_EXPECT_MSG_GT_OR_EQ(t, start, "Arrival before the start");
+        count++;
+    }
+    return count;
+}
+
+void
+LrWpanTrafficSourceTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    Ptr<LrWpanPoissonTrafficSource> poisson = CreateObject<LrWpanPoissonTrafficSource>();
+    poisson->SetAttribute("Rate", DoubleValue(10));
+    NS_TEST_ASSERT_MSG_EQ_TOL(Count(poisson, Seconds(1000)), 10000, 300, "Wrong Poisson rate");
+
+    Ptr<LrWpanPeriodicTrafficSource> periodic = CreateObject<LrWpanPeriodicTrafficSource>();
+    periodic->SetAttribute("Period", TimeValue(MilliSeconds(100)));
+    periodic->SetAttribute("Jitter", TimeValue(MilliSeconds(10)));
+    Time previous = Seconds(1);
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        Time t = periodic->GetNextArrival(previous);
+        Time boundary = Seconds(1) + MilliSeconds(100) * i;
+        NS_TEST_ASSERT_MSG_GT_OR_EQ(t, boundary, "Arrival before its period boundary");
+        NS_TEST_ASSERT_MSG_LT(t, boundary + MilliSeconds(10), "Jitter above the maximum");
+        previous = t;
+    }
+
+    // Half of the time on: half of the on rate on average.
+    Ptr<LrWpanOnOffTrafficSource> onOff = CreateObject<LrWpanOnOffTrafficSource>();
+    onOff->SetAttribute("Rate", DoubleValue(20));
+    onOff->SetAttribute("MeanOnTime", TimeValue(Seconds(1)));
+    onOff->SetAttribute("MeanOffTime", TimeValue(Seconds(1)));
+    NS_TEST_ASSERT_MSG_EQ_TOL(Count(onOff, Seconds(2000)), 20000, 2000, "Wrong on/off rate");
+
+    Ptr<LrWpanTraceTrafficSource> trace = CreateObject<LrWpanTraceTrafficSource>();
+    trace->AddArrival(Seconds(2), 30);
+    trace->AddArrival(Seconds(0.5), 0);
+    NS_TEST_ASSERT_MSG_EQ(trace->GetNextArrival(Seconds(1)), Seconds(1.5), "Unsorted trace");
+    NS_TEST_ASSERT_MSG_EQ(trace->GetPacketSize(), 0, "Wrong size");
+    NS_TEST_ASSERT_MSG_EQ(trace->GetNextArrival(Seconds(1.5)), Seconds(3), "Wrong offset");
+    NS_TEST_ASSERT_MSG_EQ(trace->GetPacketSize(), 30, "Wrong size");
+    NS_TEST_ASSERT_MSG_EQ(trace->GetNextArrival(Seconds(3)), Time::Max(), "Trace not exhausted");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Check the packets sent by a traffic generator on a star PAN.
+ *
+ * Three devices, TPs 0, 1 and 2, get periodic arrivals every 100 ms from
+ * 1 s. The synchronized arrivals must be sent by one event per timestamp,
+ * with the size and the deadline of their TP. The generator is stopped at
+ * 2.55 s while the arrivals of 2.6 s are already queued: the last packets
+ * are those of 2.5 s.
+ */
+class LrWpanTrafficGeneratorTestCase : public TestCase
+{
+  public:
+    LrWpanTrafficGeneratorTestCase();
+    ~LrWpanTrafficGeneratorTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Packet handed to McpsDataRequest.
+     * \param p the packet
+     * \param tp the TP of its sender
+     */
+    void Tx(Ptr<const Packet> p, uint8_t tp);
+
+    std::map<uint8_t, std::vector<Time>> m_sent; //!< Send times, by TP (one device each)
+    std::map<Time, uint64_t> m_events;           //!< Executed events at each send time
+};
+
+LrWpanTrafficGeneratorTestCase::LrWpanTrafficGeneratorTestCase()
+    : TestCase("Test the packets of the traffic generator")
+{
+}
+
+LrWpanTrafficGeneratorTestCase::~LrWpanTrafficGeneratorTestCase()
+{
+}
+
+void
+LrWpanTrafficGeneratorTestCase::Tx(Ptr<const Packet> p, uint8_t tp)
+{
+    Time now = Simulator::Now();
+    m_sent[tp].push_back(now);
+
+    // every arrival of a timestamp is sent by the same event
+    auto it = m_events.emplace(now, Simulator::GetEventCount()).first;
+    NS_TEST_EXPECT_MSG_EQ(it->second,
+                          Simulator::GetEventCount(),
+                          "Arrivals of " << now.As(Time::S) << " sent by several events");
+
+    NS_TEST_EXPECT_MSG_EQ(p->GetSize(), tp == 1 ? 20U : 50U, "Wrong size of TP " << +tp);
+    LrWpanDeadlineTag deadlineTag;
+    bool tagged = p->PeekPacketTag(deadlineTag);
+    NS_TEST_EXPECT_MSG_EQ(tagged, tp == 2, "Deadline tag of TP " << +tp);
+    if (tagged)
+    {
+        NS_TEST_EXPECT_MSG_EQ(deadlineTag.Get(),
+                              static_cast<double>((now + MilliSeconds(30)).GetMilliSeconds()),
+                              "Wrong deadline");
+    }
+}
+
+void
+LrWpanTrafficGeneratorTestCase::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(4);
+    LrWpanHelper helper;
+    NetDeviceContainer devices = helper.InstallStarPan(nodes, 5, {1, 1, 1});
+    NetDeviceContainer endDevices;
+    for (uint32_t i = 1; i < devices.GetN(); i++)
+    {
+        endDevices.Add(devices.Get(i));
+    }
+
+    Ptr<LrWpanTrafficGenerator> traffic = CreateObject<LrWpanTrafficGenerator>();
+    for (uint8_t tp = 0; tp < 3; tp++)
+    {
+        traffic->SetSource(tp,
+                           "ns3::lrwpan::LrWpanPeriodicTrafficSource",
+                           "Period",
+                           TimeValue(MilliSeconds(100)));
+    }
+    traffic->SetPacketSize(1, 20);
+    traffic->SetDeadline(2, MilliSeconds(30));
+    helper.InstallTraffic(endDevices, traffic);
+    traffic->TraceConnectWithoutContext(
+        "Tx",
+        MakeCallback(&LrWpanTrafficGeneratorTestCase::Tx, this));
+
+    traffic->Start(Seconds(1));
+    Simulator::Schedule(Seconds(2.52), &LrWpanTrafficGenerator::Stop, traffic, Seconds(2.55));
+    Simulator::Stop(Seconds(4));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_sent.size(), 3U, "Every device must send");
+    for (const auto& [tp, times] : m_sent)
+    {
+        NS_TEST_EXPECT_MSG_EQ(times.size(), 16U, "Packets of TP " << +tp);
+        NS_TEST_EXPECT_MSG_EQ(times.front(), Seconds(1), "First packet of TP " << +tp);
+        NS_TEST_EXPECT_MSG_EQ(times.back(), Seconds(2.5), "Sent after Stop by TP " << +tp);
+    }
+    NS_TEST_EXPECT_MSG_EQ(traffic->GetPacketCount(), 48U, "Wrong packet count");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan traffic generator TestSuite
+ */
+class LrWpanTrafficGeneratorTestSuite : public TestSuite
+{
+  public:
+    LrWpanTrafficGeneratorTestSuite();
+};
+
+LrWpanTrafficGeneratorTestSuite::LrWpanTrafficGeneratorTestSuite()
+    : TestSuite("lr-wpan-traffic-generator", Type::UNIT)
+{
+    AddTestCase(new LrWpanTrafficSourceTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTrafficGeneratorTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanTrafficGeneratorTestSuite
+    g_lrWpanTrafficGeneratorTestSuite; //!< Static variable for test initialization